@@ -0,0 +1,406 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include "capabilitySnapshot.h"
+#if defined(_WIN32)
+# define WIN32_LEAN_AND_MEAN  // this reduces win32 headers default namespace pollution
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+using namespace std;
+
+
+// snapshot file layout:
+// SnapshotHeader followed by numDevices records; each record is made of SnapshotRecord
+// followed by numQueueFamilies of vk::QueueFamilyProperties, numQueueFamilies of
+// vk::VideoCodecOperationFlagsKHR and numExtensions of vk::ExtensionProperties
+static constexpr const char snapshotMagic[8] = "VKGCAPS";
+static constexpr const uint32_t snapshotFormatVersion = 1;
+
+struct SnapshotHeader {
+	char magic[8];
+	uint32_t formatVersion;
+	uint32_t loaderVersion;
+	uint32_t numDevices;
+	uint32_t recordSize;  // sizeof(SnapshotRecord); it detects structure layout changes between builds
+	uint64_t fileSize;
+};
+
+struct SnapshotRecord {
+	uint64_t size;  // size of the whole record, including the arrays following this structure
+	DeviceKey key;
+	vk::PhysicalDeviceProperties properties;
+	vk::PhysicalDeviceVulkan11Properties properties11;
+	vk::PhysicalDeviceVulkan12Properties properties12;
+	vk::PhysicalDevicePCIBusInfoPropertiesEXT pciBusInfo;
+	vk::PhysicalDeviceFeatures features;
+	vk::PhysicalDeviceVulkan12Features features12;
+	vk::PhysicalDeviceMemoryProperties memoryProperties;
+	array<vk::FormatProperties, snapshotFormatList.size()> formatPropertiesList;
+	uint32_t pciBusInfoSupported;
+	uint32_t videoQueueSupported;
+	uint32_t raytracingSupported;
+	uint32_t numQueueFamilies;
+	uint32_t numExtensions;
+};
+
+static_assert(is_trivially_copyable_v<SnapshotRecord>, "SnapshotRecord must be trivially copyable.");
+
+
+static size_t recordSize(size_t numQueueFamilies, size_t numExtensions)
+{
+	size_t s = sizeof(SnapshotRecord) +
+		numQueueFamilies * (sizeof(vk::QueueFamilyProperties) + sizeof(vk::VideoCodecOperationFlagsKHR)) +
+		numExtensions * sizeof(vk::ExtensionProperties);
+	return (s + alignof(SnapshotRecord) - 1) & ~(alignof(SnapshotRecord) - 1);
+}
+
+
+DeviceCapabilities queryDeviceCapabilities(vk::PhysicalDevice pd, uint32_t instanceVersion)
+{
+	DeviceCapabilities c;
+
+	// device properties
+	vk::PhysicalDeviceProperties2 properties2;
+	c.properties = vk::getPhysicalDeviceProperties(pd);
+	properties2.properties = c.properties;
+
+	// supported extensions
+	vk::vector<vk::ExtensionProperties> extensionList = vk::enumerateDeviceExtensionProperties(pd, nullptr);
+	c.extensionList.assign(extensionList.data(), extensionList.data() + extensionList.size());
+	c.videoQueueSupported = vk::isExtensionSupported(extensionList, "VK_KHR_video_queue") &&
+	                        instanceVersion >= vk::ApiVersion11;
+	c.raytracingSupported = vk::isExtensionSupported(extensionList, "VK_KHR_acceleration_structure") &&
+	                        vk::isExtensionSupported(extensionList, "VK_KHR_ray_tracing_pipeline") &&
+	                        vk::isExtensionSupported(extensionList, "VK_KHR_ray_query") &&
+	                        instanceVersion >= vk::ApiVersion11;
+	c.pciBusInfoSupported = vk::isExtensionSupported(extensionList, "VK_EXT_pci_bus_info") &&
+	                        instanceVersion >= vk::ApiVersion11;
+
+	// extended device properties
+	if(c.properties.apiVersion >= vk::ApiVersion11) {
+		void** lastPNext = &properties2.pNext;
+		if(c.properties.apiVersion >= vk::ApiVersion12) {
+			properties2.pNext = &c.properties11;
+			c.properties11.pNext = &c.properties12;
+			lastPNext = &c.properties12.pNext;
+		}
+		if(c.pciBusInfoSupported)
+			*lastPNext = &c.pciBusInfo;
+		vk::getPhysicalDeviceProperties2(pd, properties2);
+		c.properties11.pNext = nullptr;
+		c.properties12.pNext = nullptr;
+	}
+
+	// device features
+	vk::PhysicalDeviceFeatures2 features2{
+		.pNext = (c.properties.apiVersion>=vk::ApiVersion12) ? &c.features12 : nullptr,
+	};
+	if(c.properties.apiVersion >= vk::ApiVersion11) {
+		vk::getPhysicalDeviceFeatures2(pd, features2);
+		c.features = features2.features;
+	}
+	else
+		c.features = vk::getPhysicalDeviceFeatures(pd);
+
+	// memory properties
+	c.memoryProperties = vk::getPhysicalDeviceMemoryProperties(pd);
+
+	// queue family properties
+	if(c.properties.apiVersion >= vk::ApiVersion11) {
+		vk::vector<vk::QueueFamilyVideoPropertiesKHR> queueVideoPropertiesList;
+		vk::vector<vk::QueueFamilyProperties2> v =
+			vk::getPhysicalDeviceQueueFamilyProperties2(pd, queueVideoPropertiesList, c.videoQueueSupported);
+		c.queueFamilyList.resize(v.size());
+		c.videoCodecOperationsList.resize(v.size());
+		for(size_t i=0; i<v.size(); i++) {
+			c.queueFamilyList[i] = v[i].queueFamilyProperties;
+			if(c.videoQueueSupported)
+				c.videoCodecOperationsList[i] = queueVideoPropertiesList[i].videoCodecOperations;
+		}
+	}
+	else {
+		vk::vector<vk::QueueFamilyProperties> v = vk::getPhysicalDeviceQueueFamilyProperties(pd);
+		c.queueFamilyList.assign(v.data(), v.data() + v.size());
+		c.videoCodecOperationsList.resize(v.size());
+	}
+
+	// format properties
+	for(size_t i=0; i<snapshotFormatList.size(); i++)
+		if(snapshotFormatList[i] != vk::Format::eAstc4x4SfloatBlock || c.properties.apiVersion >= vk::ApiVersion13)
+			c.formatPropertiesList[i] = vk::getPhysicalDeviceFormatProperties(pd, snapshotFormatList[i]);
+		else
+			c.formatPropertiesList[i] = vk::FormatProperties{};
+
+	return c;
+}
+
+
+bool DeviceKey::operator==(const DeviceKey& rhs) const
+{
+	return vendorID == rhs.vendorID && deviceID == rhs.deviceID &&
+	       driverVersion == rhs.driverVersion && apiVersion == rhs.apiVersion &&
+	       memcmp(deviceUUID, rhs.deviceUUID, sizeof(deviceUUID)) == 0 &&
+	       strncmp(deviceName, rhs.deviceName, sizeof(deviceName)) == 0;
+}
+
+
+static DeviceKey makeDeviceKey(const vk::PhysicalDeviceProperties& properties, const uint8_t* deviceUUID)
+{
+	DeviceKey key{};
+	key.vendorID = properties.vendorID;
+	key.deviceID = properties.deviceID;
+	key.driverVersion = properties.driverVersion;
+	key.apiVersion = properties.apiVersion;
+	if(deviceUUID)
+		memcpy(key.deviceUUID, deviceUUID, sizeof(key.deviceUUID));
+	memcpy(key.deviceName, properties.deviceName, sizeof(key.deviceName));  // null terminated by Vulkan spec
+	return key;
+}
+
+
+DeviceKey getDeviceKey(vk::PhysicalDevice pd)
+{
+	vk::PhysicalDeviceProperties properties = vk::getPhysicalDeviceProperties(pd);
+	if(properties.apiVersion < vk::ApiVersion12)
+		return makeDeviceKey(properties, nullptr);
+
+	// get deviceUUID
+	vk::PhysicalDeviceVulkan11Properties properties11;
+	vk::PhysicalDeviceProperties2 properties2{
+		.pNext = &properties11,
+	};
+	vk::getPhysicalDeviceProperties2(pd, properties2);
+	return makeDeviceKey(properties2.properties, properties11.deviceUUID);
+}
+
+
+DeviceKey getDeviceKey(const DeviceCapabilities& c)
+{
+	return makeDeviceKey(c.properties, (c.properties.apiVersion >= vk::ApiVersion12) ? c.properties11.deviceUUID : nullptr);
+}
+
+
+bool CapabilitySnapshot::open(const string& fileName, uint32_t loaderVersion)
+{
+	close();
+
+	// map the file
+#if defined(_WIN32)
+	_fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(_fileHandle == INVALID_HANDLE_VALUE) {
+		_fileHandle = nullptr;
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	if(!GetFileSizeEx(_fileHandle, &fileSize) || fileSize.QuadPart < LONGLONG(sizeof(SnapshotHeader))) {
+		close();
+		return false;
+	}
+	_mappingHandle = CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if(_mappingHandle == nullptr) {
+		close();
+		return false;
+	}
+	_data = reinterpret_cast<const byte*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if(_data == nullptr) {
+		close();
+		return false;
+	}
+	_size = size_t(fileSize.QuadPart);
+#else
+	int fd = ::open(fileName.c_str(), O_RDONLY);
+	if(fd == -1)
+		return false;
+	struct stat st;
+	if(fstat(fd, &st) != 0 || st.st_size < off_t(sizeof(SnapshotHeader))) {
+		::close(fd);
+		return false;
+	}
+	void* p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);  // mapping remains valid after the file descriptor is closed
+	if(p == MAP_FAILED)
+		return false;
+	_data = reinterpret_cast<const byte*>(p);
+	_size = size_t(st.st_size);
+#endif
+
+	// validate header
+	auto& h = *reinterpret_cast<const SnapshotHeader*>(_data);
+	if(memcmp(h.magic, snapshotMagic, sizeof(h.magic)) != 0 || h.formatVersion != snapshotFormatVersion ||
+	   h.loaderVersion != loaderVersion || h.recordSize != sizeof(SnapshotRecord) || h.fileSize != _size)
+	{
+		close();
+		return false;
+	}
+
+	// validate records
+	size_t offset = sizeof(SnapshotHeader);
+	for(uint32_t i=0; i<h.numDevices; i++) {
+		if(offset + sizeof(SnapshotRecord) > _size) {
+			close();
+			return false;
+		}
+		auto& r = *reinterpret_cast<const SnapshotRecord*>(_data + offset);
+		if(r.size != recordSize(r.numQueueFamilies, r.numExtensions) || offset + r.size > _size) {
+			close();
+			return false;
+		}
+		offset += r.size;
+	}
+
+	return true;
+}
+
+
+void CapabilitySnapshot::close() noexcept
+{
+#if defined(_WIN32)
+	if(_data)
+		UnmapViewOfFile(_data);
+	if(_mappingHandle)
+		CloseHandle(_mappingHandle);
+	if(_fileHandle)
+		CloseHandle(_fileHandle);
+	_mappingHandle = nullptr;
+	_fileHandle = nullptr;
+#else
+	if(_data)
+		munmap(const_cast<byte*>(_data), _size);
+#endif
+	_data = nullptr;
+	_size = 0;
+}
+
+
+uint32_t CapabilitySnapshot::numDevices() const
+{
+	if(_data == nullptr)
+		return 0;
+	return reinterpret_cast<const SnapshotHeader*>(_data)->numDevices;
+}
+
+
+bool CapabilitySnapshot::find(const DeviceKey& key, DeviceCapabilities& c) const
+{
+	if(_data == nullptr)
+		return false;
+
+	// find the record
+	auto& h = *reinterpret_cast<const SnapshotHeader*>(_data);
+	const byte* p = _data + sizeof(SnapshotHeader);
+	for(uint32_t i=0; i<h.numDevices; i++) {
+		auto& r = *reinterpret_cast<const SnapshotRecord*>(p);
+		if(!(r.key == key)) {
+			p += r.size;
+			continue;
+		}
+
+		// fixed part
+		c.properties = r.properties;
+		c.properties11 = r.properties11;
+		c.properties11.pNext = nullptr;
+		c.properties12 = r.properties12;
+		c.properties12.pNext = nullptr;
+		c.pciBusInfo = r.pciBusInfo;
+		c.pciBusInfo.pNext = nullptr;
+		c.features = r.features;
+		c.features12 = r.features12;
+		c.features12.pNext = nullptr;
+		c.memoryProperties = r.memoryProperties;
+		c.formatPropertiesList = r.formatPropertiesList;
+		c.pciBusInfoSupported = r.pciBusInfoSupported;
+		c.videoQueueSupported = r.videoQueueSupported;
+		c.raytracingSupported = r.raytracingSupported;
+
+		// arrays
+		p += sizeof(SnapshotRecord);
+		auto queueFamilies = reinterpret_cast<const vk::QueueFamilyProperties*>(p);
+		c.queueFamilyList.assign(queueFamilies, queueFamilies + r.numQueueFamilies);
+		p += r.numQueueFamilies * sizeof(vk::QueueFamilyProperties);
+		auto codecOperations = reinterpret_cast<const vk::VideoCodecOperationFlagsKHR*>(p);
+		c.videoCodecOperationsList.assign(codecOperations, codecOperations + r.numQueueFamilies);
+		p += r.numQueueFamilies * sizeof(vk::VideoCodecOperationFlagsKHR);
+		auto extensions = reinterpret_cast<const vk::ExtensionProperties*>(p);
+		c.extensionList.assign(extensions, extensions + r.numExtensions);
+		return true;
+	}
+
+	return false;
+}
+
+
+void CapabilitySnapshot::save(const string& fileName, uint32_t loaderVersion, const vector<DeviceCapabilities>& deviceList)
+{
+	// header
+	SnapshotHeader h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, snapshotMagic, sizeof(h.magic));
+	h.formatVersion = snapshotFormatVersion;
+	h.loaderVersion = loaderVersion;
+	h.numDevices = uint32_t(deviceList.size());
+	h.recordSize = sizeof(SnapshotRecord);
+	h.fileSize = sizeof(SnapshotHeader);
+	for(const DeviceCapabilities& c : deviceList)
+		h.fileSize += recordSize(c.queueFamilyList.size(), c.extensionList.size());
+
+	// write into the temporary file first,
+	// so the readers never see partially written snapshot
+	string tmpFileName = fileName + ".tmp";
+	{
+		ofstream f(tmpFileName, ios::out | ios::binary | ios::trunc);
+		if(!f)
+			throw runtime_error("Cannot create file " + tmpFileName + ".");
+		f.write(reinterpret_cast<const char*>(&h), sizeof(h));
+
+		// records
+		for(const DeviceCapabilities& c : deviceList) {
+			SnapshotRecord r{};
+			r.size = recordSize(c.queueFamilyList.size(), c.extensionList.size());
+			r.key = getDeviceKey(c);
+			r.properties = c.properties;
+			r.properties11 = c.properties11;
+			r.properties11.pNext = nullptr;
+			r.properties12 = c.properties12;
+			r.properties12.pNext = nullptr;
+			r.pciBusInfo = c.pciBusInfo;
+			r.pciBusInfo.pNext = nullptr;
+			r.features = c.features;
+			r.features12 = c.features12;
+			r.features12.pNext = nullptr;
+			r.memoryProperties = c.memoryProperties;
+			r.formatPropertiesList = c.formatPropertiesList;
+			r.pciBusInfoSupported = c.pciBusInfoSupported;
+			r.videoQueueSupported = c.videoQueueSupported;
+			r.raytracingSupported = c.raytracingSupported;
+			r.numQueueFamilies = uint32_t(c.queueFamilyList.size());
+			r.numExtensions = uint32_t(c.extensionList.size());
+			f.write(reinterpret_cast<const char*>(&r), sizeof(r));
+			f.write(reinterpret_cast<const char*>(c.queueFamilyList.data()),
+			        c.queueFamilyList.size() * sizeof(vk::QueueFamilyProperties));
+			f.write(reinterpret_cast<const char*>(c.videoCodecOperationsList.data()),
+			        c.videoCodecOperationsList.size() * sizeof(vk::VideoCodecOperationFlagsKHR));
+			f.write(reinterpret_cast<const char*>(c.extensionList.data()),
+			        c.extensionList.size() * sizeof(vk::ExtensionProperties));
+
+			// padding
+			size_t padding = r.size - sizeof(r) -
+				c.queueFamilyList.size() * (sizeof(vk::QueueFamilyProperties) + sizeof(vk::VideoCodecOperationFlagsKHR)) -
+				c.extensionList.size() * sizeof(vk::ExtensionProperties);
+			const char zeros[alignof(SnapshotRecord)] = {};
+			f.write(zeros, padding);
+		}
+
+		if(!f)
+			throw runtime_error("Failed to write file " + tmpFileName + ".");
+	}
+
+	// replace the old snapshot
+	filesystem::rename(tmpFileName, fileName);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "vkg.h"
+
+
+// formats whose properties are part of DeviceCapabilities
+constexpr const std::array snapshotFormatList = {
+	vk::Format::eBc7SrgbBlock,
+	vk::Format::eEtc2R8G8B8A8SrgbBlock,
+	vk::Format::eAstc4x4SrgbBlock,
+	vk::Format::eAstc4x4SfloatBlock,  // requires Vulkan 1.3
+};
+
+
+// Capabilities of physical device.
+//
+// They are gathered either by live queries of the physical device
+// or from the capability snapshot stored on the disk.
+struct DeviceCapabilities {
+	vk::PhysicalDeviceProperties properties;
+	vk::PhysicalDeviceVulkan11Properties properties11;  // valid on Vulkan 1.2+ devices
+	vk::PhysicalDeviceVulkan12Properties properties12;  // valid on Vulkan 1.2+ devices
+	vk::PhysicalDevicePCIBusInfoPropertiesEXT pciBusInfo;  // valid if pciBusInfoSupported
+	vk::PhysicalDeviceFeatures features;
+	vk::PhysicalDeviceVulkan12Features features12;  // valid on Vulkan 1.2+ devices
+	vk::PhysicalDeviceMemoryProperties memoryProperties;
+	std::array<vk::FormatProperties, snapshotFormatList.size()> formatPropertiesList;
+	bool pciBusInfoSupported;
+	bool videoQueueSupported;
+	bool raytracingSupported;
+	std::vector<vk::QueueFamilyProperties> queueFamilyList;
+	std::vector<vk::VideoCodecOperationFlagsKHR> videoCodecOperationsList;  // valid if videoQueueSupported
+	std::vector<vk::ExtensionProperties> extensionList;
+};
+
+
+// Query all the capabilities of the physical device.
+DeviceCapabilities queryDeviceCapabilities(vk::PhysicalDevice pd, uint32_t instanceVersion);
+
+
+// Key identifying the device and its driver in the snapshot.
+//
+// It is cheap to get compared to the full capability query:
+// only vkGetPhysicalDeviceProperties2() is called.
+struct DeviceKey {
+	uint32_t vendorID;
+	uint32_t deviceID;
+	uint32_t driverVersion;
+	uint32_t apiVersion;
+	uint8_t deviceUUID[vk::UuidSize];  // zeros on devices older than Vulkan 1.2
+	char deviceName[vk::MaxPhysicalDeviceNameSize];
+	bool operator==(const DeviceKey& rhs) const;
+};
+DeviceKey getDeviceKey(vk::PhysicalDevice pd);
+DeviceKey getDeviceKey(const DeviceCapabilities& c);
+
+
+// Capability snapshot file.
+//
+// The file is memory-mapped and it is valid only if it was created
+// with the same Vulkan loader version. Devices are identified by DeviceKey,
+// so driver update makes the device record stale.
+class CapabilitySnapshot {
+protected:
+	const std::byte* _data = nullptr;
+	size_t _size = 0;
+#if defined(_WIN32)
+	void* _fileHandle = nullptr;
+	void* _mappingHandle = nullptr;
+#endif
+public:
+	CapabilitySnapshot() = default;
+	~CapabilitySnapshot()  { close(); }
+	CapabilitySnapshot(const CapabilitySnapshot&) = delete;
+	CapabilitySnapshot& operator=(const CapabilitySnapshot&) = delete;
+
+	// maps the file; it returns false if the file does not exist or is not valid for loaderVersion
+	bool open(const std::string& fileName, uint32_t loaderVersion);
+	void close() noexcept;
+	bool isOpen() const  { return _data != nullptr; }
+	uint32_t numDevices() const;
+
+	// finds the device record; it returns false if the device is not in the snapshot
+	bool find(const DeviceKey& key, DeviceCapabilities& capabilities) const;
+
+	// writes the snapshot of all the devices; the file must not be opened by any CapabilitySnapshot
+	static void save(const std::string& fileName, uint32_t loaderVersion, const std::vector<DeviceCapabilities>& deviceList);
+};
@@ -0,0 +1,232 @@
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <thread>
+#include "formatMatrix.h"
+
+using namespace std;
+
+
+// ranges of vk::Format values known to vkg.h;
+// each range is queried only if the device supports the Vulkan version or the extension
+struct FormatRange {
+	uint32_t firstFormat;
+	uint32_t lastFormat;
+	uint32_t apiVersion;  // Vulkan version that includes the formats
+	const char* extensionName;  // extension that provides the formats on older Vulkan versions, or nullptr
+};
+static constexpr const array<FormatRange, 7> formatRangeList = {{
+	{ 1, 184, vk::ApiVersion10, nullptr },  // core formats (0 is eUndefined)
+	{ 1000054000, 1000054007, ~uint32_t(0), "VK_IMG_format_pvrtc" },
+	{ 1000066000, 1000066013, vk::ApiVersion13, "VK_EXT_texture_compression_astc_hdr" },
+	{ 1000156000, 1000156033, vk::ApiVersion11, "VK_KHR_sampler_ycbcr_conversion" },
+	{ 1000330000, 1000330003, vk::ApiVersion13, "VK_EXT_ycbcr_2plane_444_formats" },
+	{ 1000340000, 1000340001, vk::ApiVersion13, "VK_EXT_4444_formats" },
+	{ 1000470000, 1000470001, vk::ApiVersion14, "VK_KHR_maintenance5" },
+}};
+
+static constexpr const array<vk::ImageTiling, 2> tilingList = { vk::ImageTiling::eOptimal, vk::ImageTiling::eLinear };
+static constexpr const array<vk::ImageType, 3> imageTypeList = { vk::ImageType::e1D, vk::ImageType::e2D, vk::ImageType::e3D };
+
+
+// binary file layout
+static constexpr const char formatMatrixMagic[8] = "VKGFMTX";
+static constexpr const uint32_t formatMatrixVersion = 1;
+
+struct FormatMatrixHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t numRanges;
+	uint32_t numRecords;
+	uint32_t recordSize;  // sizeof(FormatMatrixRecord)
+	uint32_t vendorID;
+	uint32_t deviceID;
+	uint32_t driverVersion;
+	uint32_t apiVersion;
+	char deviceName[vk::MaxPhysicalDeviceNameSize];
+};
+
+struct FormatMatrixRange {
+	uint32_t firstFormat;
+	uint32_t numFormats;
+	uint32_t firstRecord;
+};
+
+
+// image usage that corresponds to the format features
+static vk::ImageUsageFlags usageFromFeatures(vk::FormatFeatureFlags f)
+{
+	vk::ImageUsageFlags usage;
+	if(f & vk::FormatFeatureFlagBits::eSampledImage)           usage |= vk::ImageUsageFlagBits::eSampled;
+	if(f & vk::FormatFeatureFlagBits::eStorageImage)           usage |= vk::ImageUsageFlagBits::eStorage;
+	if(f & vk::FormatFeatureFlagBits::eColorAttachment)        usage |= vk::ImageUsageFlagBits::eColorAttachment;
+	if(f & vk::FormatFeatureFlagBits::eDepthStencilAttachment) usage |= vk::ImageUsageFlagBits::eDepthStencilAttachment;
+	if(f & vk::FormatFeatureFlagBits::eTransferSrc)            usage |= vk::ImageUsageFlagBits::eTransferSrc;
+	if(f & vk::FormatFeatureFlagBits::eTransferDst)            usage |= vk::ImageUsageFlagBits::eTransferDst;
+	return usage;
+}
+
+
+FormatMatrix queryFormatMatrix(vk::PhysicalDevice pd, const vk::PhysicalDeviceProperties& properties,
+	const vector<vk::ExtensionProperties>& extensionList, unsigned numThreads)
+{
+	auto isExtensionSupported =
+		[&](const char* name) {
+			for(const vk::ExtensionProperties& e : extensionList)
+				if(strcmp(e.extensionName, name) == 0)
+					return true;
+			return false;
+		};
+
+	// prepare records of all formats;
+	// formats that must not be queried are marked by eUndefined
+	FormatMatrix m;
+	vector<vk::Format> queryList;
+	for(const FormatRange& r : formatRangeList) {
+		bool supported = properties.apiVersion >= r.apiVersion ||
+		                 (r.extensionName && isExtensionSupported(r.extensionName));
+		for(uint32_t f=r.firstFormat; f<=r.lastFormat; f++) {
+			FormatMatrixRecord& record = m.recordList.emplace_back(FormatMatrixRecord{});
+			record.format = vk::Format(f);
+			queryList.push_back(supported ? vk::Format(f) : vk::Format::eUndefined);
+		}
+	}
+
+	// worker pool;
+	// each worker takes the next unprocessed format until all are done
+	// (physical device queries do not require external synchronization)
+	atomic<size_t> nextIndex = 0;
+	atomic<size_t> numQueries = 0;
+	auto worker =
+		[&]() {
+			size_t n = 0;
+			for(size_t i=nextIndex++; i<queryList.size(); i=nextIndex++) {
+				if(queryList[i] == vk::Format::eUndefined)
+					continue;
+				FormatMatrixRecord& record = m.recordList[i];
+				record.formatProperties = vk::getPhysicalDeviceFormatProperties(pd, record.format);
+				n++;
+
+				// image limits for the combination of all usages supported by the tiling
+				// (one query per tiling and image type; limits of the individual usages may be higher
+				// and the limits are zero when the device does not support the combination)
+				for(size_t t=0; t<tilingList.size(); t++) {
+					vk::ImageUsageFlags usage = usageFromFeatures(
+						(t == 0) ? record.formatProperties.optimalTilingFeatures
+						         : record.formatProperties.linearTilingFeatures);
+					if(!usage)
+						continue;
+					for(size_t j=0; j<imageTypeList.size(); j++) {
+						vk::Result r =
+							vk::getPhysicalDeviceImageFormatProperties_noThrow(
+								pd, record.format, imageTypeList[j], tilingList[t], usage, {}, record.imageLimits[t][j]);
+						if(r != vk::Result::eSuccess)
+							record.imageLimits[t][j] = {};
+						n++;
+					}
+				}
+			}
+			numQueries += n;
+		};
+	chrono::time_point startTime = chrono::high_resolution_clock::now();
+	vector<thread> threadList;
+	threadList.reserve(numThreads - 1);
+	for(unsigned i=1; i<numThreads; i++)
+		threadList.emplace_back(worker);
+	worker();
+	for(thread& t : threadList)
+		t.join();
+	m.queryTime = chrono::duration<float>(chrono::high_resolution_clock::now() - startTime).count();
+	m.numQueries = numQueries;
+
+	return m;
+}
+
+
+void saveFormatMatrix(const string& fileName, const FormatMatrix& m, const vk::PhysicalDeviceProperties& properties)
+{
+	// binary file
+	{
+		ofstream f(fileName + ".bin", ios::out | ios::binary | ios::trunc);
+		if(!f)
+			throw runtime_error("Cannot create file " + fileName + ".bin.");
+
+		// header
+		FormatMatrixHeader h;
+		memset(&h, 0, sizeof(h));
+		memcpy(h.magic, formatMatrixMagic, sizeof(h.magic));
+		h.version = formatMatrixVersion;
+		h.numRanges = uint32_t(formatRangeList.size());
+		h.numRecords = uint32_t(m.recordList.size());
+		h.recordSize = sizeof(FormatMatrixRecord);
+		h.vendorID = properties.vendorID;
+		h.deviceID = properties.deviceID;
+		h.driverVersion = properties.driverVersion;
+		h.apiVersion = properties.apiVersion;
+		memcpy(h.deviceName, properties.deviceName, sizeof(h.deviceName));  // null terminated by Vulkan spec
+		f.write(reinterpret_cast<const char*>(&h), sizeof(h));
+
+		// ranges
+		uint32_t firstRecord = 0;
+		for(const FormatRange& r : formatRangeList) {
+			FormatMatrixRange range{
+				.firstFormat = r.firstFormat,
+				.numFormats = r.lastFormat - r.firstFormat + 1,
+				.firstRecord = firstRecord,
+			};
+			f.write(reinterpret_cast<const char*>(&range), sizeof(range));
+			firstRecord += range.numFormats;
+		}
+
+		// records
+		f.write(reinterpret_cast<const char*>(m.recordList.data()), m.recordList.size() * sizeof(FormatMatrixRecord));
+		if(!f)
+			throw runtime_error("Failed to write file " + fileName + ".bin.");
+	}
+
+	// CSV file
+	{
+		ofstream f(fileName + ".csv", ios::out | ios::trunc);
+		if(!f)
+			throw runtime_error("Cannot create file " + fileName + ".csv.");
+
+		// header;
+		// image limits are for the combined usage given in the usage column of the tiling
+		f << "format,linearTilingFeatures,optimalTilingFeatures,bufferFeatures";
+		constexpr const array<const char*, 2> tilingNames = { "optimal", "linear" };
+		constexpr const array<const char*, 3> imageTypeNames = { "1D", "2D", "3D" };
+		for(const char* t : tilingNames) {
+			f << ',' << t << "CombinedUsage";
+			for(const char* i : imageTypeNames)
+				f << ',' << t << i << "MaxExtent," << t << i << "MaxMipLevels,"
+				  << t << i << "MaxArrayLayers," << t << i << "SampleCounts,"
+				  << t << i << "MaxResourceSize";
+		}
+		f << '\n';
+
+		// records
+		for(const FormatMatrixRecord& r : m.recordList) {
+			f << uint32_t(r.format) << hex
+			  << ",0x" << uint32_t(r.formatProperties.linearTilingFeatures)
+			  << ",0x" << uint32_t(r.formatProperties.optimalTilingFeatures)
+			  << ",0x" << uint32_t(r.formatProperties.bufferFeatures) << dec;
+			for(size_t t=0; t<tilingList.size(); t++) {
+				vk::ImageUsageFlags usage = usageFromFeatures(
+					(t == 0) ? r.formatProperties.optimalTilingFeatures
+					         : r.formatProperties.linearTilingFeatures);
+				f << ",0x" << hex << uint32_t(usage) << dec;
+				for(const vk::ImageFormatProperties& l : r.imageLimits[t])
+					f << ',' << l.maxExtent.width << 'x' << l.maxExtent.height << 'x' << l.maxExtent.depth
+					  << ',' << l.maxMipLevels << ',' << l.maxArrayLayers
+					  << ",0x" << hex << uint32_t(l.sampleCounts) << dec
+					  << ',' << l.maxResourceSize;
+			}
+			f << '\n';
+		}
+		if(!f)
+			throw runtime_error("Failed to write file " + fileName + ".csv.");
+	}
+}
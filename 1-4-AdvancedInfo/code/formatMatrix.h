@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+#include "vkg.h"
+
+
+// Format capability matrix of a physical device.
+//
+// It contains vk::FormatProperties of every format known to vkg.h
+// and vk::ImageFormatProperties limits for optimal and linear tiling
+// and for 1D, 2D and 3D images. The limits are queried once for the combination
+// of all image usages supported by the tiling, so they are the limits of the combined
+// usage, not of the individual usages. Formats of the extensions and Vulkan versions
+// not supported by the device are kept in the matrix with zero values,
+// so the record index of each format is the same on all devices.
+struct FormatMatrixRecord {
+	vk::Format format;
+	vk::FormatProperties formatProperties;
+	std::array<std::array<vk::ImageFormatProperties, 3>, 2> imageLimits;  // [tiling][imageType]; tiling 0 is optimal, 1 is linear
+};
+
+struct FormatMatrix {
+	std::vector<FormatMatrixRecord> recordList;
+	size_t numQueries;  // number of Vulkan queries made to build the matrix
+	float queryTime;  // time in seconds to build the matrix
+};
+
+
+// Query the matrix on the pool of numThreads worker threads.
+FormatMatrix queryFormatMatrix(vk::PhysicalDevice pd, const vk::PhysicalDeviceProperties& properties,
+	const std::vector<vk::ExtensionProperties>& extensionList, unsigned numThreads);
+
+// Write the matrix as binary table (fileName.bin) and as CSV (fileName.csv).
+//
+// Binary file starts by header and device identification, followed by
+// the list of format ranges and by the records. Format range maps
+// a continuous range of vk::Format values to the index of its first record,
+// so the record of any format is found without search.
+void saveFormatMatrix(const std::string& fileName, const FormatMatrix& matrix,
+	const vk::PhysicalDeviceProperties& properties);
@@ -1,10 +1,23 @@
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <string>
 #include <string.h>
+#include <thread>
+#include <vector>
 #include "vkg.h"
+#include "capabilitySnapshot.h"
+#include "formatMatrix.h"
 
 using namespace std;
 
 
+// constants
+constexpr const char* appName = "1-4-AdvancedInfo";
+constexpr const char* defaultSnapshotFileName = "1-4-AdvancedInfo.capabilities";
+constexpr const unsigned numStartupBenchmarkRuns = 20;
+
+
 int main(int argc, char* argv[])
 {
 	// catch exceptions
@@ -12,7 +25,73 @@ int main(int argc, char* argv[])
 	try {
 
 		// process cmd-line arguments
-		bool noExtensionList = (argc == 2) && (strcmp(argv[1], "--no-extension-list") == 0);
+		bool printHelp = false;
+		bool noExtensionList = false;
+		bool startupBenchmark = false;
+		string snapshotFileName;
+		string formatMatrixFileName;
+		for(int i=1; i<argc; i++) {
+
+			// do not print extensions
+			if(strcmp(argv[i], "--no-extension-list") == 0) {
+				noExtensionList = true;
+				continue;
+			}
+
+			// capability snapshot
+			if(strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--snapshot") == 0) {
+				if(i+1 >= argc) {
+					printHelp = true;
+					continue;
+				}
+				i++;
+				snapshotFileName = argv[i];
+				continue;
+			}
+
+			// format capability matrix
+			if(strcmp(argv[i], "-f") == 0 || strcmp(argv[i], "--format-matrix") == 0) {
+				if(i+1 >= argc) {
+					printHelp = true;
+					continue;
+				}
+				i++;
+				formatMatrixFileName = argv[i];
+				continue;
+			}
+
+			// cold versus warm startup benchmark
+			if(strcmp(argv[i], "-b") == 0 || strcmp(argv[i], "--startup-benchmark") == 0) {
+				startupBenchmark = true;
+				continue;
+			}
+
+			printHelp = true;
+		}
+
+		// print help
+		if(printHelp) {
+			cout << appName << " prints advanced information about Vulkan devices\n"
+			        "\n"
+			        "Usage: " << appName << " [--no-extension-list] [-s <file>] [-b] [-f <name>]\n"
+			        "   --no-extension-list - do not print instance and device extensions\n"
+			        "   -s <file> or --snapshot <file> - use capability snapshot file;\n"
+			        "      device capabilities are loaded from the memory-mapped file\n"
+			        "      instead of querying each device; devices whose driver\n"
+			        "      changed are queried again and the file is updated;\n"
+			        "      the whole file is invalidated by Vulkan loader update\n"
+			        "   -b or --startup-benchmark - measure the time of the capability\n"
+			        "      queries of all devices (cold start) against the time of loading\n"
+			        "      them from the snapshot (warm start); if no snapshot file is\n"
+			        "      given, " << defaultSnapshotFileName << " is used\n"
+			        "   -f <name> or --format-matrix <name> - query properties of all\n"
+			        "      formats, including image limits for optimal and linear tiling\n"
+			        "      and 1D, 2D and 3D images, and write them for each device\n"
+			        "      into <name>-<deviceNumber>.bin and <name>-<deviceNumber>.csv\n" << endl;
+			return 99;
+		}
+		if(startupBenchmark && snapshotFileName.empty())
+			snapshotFileName = defaultSnapshotFileName;
 
 		// load Vulkan library
 		vk::loadLib();
@@ -41,7 +120,7 @@ int main(int argc, char* argv[])
 				.flags = {},
 				.pApplicationInfo =
 					&(const vk::ApplicationInfo&)vk::ApplicationInfo{
-						.pApplicationName = "1-4-AdvancedInfo",
+						.pApplicationName = appName,
 						.applicationVersion = 0,
 						.pEngineName = nullptr,
 						.engineVersion = 0,
@@ -54,44 +133,56 @@ int main(int argc, char* argv[])
 			}
 		);
 
-		// print device list
-		cout << "Vulkan devices:\n";
+		// get device capabilities,
+		// either from the snapshot or by querying the devices
 		vk::vector<vk::PhysicalDevice> deviceList = vk::enumeratePhysicalDevices();
-		for(vk::PhysicalDevice pd : deviceList) {
-
-			// get device properties
-			vk::PhysicalDeviceProperties2 properties2;
-			vk::PhysicalDeviceProperties& properties = properties2.properties;
-			properties = vk::getPhysicalDeviceProperties(pd);
-
-			// supported extensions
-			vk::vector<vk::ExtensionProperties> extensionList =
-				vk::enumerateDeviceExtensionProperties(pd, nullptr);
-			bool videoQueueSupported = vk::isExtensionSupported(extensionList, "VK_KHR_video_queue") &&
-			                           instanceVersion >= vk::ApiVersion11;
-			bool raytracingSupported = vk::isExtensionSupported(extensionList, "VK_KHR_acceleration_structure") &&
-			                           vk::isExtensionSupported(extensionList, "VK_KHR_ray_tracing_pipeline") &&
-			                           vk::isExtensionSupported(extensionList, "VK_KHR_ray_query") &&
-			                           instanceVersion >= vk::ApiVersion11;
-			bool pciBusInfoSupported = vk::isExtensionSupported(extensionList, "VK_EXT_pci_bus_info") &&
-			                           instanceVersion >= vk::ApiVersion11;
-
-			// extended device properties
-			vk::PhysicalDevicePCIBusInfoPropertiesEXT pciBusInfo;  // requires VK_EXT_pci_bus_info
-			vk::PhysicalDeviceVulkan12Properties properties12;  // requires Vulkan 1.2
-			vk::PhysicalDeviceVulkan11Properties properties11;  // requires Vulkan 1.2 (really 1.2, not 1.1)
-			if(properties.apiVersion >= vk::ApiVersion11) {
-				void** lastPNext = &properties2.pNext;
-				if(properties.apiVersion >= vk::ApiVersion12) {
-					properties2.pNext = &properties11;
-					properties11.pNext = &properties12;
-					lastPNext = &properties12.pNext;
+		vector<DeviceCapabilities> capabilitiesList;
+		capabilitiesList.reserve(deviceList.size());
+		if(snapshotFileName.empty())
+			for(vk::PhysicalDevice pd : deviceList)
+				capabilitiesList.emplace_back(queryDeviceCapabilities(pd, instanceVersion));
+		else {
+			size_t numQueriedDevices = 0;
+			bool snapshotValid;
+			bool snapshotStale;
+			{
+				CapabilitySnapshot snapshot;
+				snapshotValid = snapshot.open(snapshotFileName, instanceVersion);
+				for(vk::PhysicalDevice pd : deviceList) {
+					DeviceCapabilities& c = capabilitiesList.emplace_back();
+					if(!snapshot.find(getDeviceKey(pd), c)) {
+						c = queryDeviceCapabilities(pd, instanceVersion);
+						numQueriedDevices++;
+					}
 				}
-				if(pciBusInfoSupported)
-					*lastPNext = &pciBusInfo;
-				vk::getPhysicalDeviceProperties2(pd, properties2);
+				snapshotStale = numQueriedDevices != 0 || snapshot.numDevices() != deviceList.size();
 			}
 
+			// update the snapshot
+			// (it is not mapped any more, so it can be replaced)
+			if(snapshotStale)
+				CapabilitySnapshot::save(snapshotFileName, instanceVersion, capabilitiesList);
+
+			cout << "Capability snapshot:\n"
+			        "   File:     " << snapshotFileName << "\n"
+			        "   Status:   ";
+			if(!snapshotValid)
+				cout << "created (no valid snapshot for this Vulkan loader)" << endl;
+			else if(snapshotStale)
+				cout << "updated (" << numQueriedDevices << " of " << deviceList.size() << " devices queried)" << endl;
+			else
+				cout << "used for all " << deviceList.size() << " devices" << endl;
+		}
+
+		// print device list
+		cout << "Vulkan devices:\n";
+		for(const DeviceCapabilities& c : capabilitiesList) {
+
+			const vk::PhysicalDeviceProperties& properties = c.properties;
+			const vk::PhysicalDeviceVulkan11Properties& properties11 = c.properties11;
+			const vk::PhysicalDeviceVulkan12Properties& properties12 = c.properties12;
+			const vk::PhysicalDeviceFeatures& features = c.features;
+
 			// device name
 			cout << "   " << properties.deviceName << endl;
 
@@ -118,8 +209,8 @@ int main(int argc, char* argv[])
 			cout << "      Device UUID:     ";
 			if(properties.apiVersion >= vk::ApiVersion12) {
 				auto printBytes =
-					[](uint8_t* a, uint8_t count) {
-						for(uint8_t* e=a+count; a<e; a++)
+					[](const uint8_t* a, uint8_t count) {
+						for(const uint8_t* e=a+count; a<e; a++)
 							cout << (*a >> 4) << (*a & 0x0f);
 					};
 				cout << hex;
@@ -148,26 +239,15 @@ int main(int argc, char* argv[])
 
 			// PCI bus info
 			cout << "      PCI bus info:" << endl;
-			if(pciBusInfoSupported)
-				cout << "         domain: " << pciBusInfo.pciDomain << ", bus: " << pciBusInfo.pciBus
-				     << ", device: " << pciBusInfo.pciDevice << ", function: " << pciBusInfo.pciFunction << endl;
+			if(c.pciBusInfoSupported)
+				cout << "         domain: " << c.pciBusInfo.pciDomain << ", bus: " << c.pciBusInfo.pciBus
+				     << ", device: " << c.pciBusInfo.pciDevice << ", function: " << c.pciBusInfo.pciFunction << endl;
 			else
 				cout << "         not available" << endl;
 
 			// device limits
 			cout << "      MaxTextureSize:  " << properties.limits.maxImageDimension2D << endl;
 
-			// device features
-			vk::PhysicalDeviceVulkan12Features features12;
-			vk::PhysicalDeviceFeatures2 features2{
-				.pNext = (properties.apiVersion>=vk::ApiVersion12) ? &features12 : nullptr,
-			};
-			vk::PhysicalDeviceFeatures& features = features2.features;
-			if(properties.apiVersion >= vk::ApiVersion11)
-				vk::getPhysicalDeviceFeatures2(pd, features2);
-			else
-				features = vk::getPhysicalDeviceFeatures(pd);
-
 			// geometry shader support
 			cout << "      Geometry shader:     ";
 			if(features.geometryShader)
@@ -182,30 +262,29 @@ int main(int argc, char* argv[])
 			else
 				cout << "not supported" << endl;
 			cout << "      Half precision:      ";
-			if(properties.apiVersion >= vk::ApiVersion12 && features12.shaderFloat16)
+			if(properties.apiVersion >= vk::ApiVersion12 && c.features12.shaderFloat16)
 				cout << "supported" << endl;
 			else
 				cout << "not supported" << endl;
 
 			// video queue support
 			cout << "      Vulkan Video:        ";
-			if(videoQueueSupported)
+			if(c.videoQueueSupported)
 				cout << "supported" << endl;
 			else
 				cout << "not supported" << endl;
 
 			// video queue support
 			cout << "      Vulkan Ray Tracing:  ";
-			if(raytracingSupported)
+			if(c.raytracingSupported)
 				cout << "supported" << endl;
 			else
 				cout << "not supported" << endl;
 
 			// memory properties
 			cout << "      Memory heaps:" << endl;
-			vk::PhysicalDeviceMemoryProperties memoryProperties = vk::getPhysicalDeviceMemoryProperties(pd);
-			for(uint32_t i=0, c=memoryProperties.memoryHeapCount; i<c; i++) {
-				vk::MemoryHeap& h = memoryProperties.memoryHeaps[i];
+			for(uint32_t i=0, n=c.memoryProperties.memoryHeapCount; i<n; i++) {
+				const vk::MemoryHeap& h = c.memoryProperties.memoryHeaps[i];
 				cout << "         " << i << ": " << h.size/1024/1024 << "MiB";
 				if(h.flags & vk::MemoryHeapFlagBits::eDeviceLocal)  cout << "  (device local)";
 				cout << endl;
@@ -213,20 +292,9 @@ int main(int argc, char* argv[])
 
 			// queue family properties
 			cout << "      Queue families:" << endl;
-			vk::vector<vk::QueueFamilyProperties2> queueFamilyList;
-			vk::vector<vk::QueueFamilyVideoPropertiesKHR> queueVideoPropertiesList;
-			if(properties.apiVersion >= vk::ApiVersion11)
-				queueFamilyList = vk::getPhysicalDeviceQueueFamilyProperties2(
-					pd, queueVideoPropertiesList, videoQueueSupported);
-			else {
-				vk::vector<vk::QueueFamilyProperties> v = vk::getPhysicalDeviceQueueFamilyProperties(pd);
-				queueFamilyList.resize(v.size());
-				for(size_t i=0; i<v.size(); i++)
-					queueFamilyList[i].queueFamilyProperties = v[i];
-			}
-			for(uint32_t i=0, c=uint32_t(queueFamilyList.size()); i<c; i++) {
+			for(uint32_t i=0, n=uint32_t(c.queueFamilyList.size()); i<n; i++) {
 				cout << "         " << i << ": ";
-				vk::QueueFamilyProperties& queueFamilyProperties = queueFamilyList[i].queueFamilyProperties;
+				const vk::QueueFamilyProperties& queueFamilyProperties = c.queueFamilyList[i];
 				if(queueFamilyProperties.queueFlags & vk::QueueFlagBits::eGraphics)
 					cout << "g";
 				if(queueFamilyProperties.queueFlags & vk::QueueFlagBits::eCompute)
@@ -238,12 +306,12 @@ int main(int argc, char* argv[])
 				if(queueFamilyProperties.queueFlags & (vk::QueueFlagBits::eVideoDecodeKHR | vk::QueueFlagBits::eVideoEncodeKHR))
 					cout << "v";
 				cout << "  (count: " << queueFamilyProperties.queueCount;
-				if(videoQueueSupported) {
-					if(queueVideoPropertiesList[i].videoCodecOperations & vk::VideoCodecOperationFlagBitsKHR::eDecodeH264)
+				if(c.videoQueueSupported) {
+					if(c.videoCodecOperationsList[i] & vk::VideoCodecOperationFlagBitsKHR::eDecodeH264)
 						cout << ", decode H264";
-					if(queueVideoPropertiesList[i].videoCodecOperations & vk::VideoCodecOperationFlagBitsKHR::eDecodeH265)
+					if(c.videoCodecOperationsList[i] & vk::VideoCodecOperationFlagBitsKHR::eDecodeH265)
 						cout << ", decode H265";
-					if(queueVideoPropertiesList[i].videoCodecOperations & vk::VideoCodecOperationFlagBitsKHR::eDecodeAV1)
+					if(c.videoCodecOperationsList[i] & vk::VideoCodecOperationFlagBitsKHR::eDecodeAV1)
 						cout << ", decode AV1";
 				}
 				cout << ")" << endl;
@@ -251,46 +319,99 @@ int main(int argc, char* argv[])
 
 			// format support for images with optimal tiling
 			cout << "      Format support for compressed textures:" << endl;
-			vk::FormatProperties formatProperties = vk::getPhysicalDeviceFormatProperties(pd, vk::Format::eBc7SrgbBlock);
-			if(formatProperties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)
+			// (formats are listed in snapshotFormatList; ASTC_4x4_SFLOAT properties are zero on devices older than Vulkan 1.3)
+			if(c.formatPropertiesList[0].optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)
 				cout << "         BC7  (BC7_SRGB):            yes" << endl;
 			else
 				cout << "         BC7  (BC7_SRGB):            no" << endl;
-			formatProperties = vk::getPhysicalDeviceFormatProperties(pd, vk::Format::eEtc2R8G8B8A8SrgbBlock);
-			if(formatProperties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)
+			if(c.formatPropertiesList[1].optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)
 				cout << "         ETC2 (ETC2_R8G8B8A8_SRGB):  yes" << endl;
 			else
 				cout << "         ETC2 (ETC2_R8G8B8A8_SRGB):  no" << endl;
-			formatProperties = vk::getPhysicalDeviceFormatProperties(pd, vk::Format::eAstc4x4SrgbBlock);
-			if(formatProperties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)
+			if(c.formatPropertiesList[2].optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)
 				cout << "         ASTC (ASTC_4x4_SRGB):       yes" << endl;
 			else
 				cout << "         ASTC (ASTC_4x4_SRGB):       no" << endl;
-			if(properties.apiVersion >= vk::ApiVersion13) {
-				formatProperties = vk::getPhysicalDeviceFormatProperties(pd, vk::Format::eAstc4x4SfloatBlock);
-				if(formatProperties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)
-					cout << "         ASTC (ASTC_4x4_SFLOAT):     yes" << endl;
-				else
-					cout << "         ASTC (ASTC_4x4_SFLOAT):     no" << endl;
-			} else
+			if(c.formatPropertiesList[3].optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear)
+				cout << "         ASTC (ASTC_4x4_SFLOAT):     yes" << endl;
+			else
 				cout << "         ASTC (ASTC_4x4_SFLOAT):     no" << endl;
 
 			// print extensions
-			cout << "      Extensions (" << extensionList.size() << " in total):\n";
+			cout << "      Extensions (" << c.extensionList.size() << " in total):\n";
 			if(noExtensionList)
 				cout << "         < list omitted because of --no-extension-list given on command line >" << endl;
 			else
-				if(extensionList.empty())
+				if(c.extensionList.empty())
 					cout << "         < none >";
 				else {
-					cout << extensionList[0].extensionName;
-					for(size_t i=1,c=extensionList.size(); i<c; i++)
-						cout << ", " << extensionList[i].extensionName;
+					cout << c.extensionList[0].extensionName;
+					for(size_t i=1,n=c.extensionList.size(); i<n; i++)
+						cout << ", " << c.extensionList[i].extensionName;
 				}
 				cout << endl;
 
 		}
 
+		// format capability matrix
+		if(!formatMatrixFileName.empty()) {
+			unsigned numThreads = max(thread::hardware_concurrency(), 1u);
+			cout << "Format capability matrix (using " << numThreads << " threads):" << endl;
+			for(size_t i=0; i<deviceList.size(); i++) {
+				const DeviceCapabilities& c = capabilitiesList[i];
+				FormatMatrix m = queryFormatMatrix(deviceList[i], c.properties, c.extensionList, numThreads);
+				string fileName = formatMatrixFileName + "-" + to_string(i+1);
+				saveFormatMatrix(fileName, m, c.properties);
+				cout << "   " << c.properties.deviceName << ": " << m.recordList.size() << " formats, "
+				     << m.numQueries << " queries in " << m.queryTime * 1e3 << "ms\n"
+				        "      written to " << fileName << ".bin and " << fileName << ".csv" << endl;
+			}
+		}
+
+		// cold versus warm startup benchmark
+		if(startupBenchmark) {
+
+			cout << "Startup benchmark (" << numStartupBenchmarkRuns << " runs, " << deviceList.size() << " devices):" << endl;
+			vector<float> coldTimes;
+			vector<float> warmTimes;
+			vector<DeviceCapabilities> l;
+			l.reserve(deviceList.size());
+			for(unsigned run=0; run<numStartupBenchmarkRuns; run++) {
+
+				// cold start: query all the capabilities of all the devices
+				l.clear();
+				chrono::time_point t1 = chrono::high_resolution_clock::now();
+				for(vk::PhysicalDevice pd : deviceList)
+					l.emplace_back(queryDeviceCapabilities(pd, instanceVersion));
+				chrono::time_point t2 = chrono::high_resolution_clock::now();
+				coldTimes.push_back(chrono::duration<float>(t2 - t1).count());
+
+				// warm start: map the snapshot, get device keys and copy the records
+				l.clear();
+				t1 = chrono::high_resolution_clock::now();
+				{
+					CapabilitySnapshot snapshot;
+					snapshot.open(snapshotFileName, instanceVersion);
+					for(vk::PhysicalDevice pd : deviceList) {
+						DeviceCapabilities& c = l.emplace_back();
+						if(!snapshot.find(getDeviceKey(pd), c))
+							c = queryDeviceCapabilities(pd, instanceVersion);
+					}
+				}
+				t2 = chrono::high_resolution_clock::now();
+				warmTimes.push_back(chrono::duration<float>(t2 - t1).count());
+			}
+
+			// print medians
+			sort(coldTimes.begin(), coldTimes.end());
+			sort(warmTimes.begin(), warmTimes.end());
+			float coldTime = coldTimes[coldTimes.size()/2];
+			float warmTime = warmTimes[warmTimes.size()/2];
+			cout << "   Cold start (live queries):  " << coldTime * 1e3 << "ms  (min: " << coldTimes.front() * 1e3 << "ms)\n"
+			        "   Warm start (snapshot):      " << warmTime * 1e3 << "ms  (min: " << warmTimes.front() * 1e3 << "ms)\n"
+			        "   Speedup:                    " << coldTime / warmTime << "x" << endl;
+		}
+
 	// catch exceptions
 	} catch(vk::Error& e) {
 		cout << e.what() << endl;
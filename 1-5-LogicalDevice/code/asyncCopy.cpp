@@ -0,0 +1,360 @@
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include "asyncCopy.h"
+
+using namespace std;
+
+
+AsyncCopy::AsyncCopy(const AllocatedQueue& copyQueue, const AllocatedQueue* consumerQueue, bool useCopyBuffer2,
+                     unsigned numSlots)
+	: _copyQueue(copyQueue)
+	, _consumerQueue(consumerQueue ? *consumerQueue : copyQueue)
+	, _hasConsumer(consumerQueue != nullptr)
+	, _ownershipTransfer(consumerQueue != nullptr && consumerQueue->family != copyQueue.family)
+{
+	// vkCmdCopyBuffer2 is core since Vulkan 1.3
+	// (it returns nullptr on older devices)
+	if(useCopyBuffer2)
+		_cmdCopyBuffer2 = vk::getDeviceProcAddr<PFN_vkCmdCopyBuffer2>("vkCmdCopyBuffer2");
+
+	// command pools
+	// (command buffers are re-recorded for each copy)
+	_copyCommandPool =
+		vk::createCommandPoolUnique(
+			vk::CommandPoolCreateInfo{
+				.flags = vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+				.queueFamilyIndex = _copyQueue.family,
+			}
+		);
+	if(_ownershipTransfer)
+		_acquireCommandPool =
+			vk::createCommandPoolUnique(
+				vk::CommandPoolCreateInfo{
+					.flags = vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+					.queueFamilyIndex = _consumerQueue.family,
+				}
+			);
+
+	// slots
+	_slotList.resize(max(numSlots, 1u));
+	for(Slot& slot : _slotList) {
+		slot.copyCommandBuffer =
+			vk::allocateCommandBuffer(
+				vk::CommandBufferAllocateInfo{
+					.commandPool = _copyCommandPool,
+					.level = vk::CommandBufferLevel::ePrimary,
+					.commandBufferCount = 1,
+				}
+			);
+		if(_ownershipTransfer)
+			slot.acquireCommandBuffer =
+				vk::allocateCommandBuffer(
+					vk::CommandBufferAllocateInfo{
+						.commandPool = _acquireCommandPool,
+						.level = vk::CommandBufferLevel::ePrimary,
+						.commandBufferCount = 1,
+					}
+				);
+		slot.semaphore =
+			vk::createSemaphoreUnique(
+				vk::SemaphoreCreateInfo{
+					.flags = {},
+				}
+			);
+		slot.fence =
+			vk::createFenceUnique(
+				vk::FenceCreateInfo{
+					.flags = {}
+				}
+			);
+		slot.copyFence =
+			vk::createFenceUnique(
+				vk::FenceCreateInfo{
+					.flags = {}
+				}
+			);
+		slot.busy = false;
+		slot.copyBusy = false;
+	}
+}
+
+
+AsyncCopy::~AsyncCopy()
+{
+	// wait for copies in flight
+	// (the handles must not be destroyed while in use)
+	for(Slot& slot : _slotList) {
+		if(slot.busy)
+			vk::waitForFence_noThrow(slot.fence, uint64_t(3e9));
+		if(slot.copyBusy)
+			vk::waitForFence_noThrow(slot.copyFence, uint64_t(3e9));
+	}
+}
+
+
+void AsyncCopy::waitForSlot(Slot& slot)
+{
+	array<vk::Fence, 2> fenceList = { slot.fence, slot.copyFence };
+	vk::Result r =
+		vk::waitForFences_noThrow(
+			slot.copyBusy ? 2 : 1,  // fenceCount
+			fenceList.data(),  // pFences
+			vk::True,  // waitAll
+			uint64_t(3e9)  // timeout (3 seconds)
+		);
+	if(r == vk::Result::eTimeout) {
+		cout << "Vulkan device timeout. Task is probably hanging." << endl;
+		// use std::quick_exit() to terminate the application
+		// (Do not throw, do not return, do not call std::exit().
+		// The device is still busy and it uses number of handles such as
+		// fences and device handle itself.
+		// Destruction of the handles in use or the unallowed access to them
+		// is forbidden by Vulkan specification.
+		quick_exit(-1);
+	} else
+		vk::checkForSuccessValue(r, "vkWaitForFences");
+	vk::resetFence(slot.fence);
+	if(slot.copyBusy)
+		vk::resetFence(slot.copyFence);
+	slot.busy = false;
+	slot.copyBusy = false;
+}
+
+
+void AsyncCopy::copy(vk::Buffer srcBuffer, vk::Buffer dstBuffer, vk::DeviceSize size)
+{
+	// take the next slot
+	Slot& slot = _slotList[_nextSlot];
+	_nextSlot = (_nextSlot + 1) % _slotList.size();
+	if(slot.busy)
+		waitForSlot(slot);
+
+	// record copy
+	vk::beginCommandBuffer(
+		slot.copyCommandBuffer,
+		vk::CommandBufferBeginInfo{
+			.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+			.pInheritanceInfo = nullptr,
+		}
+	);
+
+	// order the copy after the previous copies on the copy queue
+	// (back-to-back copies into the same buffer are write-after-write hazard)
+	vk::cmdPipelineBarrier(
+		slot.copyCommandBuffer,
+		vk::PipelineStageFlagBits::eTransfer,  // srcStageMask
+		vk::PipelineStageFlagBits::eTransfer,  // dstStageMask
+		vk::DependencyFlags(),  // dependencyFlags
+		1, &(const vk::MemoryBarrier&)vk::MemoryBarrier{  // memoryBarrierCount, pMemoryBarriers
+			.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+			.dstAccessMask = vk::AccessFlagBits::eTransferWrite,
+		},
+		0, nullptr,  // bufferMemoryBarrierCount, pBufferMemoryBarriers
+		0, nullptr  // imageMemoryBarrierCount, pImageMemoryBarriers
+	);
+
+	if(_cmdCopyBuffer2) {
+		vk::BufferCopy2 region{
+			.srcOffset = 0,
+			.dstOffset = 0,
+			.size = size,
+		};
+		vk::CopyBufferInfo2 copyInfo{
+			.srcBuffer = srcBuffer,
+			.dstBuffer = dstBuffer,
+			.regionCount = 1,
+			.pRegions = &region,
+		};
+		_cmdCopyBuffer2(slot.copyCommandBuffer.handle(), &copyInfo);
+	}
+	else
+		vk::cmdCopyBuffer(
+			slot.copyCommandBuffer,
+			srcBuffer,
+			dstBuffer,
+			1,
+			&(const vk::BufferCopy&)vk::BufferCopy{
+				.srcOffset = 0,
+				.dstOffset = 0,
+				.size = size,
+			}
+		);
+
+	// hand the data to the consumer
+	bool separateConsumerQueue = _hasConsumer && _consumerQueue.queue != _copyQueue.queue;
+	if(_ownershipTransfer) {
+
+		// release ownership on the copy queue
+		vk::cmdPipelineBarrier(
+			slot.copyCommandBuffer,
+			vk::PipelineStageFlagBits::eTransfer,  // srcStageMask
+			vk::PipelineStageFlagBits::eBottomOfPipe,  // dstStageMask
+			vk::DependencyFlags(),  // dependencyFlags
+			0, nullptr,  // memoryBarrierCount, pMemoryBarriers
+			1, &(const vk::BufferMemoryBarrier&)vk::BufferMemoryBarrier{  // bufferMemoryBarrierCount, pBufferMemoryBarriers
+				.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+				.dstAccessMask = {},
+				.srcQueueFamilyIndex = _copyQueue.family,
+				.dstQueueFamilyIndex = _consumerQueue.family,
+				.buffer = dstBuffer,
+				.offset = 0,
+				.size = size,
+			},
+			0, nullptr  // imageMemoryBarrierCount, pImageMemoryBarriers
+		);
+
+		// acquire ownership on the consumer queue
+		vk::beginCommandBuffer(
+			slot.acquireCommandBuffer,
+			vk::CommandBufferBeginInfo{
+				.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+				.pInheritanceInfo = nullptr,
+			}
+		);
+		vk::cmdPipelineBarrier(
+			slot.acquireCommandBuffer,
+			vk::PipelineStageFlagBits::eTopOfPipe,  // srcStageMask
+			vk::PipelineStageFlagBits::eComputeShader,  // dstStageMask
+			vk::DependencyFlags(),  // dependencyFlags
+			0, nullptr,  // memoryBarrierCount, pMemoryBarriers
+			1, &(const vk::BufferMemoryBarrier&)vk::BufferMemoryBarrier{  // bufferMemoryBarrierCount, pBufferMemoryBarriers
+				.srcAccessMask = {},
+				.dstAccessMask = vk::AccessFlagBits::eShaderRead,
+				.srcQueueFamilyIndex = _copyQueue.family,
+				.dstQueueFamilyIndex = _consumerQueue.family,
+				.buffer = dstBuffer,
+				.offset = 0,
+				.size = size,
+			},
+			0, nullptr  // imageMemoryBarrierCount, pImageMemoryBarriers
+		);
+		vk::endCommandBuffer(slot.acquireCommandBuffer);
+
+	}
+	else if(_hasConsumer && !separateConsumerQueue)
+
+		// make the data visible to compute shaders on the same queue
+		vk::cmdPipelineBarrier(
+			slot.copyCommandBuffer,
+			vk::PipelineStageFlagBits::eTransfer,  // srcStageMask
+			vk::PipelineStageFlagBits::eComputeShader,  // dstStageMask
+			vk::DependencyFlags(),  // dependencyFlags
+			1, &(const vk::MemoryBarrier&)vk::MemoryBarrier{  // memoryBarrierCount, pMemoryBarriers
+				.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+				.dstAccessMask = vk::AccessFlagBits::eShaderRead,
+			},
+			0, nullptr,  // bufferMemoryBarrierCount, pBufferMemoryBarriers
+			0, nullptr  // imageMemoryBarrierCount, pImageMemoryBarriers
+		);
+
+	vk::endCommandBuffer(slot.copyCommandBuffer);
+
+	// submit
+	if(separateConsumerQueue) {
+
+		// copy queue signals semaphore, consumer queue waits for it
+		vk::Semaphore semaphore = slot.semaphore;
+		vk::queueSubmit(
+			_copyQueue.queue,
+			vk::SubmitInfo{
+				.waitSemaphoreCount = 0,
+				.pWaitSemaphores = nullptr,
+				.pWaitDstStageMask = nullptr,
+				.commandBufferCount = 1,
+				.pCommandBuffers = &slot.copyCommandBuffer,
+				.signalSemaphoreCount = 1,
+				.pSignalSemaphores = &semaphore,
+			},
+			slot.copyFence
+		);
+		slot.copyBusy = true;
+		vk::queueSubmit(
+			_consumerQueue.queue,
+			vk::SubmitInfo{
+				.waitSemaphoreCount = 1,
+				.pWaitSemaphores = &semaphore,
+				.pWaitDstStageMask = &(const vk::PipelineStageFlags&)vk::PipelineStageFlags(vk::PipelineStageFlagBits::eComputeShader),
+				.commandBufferCount = _ownershipTransfer ? 1u : 0u,
+				.pCommandBuffers = &slot.acquireCommandBuffer,
+				.signalSemaphoreCount = 0,
+				.pSignalSemaphores = nullptr,
+			},
+			slot.fence
+		);
+
+	}
+	else
+		vk::queueSubmit(
+			_copyQueue.queue,
+			vk::SubmitInfo{
+				.waitSemaphoreCount = 0,
+				.pWaitSemaphores = nullptr,
+				.pWaitDstStageMask = nullptr,
+				.commandBufferCount = 1,
+				.pCommandBuffers = &slot.copyCommandBuffer,
+				.signalSemaphoreCount = 0,
+				.pSignalSemaphores = nullptr,
+			},
+			slot.fence
+		);
+
+	slot.busy = true;
+}
+
+
+void AsyncCopy::flush()
+{
+	for(Slot& slot : _slotList)
+		if(slot.busy)
+			waitForSlot(slot);
+}
+
+
+bool AsyncCopy::poll()
+{
+	bool idle = pollCopyFences();
+	for(Slot& slot : _slotList) {
+		if(!slot.busy)
+			continue;
+		vk::Result r = vk::getFenceStatus_noThrow(slot.fence);
+		if(r == vk::Result::eSuccess) {
+			vk::resetFence(slot.fence);
+			slot.busy = false;
+		}
+		else {
+			vk::checkSuccess(r, "vkGetFenceStatus");
+			idle = false;
+		}
+	}
+	return idle;
+}
+
+
+bool AsyncCopy::pollCopies()
+{
+	// without separate consumer queue, the copy finishes together with the slot
+	if(!_hasConsumer || _consumerQueue.queue == _copyQueue.queue)
+		return poll();
+	return pollCopyFences();
+}
+
+
+bool AsyncCopy::pollCopyFences()
+{
+	bool idle = true;
+	for(Slot& slot : _slotList) {
+		if(!slot.copyBusy)
+			continue;
+		vk::Result r = vk::getFenceStatus_noThrow(slot.copyFence);
+		if(r == vk::Result::eSuccess) {
+			vk::resetFence(slot.copyFence);
+			slot.copyBusy = false;
+		}
+		else {
+			vk::checkSuccess(r, "vkGetFenceStatus");
+			idle = false;
+		}
+	}
+	return idle;
+}
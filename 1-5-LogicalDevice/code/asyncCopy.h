@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+#include "queueAllocator.h"
+#include "vkg.h"
+
+
+// Asynchronous buffer copy path.
+//
+// Copies are recorded and submitted to the copy queue, usually the dedicated
+// transfer queue handed out by QueueAllocator. If the consumer queue is given,
+// the copied data are handed to it: if the consumer queue belongs to another
+// queue family, the destination buffer ownership is released on the copy queue
+// and acquired on the consumer queue (queue family ownership transfer);
+// the consumer side waits for the copy by a semaphore.
+//
+// copy() does not wait for the copy. It blocks only if all numSlots slots
+// are in flight. Then it waits for the oldest one. Copies are ordered
+// by a transfer barrier, so the copies into the same buffer do not race.
+// vkCmdCopyBuffer2 is used if useCopyBuffer2 is true and the function is available,
+// otherwise vkCmdCopyBuffer is used.
+class AsyncCopy {
+protected:
+	struct Slot {
+		vk::CommandBuffer copyCommandBuffer;
+		vk::CommandBuffer acquireCommandBuffer;
+		vk::UniqueSemaphore semaphore;
+		vk::UniqueFence fence;
+		vk::UniqueFence copyFence;  // copy queue part of the slot; used only if the consumer queue is separate
+		bool busy;
+		bool copyBusy;
+	};
+	AllocatedQueue _copyQueue;
+	AllocatedQueue _consumerQueue;
+	bool _hasConsumer;
+	bool _ownershipTransfer;
+	vk::UniqueCommandPool _copyCommandPool;
+	vk::UniqueCommandPool _acquireCommandPool;
+	std::vector<Slot> _slotList;
+	size_t _nextSlot = 0;
+	using PFN_vkCmdCopyBuffer2 = void (VKAPI_PTR *)(vk::CommandBuffer::HandleType commandBufferHandle, const vk::CopyBufferInfo2* pCopyBufferInfo);
+	PFN_vkCmdCopyBuffer2 _cmdCopyBuffer2 = nullptr;
+	void waitForSlot(Slot& slot);
+	bool pollCopyFences();
+public:
+
+	AsyncCopy(const AllocatedQueue& copyQueue, const AllocatedQueue* consumerQueue, bool useCopyBuffer2,
+	          unsigned numSlots = 4);
+	~AsyncCopy();
+
+	// copy size bytes from the beginning of srcBuffer to the beginning of dstBuffer
+	void copy(vk::Buffer srcBuffer, vk::Buffer dstBuffer, vk::DeviceSize size);
+
+	// wait for all copies
+	void flush();
+
+	// return true if all copies are finished, including their hand-over to the consumer; it does not wait
+	bool poll();
+
+	// return true if the copy queue finished all copies; it does not wait
+	// (the hand-over to the consumer queue might be still pending)
+	bool pollCopies();
+
+	bool ownershipTransfer() const  { return _ownershipTransfer; }
+	bool usesCopyBuffer2() const  { return _cmdCopyBuffer2 != nullptr; }
+
+};
@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "contentionBenchmark.h"
+
+using namespace std;
+
+// shader code as SPIR-V binary
+static const uint32_t contentionSpirv[] = {
+#include "contention.comp.spv"
+};
+
+// workload parameters
+static constexpr const uint32_t shortWorkgroupCount = 1;
+static constexpr const uint32_t shortNumLoops = 10;
+static constexpr const uint32_t batchWorkgroupCountX = 100;
+static constexpr const uint32_t batchWorkgroupCountY = 100;
+static constexpr const uint32_t batchMaxNumLoops = 65536;
+static constexpr const float batchMinDispatchTime = 0.02f;  // 20ms
+static constexpr const unsigned numBatchDispatches = 20;
+static constexpr const unsigned numIdleSamples = 20;
+static constexpr const unsigned maxLoadSamples = 100;
+
+
+static float median(vector<float>& v)
+{
+	if(v.empty())
+		return NAN;
+	sort(v.begin(), v.end());
+	return v[v.size() / 2];
+}
+
+
+static void submit(vk::Queue queue, vk::CommandBuffer commandBuffer, vk::Fence fence)
+{
+	vk::queueSubmit(
+		queue,
+		vk::SubmitInfo{
+			.waitSemaphoreCount = 0,
+			.pWaitSemaphores = nullptr,
+			.pWaitDstStageMask = nullptr,
+			.commandBufferCount = 1,
+			.pCommandBuffers = &commandBuffer,
+			.signalSemaphoreCount = 0,
+			.pSignalSemaphores = nullptr,
+		},
+		fence
+	);
+}
+
+
+static void wait(vk::Fence fence)
+{
+	vk::Result r =
+		vk::waitForFence_noThrow(
+			fence,
+			uint64_t(3e9)  // timeout (3 seconds)
+		);
+	if(r == vk::Result::eTimeout) {
+		cout << "Vulkan device timeout. Task is probably hanging." << endl;
+		// use std::quick_exit() to terminate the application
+		// (Do not throw, do not return, do not call std::exit().
+		// The device is still busy and it uses number of handles such as
+		// fences and device handle itself.
+		// Destruction of the handles in use or the unallowed access to them
+		// is forbidden by Vulkan specification.
+		quick_exit(-1);
+	} else
+		vk::checkForSuccessValue(r, "vkWaitForFences");
+	vk::resetFence(fence);
+}
+
+
+// submit the work and return the time until it is finished
+static float submitAndWait(vk::Queue queue, vk::CommandBuffer commandBuffer, vk::Fence fence)
+{
+	chrono::time_point t1 = chrono::high_resolution_clock::now();
+	submit(queue, commandBuffer, fence);
+	wait(fence);
+	chrono::time_point t2 = chrono::high_resolution_clock::now();
+	return chrono::duration<float>(t2 - t1).count();
+}
+
+
+ContentionResult runContentionBenchmark(const AllocatedQueue& latencyCriticalQueue, const AllocatedQueue& batchQueue,
+	const AllocatedQueue* otherBatchQueue)
+{
+	ContentionResult result{
+		.idleLatency = NAN,
+		.latencyCriticalLatency = NAN,
+		.batchLatency = NAN,
+		.batchDispatchTime = NAN,
+		.batchTime = NAN,
+		.numBatchDispatches = numBatchDispatches,
+	};
+
+	// shader module
+	vk::UniqueShaderModule shaderModule =
+		vk::createShaderModuleUnique(
+			vk::ShaderModuleCreateInfo{
+				.flags = {},
+				.codeSize = sizeof(contentionSpirv),
+				.pCode = contentionSpirv,
+			}
+		);
+
+	// pipeline layout
+	vk::UniquePipelineLayout pipelineLayout =
+		vk::createPipelineLayoutUnique(
+			vk::PipelineLayoutCreateInfo{
+				.flags = {},
+				.setLayoutCount = 0,
+				.pSetLayouts = nullptr,
+				.pushConstantRangeCount = 1,
+				.pPushConstantRanges =
+					&(const vk::PushConstantRange&)vk::PushConstantRange{
+						.stageFlags = vk::ShaderStageFlagBits::eCompute,
+						.offset = 0,
+						.size = sizeof(uint32_t),
+					},
+			}
+		);
+
+	// pipeline
+	vk::UniquePipeline pipeline =
+		vk::createComputePipelineUnique(
+			nullptr,
+			vk::ComputePipelineCreateInfo{
+				.flags = {},
+				.stage =
+					vk::PipelineShaderStageCreateInfo{
+						.flags = {},
+						.stage = vk::ShaderStageFlagBits::eCompute,
+						.module = shaderModule,
+						.pName = "main",
+						.pSpecializationInfo = nullptr,
+					},
+				.layout = pipelineLayout,
+				.basePipelineHandle = nullptr,
+				.basePipelineIndex = -1,
+			}
+		);
+
+	// command pool and command buffer for each queue
+	auto createCommandPool =
+		[](uint32_t queueFamily) {
+			return
+				vk::createCommandPoolUnique(
+					vk::CommandPoolCreateInfo{
+						.flags = {},
+						.queueFamilyIndex = queueFamily,
+					}
+				);
+		};
+	auto allocateCommandBuffer =
+		[](vk::CommandPool commandPool) {
+			return
+				vk::allocateCommandBuffer(
+					vk::CommandBufferAllocateInfo{
+						.commandPool = commandPool,
+						.level = vk::CommandBufferLevel::ePrimary,
+						.commandBufferCount = 1,
+					}
+				);
+		};
+	auto recordCommandBuffer =
+		[&](vk::CommandBuffer commandBuffer, uint32_t workgroupCountX, uint32_t workgroupCountY,
+		    uint32_t numLoops, unsigned numDispatches)
+		{
+			vk::beginCommandBuffer(
+				commandBuffer,
+				vk::CommandBufferBeginInfo{
+					.flags = {},
+					.pInheritanceInfo = nullptr,
+				}
+			);
+			vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+			vk::cmdPushConstants(commandBuffer, pipelineLayout, vk::ShaderStageFlagBits::eCompute,
+			                     0, sizeof(uint32_t), &numLoops);
+			for(unsigned i=0; i<numDispatches; i++)
+				vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, 1);
+			vk::endCommandBuffer(commandBuffer);
+		};
+	vk::UniqueCommandPool latencyCriticalCommandPool = createCommandPool(latencyCriticalQueue.family);
+	vk::UniqueCommandPool batchCommandPool = createCommandPool(batchQueue.family);
+	vk::UniqueCommandPool otherBatchCommandPool;
+	vk::CommandBuffer latencyCriticalCommandBuffer = allocateCommandBuffer(latencyCriticalCommandPool);
+	vk::CommandBuffer batchCommandBuffer = allocateCommandBuffer(batchCommandPool);
+	vk::CommandBuffer otherBatchCommandBuffer;
+	recordCommandBuffer(latencyCriticalCommandBuffer, shortWorkgroupCount, shortWorkgroupCount, shortNumLoops, 1);
+	if(otherBatchQueue) {
+		otherBatchCommandPool = createCommandPool(otherBatchQueue->family);
+		otherBatchCommandBuffer = allocateCommandBuffer(otherBatchCommandPool);
+		recordCommandBuffer(otherBatchCommandBuffer, shortWorkgroupCount, shortWorkgroupCount, shortNumLoops, 1);
+	}
+
+	// fences
+	vk::UniqueFence fence =
+		vk::createFenceUnique(
+			vk::FenceCreateInfo{
+				.flags = {}
+			}
+		);
+	vk::UniqueFence batchFence =
+		vk::createFenceUnique(
+			vk::FenceCreateInfo{
+				.flags = {}
+			}
+		);
+
+	// latency on idle device
+	// (the first submission is a warm-up)
+	vector<float> sampleList;
+	submitAndWait(latencyCriticalQueue.queue, latencyCriticalCommandBuffer, fence);
+	for(unsigned i=0; i<numIdleSamples; i++)
+		sampleList.push_back(submitAndWait(latencyCriticalQueue.queue, latencyCriticalCommandBuffer, fence));
+	result.idleLatency = median(sampleList);
+
+	// calibrate batch dispatch
+	// (number of loops is doubled until the dispatch takes at least batchMinDispatchTime)
+	uint32_t numLoops = 1;
+	while(true) {
+		vk::resetCommandPool(batchCommandPool, {});
+		recordCommandBuffer(batchCommandBuffer, batchWorkgroupCountX, batchWorkgroupCountY, numLoops, 1);
+		result.batchDispatchTime = submitAndWait(batchQueue.queue, batchCommandBuffer, batchFence);
+		if(result.batchDispatchTime >= batchMinDispatchTime || numLoops >= batchMaxNumLoops)
+			break;
+		numLoops *= 2;
+	}
+	vk::resetCommandPool(batchCommandPool, {});
+	recordCommandBuffer(batchCommandBuffer, batchWorkgroupCountX, batchWorkgroupCountY, numLoops, numBatchDispatches);
+
+	// latency while the batch work is running
+	auto measureUnderLoad =
+		[&](vk::Queue queue, vk::CommandBuffer commandBuffer) -> float
+		{
+			// submit batch work and give it time to start
+			sampleList.clear();
+			chrono::time_point t1 = chrono::high_resolution_clock::now();
+			submit(batchQueue.queue, batchCommandBuffer, batchFence);
+			this_thread::sleep_for(chrono::duration<float>(result.batchDispatchTime / 4));
+
+			// submit short work until the batch work is finished
+			while(sampleList.size() < maxLoadSamples) {
+				vk::Result r = vk::getFenceStatus_noThrow(batchFence);
+				if(r == vk::Result::eSuccess)
+					break;
+				vk::checkSuccess(r, "vkGetFenceStatus");
+				sampleList.push_back(submitAndWait(queue, commandBuffer, fence));
+			}
+
+			// wait for the batch work
+			wait(batchFence);
+			chrono::time_point t2 = chrono::high_resolution_clock::now();
+			result.batchTime = chrono::duration<float>(t2 - t1).count();
+			return median(sampleList);
+		};
+	result.latencyCriticalLatency = measureUnderLoad(latencyCriticalQueue.queue, latencyCriticalCommandBuffer);
+	if(otherBatchQueue)
+		result.batchLatency = measureUnderLoad(otherBatchQueue->queue, otherBatchCommandBuffer);
+
+	return result;
+}
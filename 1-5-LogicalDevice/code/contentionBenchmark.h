@@ -0,0 +1,30 @@
+#pragma once
+
+#include "queueAllocator.h"
+
+
+// Results of the contention benchmark.
+// All times are in seconds. Latencies are medians of short dispatch round trips
+// (submit, execute, wait for fence). NaN means that the value was not measured.
+struct ContentionResult {
+	float idleLatency;             // latency-critical queue on the idle device
+	float latencyCriticalLatency;  // latency-critical queue while the batch work is running
+	float batchLatency;            // other batch queue while the batch work is running
+	float batchDispatchTime;       // execution time of a single batch dispatch
+	float batchTime;               // execution time of the whole batch work
+	unsigned numBatchDispatches;
+};
+
+
+// Run the contention benchmark.
+//
+// Long batch work, composed of numBatchDispatches large dispatches, is submitted
+// to batchQueue. While it runs, short dispatches are repeatedly submitted to
+// latencyCriticalQueue and their latency is measured. If the device honors queue
+// priorities by preemption or by interleaving of the work, the latency stays
+// well below batchDispatchTime. The same is repeated with otherBatchQueue
+// of the equal priority, if it is not nullptr.
+//
+// The device must be created with shaderInt64 and bufferDeviceAddress enabled.
+ContentionResult runContentionBenchmark(const AllocatedQueue& latencyCriticalQueue, const AllocatedQueue& batchQueue,
+	const AllocatedQueue* otherBatchQueue);
@@ -1,4 +1,5 @@
 #include <array>
+#include <cmath>
 #include <iostream>
 #ifdef _WIN32
 # define WIN32_LEAN_AND_MEAN
@@ -7,6 +8,9 @@
 # include <dlfcn.h>
 #endif
 #include "vkg.h"
+#include "queueAllocator.h"
+#include "contentionBenchmark.h"
+#include "transferBenchmark.h"
 
 using namespace std;
 
@@ -68,7 +72,7 @@ int main(int argc, char* argv[])
 						.applicationVersion = 0,
 						.pEngineName = nullptr,
 						.engineVersion = 0,
-						.apiVersion = vk::ApiVersion10,
+						.apiVersion = vk::ApiVersion13,  // highest api version used by the application
 					},
 				.enabledLayerCount = 0,
 				.ppEnabledLayerNames = nullptr,
@@ -91,33 +95,149 @@ int main(int argc, char* argv[])
 			vk::PhysicalDevice pd = deviceList[i];
 			vk::PhysicalDeviceProperties properties = vk::getPhysicalDeviceProperties(pd);
 
+			// queue allocator
+			// (all queues of all queue families are requested;
+			// the first queue of each family is latency-critical with priority 1,
+			// the remaining queues are for batch work with priority 0)
+			QueueAllocator queueAllocator(pd, 1.f, 0.f, 1);
+
+			// features required by contention benchmark:
+			// Vulkan 1.2, shaderInt64 and bufferDeviceAddress
+			bool benchmarkSupported = false;
+			if(properties.apiVersion >= vk::ApiVersion12) {
+				vk::PhysicalDeviceVulkan12Features features12;
+				vk::PhysicalDeviceFeatures2 features10 {
+					.pNext = &features12
+				};
+				vk::getPhysicalDeviceFeatures2(pd, features10);
+				benchmarkSupported = features10.features.shaderInt64 && features12.bufferDeviceAddress;
+			}
+
 			// create device
 			vk::initDevice(
 				pd,  // physicalDevice
 				vk::DeviceCreateInfo{  // pCreateInfo
 					.flags = {},
-					.queueCreateInfoCount = 1,  // at least one queue is mandatory
-					.pQueueCreateInfos = array<vk::DeviceQueueCreateInfo,1>{
-						vk::DeviceQueueCreateInfo{
-							.flags = {},
-							.queueFamilyIndex = 0,
-							.queueCount = 1,
-							.pQueuePriorities = &(const float&)1.f,
-						}
-					}.data(),
+					.queueCreateInfoCount = queueAllocator.queueCreateInfoCount(),
+					.pQueueCreateInfos = queueAllocator.queueCreateInfos(),
 					.enabledLayerCount = 0,  // no enabled layers
 					.ppEnabledLayerNames = nullptr,
 					.enabledExtensionCount = 0,  // no enabled extensions
 					.ppEnabledExtensionNames = nullptr,
-					.pEnabledFeatures = nullptr,  // no enabled features
-				}
+					.pEnabledFeatures =
+						&(const vk::PhysicalDeviceFeatures&)vk::PhysicalDeviceFeatures{
+							.shaderInt64 = benchmarkSupported,
+						},
+				}.setPNext(
+					benchmarkSupported
+						? &(const vk::PhysicalDeviceVulkan12Features&)vk::PhysicalDeviceVulkan12Features{
+							.bufferDeviceAddress = true,
+						}
+						: nullptr
+				)
 			);
+			queueAllocator.getQueues();
 
 			// device function pointers
 			cout << "Device function pointers for " << properties.deviceName << ":" << endl;
 			cout << "   vkCreateShaderModule() points to: " << getLibraryOfAddr(vk::getDeviceProcAddr<void*>("vkCreateShaderModule")) << endl;
 			cout << "   vkQueueSubmit()        points to: " << getLibraryOfAddr(vk::getDeviceProcAddr<void*>("vkQueueSubmit")) << endl;
 
+			// queue families and queue priorities
+			cout << "Queue families of " << properties.deviceName << ":" << endl;
+			for(uint32_t f=0; f<queueAllocator.numFamilies(); f++) {
+				vk::QueueFlags flags = queueAllocator.queueFlags(f);
+				cout << "   " << f << ": " << queueAllocator.numQueues(f) << " queue(s) with priorities ";
+				for(uint32_t j=0; j<queueAllocator.numQueues(f); j++)
+					cout << (j==0 ? "" : ", ") << queueAllocator.priority(f, j);
+				cout << " (" << ((flags & vk::QueueFlagBits::eGraphics) ? "G" : "-")
+				     << ((flags & vk::QueueFlagBits::eCompute) ? "C" : "-")
+				     << ((flags & vk::QueueFlagBits::eTransfer) ? "T" : "-") << ")" << endl;
+			}
+
+			// queues handed out for each role and priority class
+			cout << "Queue allocation:" << endl;
+			constexpr const array<pair<QueueRole, QueuePriorityClass>, 4> queueRequestList = {{
+				{ QueueRole::eGraphics, QueuePriorityClass::eLatencyCritical },
+				{ QueueRole::eCompute,  QueuePriorityClass::eLatencyCritical },
+				{ QueueRole::eCompute,  QueuePriorityClass::eBatch },
+				{ QueueRole::eTransfer, QueuePriorityClass::eBatch },
+			}};
+			for(auto [role, priorityClass] : queueRequestList) {
+				cout << "   " << to_cstr(role) << ", " << to_cstr(priorityClass) << ": ";
+				try {
+					AllocatedQueue q = queueAllocator.allocate(role, priorityClass);
+					cout << "family " << q.family << ", queue " << q.index << ", priority " << q.priority
+					     << (q.priorityClass != priorityClass ? ", other class" : "")
+					     << (q.dedicated ? ", dedicated" : ", shared") << endl;
+				} catch(exception& e) {
+					cout << "none" << endl;
+				}
+			}
+
+			// contention benchmark
+			// (fresh allocation, so the queues are handed out as dedicated if possible)
+			queueAllocator.reset();
+			AllocatedQueue latencyCriticalQueue = queueAllocator.allocate(QueueRole::eCompute, QueuePriorityClass::eLatencyCritical);
+			AllocatedQueue batchQueue = queueAllocator.allocate(QueueRole::eCompute, QueuePriorityClass::eBatch);
+			AllocatedQueue otherBatchQueue = queueAllocator.allocate(QueueRole::eCompute, QueuePriorityClass::eBatch);
+			cout << "Contention benchmark:" << endl;
+			if(!benchmarkSupported)
+				cout << "   Skipped (Vulkan 1.2, shaderInt64 and bufferDeviceAddress are required)." << endl;
+			else if(!batchQueue.dedicated || batchQueue.priorityClass != QueuePriorityClass::eBatch)
+				cout << "   Skipped (at least two compute queues are required)." << endl;
+			else {
+				ContentionResult r =
+					runContentionBenchmark(latencyCriticalQueue, batchQueue,
+					                       otherBatchQueue.dedicated ? &otherBatchQueue : nullptr);
+				cout << "   Batch work:                         " << r.numBatchDispatches << " dispatches, "
+				     << r.batchDispatchTime * 1e3 << "ms each, " << r.batchTime * 1e3 << "ms total" << endl;
+				cout << "   Latency-critical dispatch, idle:    " << r.idleLatency * 1e3 << "ms" << endl;
+				cout << "   Latency-critical dispatch, loaded:  " << r.latencyCriticalLatency * 1e3 << "ms" << endl;
+				if(!isnan(r.batchLatency))
+					cout << "   Batch dispatch, loaded:             " << r.batchLatency * 1e3 << "ms" << endl;
+				if(isnan(r.latencyCriticalLatency))
+					cout << "   Batch work finished before any measurement." << endl;
+				else if(r.latencyCriticalLatency < r.batchDispatchTime / 2)
+					cout << "   High-priority dispatches ran while batch work was executing "
+					        "(preemption or interleaving)." << endl;
+				else
+					cout << "   High-priority dispatches waited for batch dispatches to finish "
+					        "(no preemption observed)." << endl;
+			}
+
+			// transfer benchmark
+			// (copies on the transfer queue versus on the compute queue)
+			queueAllocator.reset();
+			AllocatedQueue computeQueue = queueAllocator.allocate(QueueRole::eCompute, QueuePriorityClass::eLatencyCritical);
+			AllocatedQueue transferQueue = queueAllocator.allocate(QueueRole::eTransfer, QueuePriorityClass::eBatch);
+			cout << "Transfer benchmark:" << endl;
+			if(!benchmarkSupported)
+				cout << "   Skipped (Vulkan 1.2, shaderInt64 and bufferDeviceAddress are required)." << endl;
+			else if(transferQueue.queue == computeQueue.queue)
+				cout << "   Skipped (separate transfer queue is required)." << endl;
+			else {
+				TransferResult r =
+					runTransferBenchmark(pd, transferQueue, computeQueue, properties.apiVersion >= vk::ApiVersion13);
+				cout << "   Transfer queue: family " << transferQueue.family << ", queue " << transferQueue.index
+				     << "; compute queue: family " << computeQueue.family << ", queue " << computeQueue.index << endl;
+				cout << "   Copies: " << r.numCopies << "x " << (r.copySize >> 20) << "MiB using "
+				     << (r.copyBuffer2 ? "vkCmdCopyBuffer2" : "vkCmdCopyBuffer")
+				     << (r.ownershipTransfer ? " with queue family ownership transfer" : "") << endl;
+				cout << "   Copy bandwidth, transfer queue:     " << r.transferQueueBandwidth * 1e-9 << " GB/s" << endl;
+				cout << "   Copy bandwidth, compute queue:      " << r.computeQueueBandwidth * 1e-9 << " GB/s" << endl;
+				cout << "   FMA dispatches alone:               " << r.computeTime * 1e3 << "ms ("
+				     << r.numDispatches << " dispatches)" << endl;
+				cout << "   FMA + copies on compute queue:      " << r.serialTime * 1e3 << "ms" << endl;
+				cout << "   FMA + copies on transfer queue:     " << r.overlapTime * 1e3 << "ms (FMA finished after "
+				     << r.overlapComputeTime * 1e3 << "ms, copy bandwidth " << r.overlapBandwidth * 1e-9 << " GB/s)" << endl;
+				if(r.overlapTime < r.serialTime * 0.9f)
+					cout << "   Uploads should leave the compute queue (" << (1.f - r.overlapTime / r.serialTime) * 100.f
+					     << "% less time)." << endl;
+				else
+					cout << "   Transfer queue brings no benefit on this device." << endl;
+			}
+
 		}
 
 	// catch exceptions
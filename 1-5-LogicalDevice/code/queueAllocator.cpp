@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <stdexcept>
+#include "queueAllocator.h"
+
+using namespace std;
+
+
+QueueAllocator::QueueAllocator(vk::PhysicalDevice pd, float latencyCriticalPriority, float batchPriority,
+                               uint32_t numLatencyCriticalQueues)
+{
+	// priorities of all queues of all families
+	vk::vector<vk::QueueFamilyProperties> queueFamilyPropList = vk::getPhysicalDeviceQueueFamilyProperties(pd);
+	_familyList.resize(queueFamilyPropList.size());
+	for(size_t i=0; i<queueFamilyPropList.size(); i++) {
+		FamilyRecord& f = _familyList[i];
+		f.queueFlags = queueFamilyPropList[i].queueFlags;
+		uint32_t n = queueFamilyPropList[i].queueCount;
+		uint32_t numLatencyCritical = (n == 1) ? 1 : min(numLatencyCriticalQueues, n - 1);
+		f.priorityList.resize(n);
+		f.queueList.resize(n);
+		for(uint32_t j=0; j<n; j++) {
+			bool latencyCritical = j < numLatencyCritical;
+			f.priorityList[j] = latencyCritical ? latencyCriticalPriority : batchPriority;
+			f.queueList[j] = {
+				.queue = nullptr,
+				.priorityClass = latencyCritical ? QueuePriorityClass::eLatencyCritical : QueuePriorityClass::eBatch,
+				.useCount = 0,
+			};
+		}
+	}
+
+	// queue create infos
+	// (pQueuePriorities point to priorityList of each family, so _familyList must not be resized any more)
+	for(size_t i=0; i<_familyList.size(); i++) {
+		if(_familyList[i].queueList.empty())
+			continue;
+		_queueCreateInfoList.emplace_back(
+			vk::DeviceQueueCreateInfo{
+				.flags = {},
+				.queueFamilyIndex = uint32_t(i),
+				.queueCount = uint32_t(_familyList[i].queueList.size()),
+				.pQueuePriorities = _familyList[i].priorityList.data(),
+			}
+		);
+	}
+}
+
+
+void QueueAllocator::getQueues()
+{
+	for(size_t i=0; i<_familyList.size(); i++) {
+		vector<QueueRecord>& queueList = _familyList[i].queueList;
+		for(size_t j=0; j<queueList.size(); j++)
+			queueList[j].queue = vk::getDeviceQueue(uint32_t(i), uint32_t(j));
+	}
+	reset();
+}
+
+
+void QueueAllocator::reset()
+{
+	for(FamilyRecord& f : _familyList)
+		for(QueueRecord& q : f.queueList)
+			q.useCount = 0;
+}
+
+
+AllocatedQueue QueueAllocator::allocate(QueueRole role, QueuePriorityClass priorityClass)
+{
+	// find the most specialized family supporting the role;
+	// penalty is given for each capability that the role does not need
+	// (graphics and compute families support transfer implicitly)
+	uint32_t bestFamily = ~uint32_t(0);
+	int bestPenalty = 0;
+	for(uint32_t i=0; i<uint32_t(_familyList.size()); i++) {
+		const FamilyRecord& f = _familyList[i];
+		if(f.queueList.empty())
+			continue;
+		bool graphics = bool(f.queueFlags & vk::QueueFlagBits::eGraphics);
+		bool compute = bool(f.queueFlags & vk::QueueFlagBits::eCompute);
+		bool transfer = graphics || compute || (f.queueFlags & vk::QueueFlagBits::eTransfer);
+		int penalty;
+		switch(role) {
+		case QueueRole::eGraphics:
+			if(!graphics)  continue;
+			penalty = 0;
+			break;
+		case QueueRole::eCompute:
+			if(!compute)  continue;
+			penalty = graphics ? 2 : 0;
+			break;
+		case QueueRole::eTransfer:
+		default:
+			if(!transfer)  continue;
+			penalty = (graphics ? 2 : 0) + (compute ? 1 : 0);
+			break;
+		}
+		if(bestFamily == ~uint32_t(0) || penalty < bestPenalty) {
+			bestFamily = i;
+			bestPenalty = penalty;
+		}
+	}
+	if(bestFamily == ~uint32_t(0))
+		throw runtime_error(string("No queue family supports ") + to_cstr(role) + " queue role.");
+
+	// find the least used queue of the priority class;
+	// if the class has no queue in the family, use the other class
+	vector<QueueRecord>& queueList = _familyList[bestFamily].queueList;
+	bool classFound = any_of(queueList.begin(), queueList.end(),
+		[priorityClass](const QueueRecord& q) { return q.priorityClass == priorityClass; });
+	uint32_t bestIndex = ~uint32_t(0);
+	for(uint32_t j=0; j<uint32_t(queueList.size()); j++) {
+		if(classFound && queueList[j].priorityClass != priorityClass)
+			continue;
+		if(bestIndex == ~uint32_t(0) || queueList[j].useCount < queueList[bestIndex].useCount)
+			bestIndex = j;
+	}
+
+	QueueRecord& q = queueList[bestIndex];
+	q.useCount++;
+	return
+		AllocatedQueue{
+			.queue = q.queue,
+			.family = bestFamily,
+			.index = bestIndex,
+			.priority = _familyList[bestFamily].priorityList[bestIndex],
+			.priorityClass = q.priorityClass,
+			.dedicated = q.useCount == 1,
+		};
+}
+
+
+const char* to_cstr(QueuePriorityClass priorityClass)
+{
+	switch(priorityClass) {
+	case QueuePriorityClass::eLatencyCritical: return "latency-critical";
+	case QueuePriorityClass::eBatch: return "batch";
+	default: return "unknown";
+	}
+}
+
+
+const char* to_cstr(QueueRole role)
+{
+	switch(role) {
+	case QueueRole::eGraphics: return "graphics";
+	case QueueRole::eCompute: return "compute";
+	case QueueRole::eTransfer: return "transfer";
+	default: return "unknown";
+	}
+}
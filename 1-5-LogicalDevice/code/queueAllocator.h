@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vector>
+#include "vkg.h"
+
+
+// Priority class of the queue.
+enum class QueuePriorityClass {
+	eLatencyCritical,  // short work that should be executed as soon as possible
+	eBatch,            // long running work that can be delayed
+};
+
+
+// Role of the queue requested from QueueAllocator.
+enum class QueueRole {
+	eGraphics,  // graphics queue (it supports compute and transfer as well)
+	eCompute,   // compute queue, preferably from the family without graphics
+	eTransfer,  // transfer queue, preferably from the family without graphics and compute
+};
+
+
+// Queue handed out by QueueAllocator.
+struct AllocatedQueue {
+	vk::Queue queue;
+	uint32_t family;
+	uint32_t index;
+	float priority;
+	QueuePriorityClass priorityClass;
+	bool dedicated;  // true if the queue was not handed out before
+};
+
+
+// Queue allocator.
+//
+// It requests all queues of all queue families when the logical device is created
+// and assigns them the priority of latency-critical or batch class.
+// In each family, the first numLatencyCriticalQueues queues get latencyCriticalPriority
+// and the remaining queues get batchPriority. If the family has only a single queue,
+// it is used by both classes.
+//
+// Usage:
+//    QueueAllocator queueAllocator(pd);
+//    vk::initDevice(pd, vk::DeviceCreateInfo{
+//       .queueCreateInfoCount = queueAllocator.queueCreateInfoCount(),
+//       .pQueueCreateInfos = queueAllocator.queueCreateInfos(), ... });
+//    queueAllocator.getQueues();
+//    AllocatedQueue q = queueAllocator.allocate(QueueRole::eCompute, QueuePriorityClass::eBatch);
+class QueueAllocator {
+protected:
+	struct QueueRecord {
+		vk::Queue queue;
+		QueuePriorityClass priorityClass;
+		unsigned useCount;
+	};
+	struct FamilyRecord {
+		vk::QueueFlags queueFlags;
+		std::vector<float> priorityList;
+		std::vector<QueueRecord> queueList;
+	};
+	std::vector<FamilyRecord> _familyList;
+	std::vector<vk::DeviceQueueCreateInfo> _queueCreateInfoList;
+public:
+
+	QueueAllocator(vk::PhysicalDevice pd, float latencyCriticalPriority = 1.f, float batchPriority = 0.f,
+	               uint32_t numLatencyCriticalQueues = 1);
+
+	// data for vk::DeviceCreateInfo
+	uint32_t queueCreateInfoCount() const  { return uint32_t(_queueCreateInfoList.size()); }
+	const vk::DeviceQueueCreateInfo* queueCreateInfos() const  { return _queueCreateInfoList.data(); }
+
+	// get queue handles; call after vk::initDevice()
+	void getQueues();
+
+	// forget all handed out queues
+	void reset();
+
+	// Hand out the queue of the requested role and priority class.
+	//
+	// The queue is taken from the most specialized family that supports the role.
+	// Queues that were not handed out yet are preferred. When all suitable queues
+	// of the priority class are in use, the least used one is shared.
+	// If the class has no queue in the family, the queue of the other class is used.
+	// Throws if no family supports the role.
+	AllocatedQueue allocate(QueueRole role, QueuePriorityClass priorityClass);
+
+	// number of queue families and queues
+	uint32_t numFamilies() const  { return uint32_t(_familyList.size()); }
+	uint32_t numQueues(uint32_t family) const  { return uint32_t(_familyList[family].queueList.size()); }
+	vk::QueueFlags queueFlags(uint32_t family) const  { return _familyList[family].queueFlags; }
+	float priority(uint32_t family, uint32_t index) const  { return _familyList[family].priorityList[index]; }
+
+};
+
+
+// return name of the priority class and queue role
+const char* to_cstr(QueuePriorityClass priorityClass);
+const char* to_cstr(QueueRole role);
@@ -0,0 +1,348 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "asyncCopy.h"
+#include "transferBenchmark.h"
+
+using namespace std;
+
+// shader code as SPIR-V binary
+static const uint32_t contentionSpirv[] = {
+#include "contention.comp.spv"
+};
+
+// workload parameters
+static constexpr const vk::DeviceSize copySize = 64 << 20;  // 64 MiB
+static constexpr const unsigned numCopies = 16;
+static constexpr const uint32_t workgroupCountX = 100;
+static constexpr const uint32_t workgroupCountY = 100;
+static constexpr const uint32_t maxNumLoops = 65536;
+static constexpr const float minDispatchTime = 0.01f;  // 10ms
+static constexpr const unsigned maxNumDispatches = 100;
+static constexpr const float timeout = 5.f;  // 5 seconds
+
+
+// buffer with its own memory
+struct BufferAndMemory {
+	vk::UniqueBuffer buffer;
+	vk::UniqueDeviceMemory memory;
+};
+
+static BufferAndMemory createBuffer(const vk::PhysicalDeviceMemoryProperties& memoryProperties,
+	vk::DeviceSize size, vk::BufferUsageFlags usage, vk::MemoryPropertyFlags requiredFlags,
+	const vector<uint32_t>& queueFamilyList)
+{
+	BufferAndMemory b;
+	b.buffer =
+		vk::createBufferUnique(
+			vk::BufferCreateInfo{
+				.flags = {},
+				.size = size,
+				.usage = usage,
+				.sharingMode = (queueFamilyList.size() > 1) ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+				.queueFamilyIndexCount = (queueFamilyList.size() > 1) ? uint32_t(queueFamilyList.size()) : 0,
+				.pQueueFamilyIndices = (queueFamilyList.size() > 1) ? queueFamilyList.data() : nullptr,
+			}
+		);
+
+	// memory type with requiredFlags
+	vk::MemoryRequirements memoryRequirements = vk::getBufferMemoryRequirements(b.buffer);
+	uint32_t memoryTypeIndex = ~uint32_t(0);
+	for(uint32_t i=0; i<memoryProperties.memoryTypeCount; i++)
+		if((memoryRequirements.memoryTypeBits & (1 << i)) &&
+		   (memoryProperties.memoryTypes[i].propertyFlags & requiredFlags) == requiredFlags)
+		{
+			memoryTypeIndex = i;
+			break;
+		}
+	if(memoryTypeIndex == ~uint32_t(0))
+		throw runtime_error("No suitable memory type found for the buffer.");
+
+	b.memory =
+		vk::allocateMemoryUnique(
+			vk::MemoryAllocateInfo{
+				.allocationSize = memoryRequirements.size,
+				.memoryTypeIndex = memoryTypeIndex,
+			}
+		);
+	vk::bindBufferMemory(b.buffer, b.memory, 0);
+	return b;
+}
+
+
+static void checkTimeout(chrono::high_resolution_clock::time_point startTime)
+{
+	if(chrono::duration<float>(chrono::high_resolution_clock::now() - startTime).count() > timeout) {
+		cout << "Vulkan device timeout. Task is probably hanging." << endl;
+		// use std::quick_exit() to terminate the application
+		// (Do not throw, do not return, do not call std::exit().
+		// The device is still busy and it uses number of handles such as
+		// fences and device handle itself.
+		// Destruction of the handles in use or the unallowed access to them
+		// is forbidden by Vulkan specification.
+		quick_exit(-1);
+	}
+}
+
+
+// return true if the fence is signaled; it does not wait
+static bool isSignaled(vk::Fence fence)
+{
+	vk::Result r = vk::getFenceStatus_noThrow(fence);
+	if(r == vk::Result::eSuccess)
+		return true;
+	vk::checkSuccess(r, "vkGetFenceStatus");
+	return false;
+}
+
+
+TransferResult runTransferBenchmark(vk::PhysicalDevice pd, const AllocatedQueue& transferQueue,
+	const AllocatedQueue& computeQueue, bool useCopyBuffer2)
+{
+	TransferResult result{
+		.copySize = copySize,
+		.numCopies = numCopies,
+		.numDispatches = 0,
+		.ownershipTransfer = false,
+		.copyBuffer2 = false,
+		.transferQueueBandwidth = NAN,
+		.computeQueueBandwidth = NAN,
+		.computeTime = NAN,
+		.serialTime = NAN,
+		.overlapTime = NAN,
+		.overlapComputeTime = NAN,
+		.overlapBandwidth = NAN,
+	};
+	constexpr const float totalSize = float(copySize * numCopies);
+
+	// buffers:
+	// staging buffer is used by both queue families, so it uses concurrent sharing mode;
+	// overlap measurement uses its own destination buffer
+	// (contents of the buffers are not used after the hand-over, so they are not transferred
+	// back to the transfer queue family; consecutive copies into the same buffer
+	// are ordered by the transfer barrier recorded by AsyncCopy)
+	vk::PhysicalDeviceMemoryProperties memoryProperties = vk::getPhysicalDeviceMemoryProperties(pd);
+	vector<uint32_t> queueFamilyList = { transferQueue.family };
+	if(computeQueue.family != transferQueue.family)
+		queueFamilyList.push_back(computeQueue.family);
+	BufferAndMemory stagingBuffer =
+		createBuffer(memoryProperties, copySize, vk::BufferUsageFlagBits::eTransferSrc,
+		             vk::MemoryPropertyFlagBits::eHostVisible, queueFamilyList);
+	BufferAndMemory dstBuffer =
+		createBuffer(memoryProperties, copySize, vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eStorageBuffer,
+		             vk::MemoryPropertyFlagBits::eDeviceLocal, {});
+	BufferAndMemory overlapDstBuffer =
+		createBuffer(memoryProperties, copySize, vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eStorageBuffer,
+		             vk::MemoryPropertyFlagBits::eDeviceLocal, {});
+
+	// copy paths:
+	// uploads on the transfer queue handed to the compute queue,
+	// uploads on the compute queue,
+	// and uploads on the transfer queue handed to the compute queue during the overlap measurement
+	// (its release and acquire pairs are exercised while the compute queue is busy)
+	AsyncCopy transferQueueCopy(transferQueue, &computeQueue, useCopyBuffer2, numCopies);
+	AsyncCopy computeQueueCopy(computeQueue, &computeQueue, useCopyBuffer2, numCopies);
+	AsyncCopy overlapCopy(transferQueue, &computeQueue, useCopyBuffer2, numCopies);
+	result.ownershipTransfer = transferQueueCopy.ownershipTransfer();
+	result.copyBuffer2 = transferQueueCopy.usesCopyBuffer2();
+
+	// copy throughput
+	// (the first copy is a warm-up)
+	auto measureCopies =
+		[&](AsyncCopy& asyncCopy, vk::Buffer dst) -> float
+		{
+			asyncCopy.copy(stagingBuffer.buffer, dst, copySize);
+			asyncCopy.flush();
+			chrono::time_point t1 = chrono::high_resolution_clock::now();
+			for(unsigned i=0; i<numCopies; i++)
+				asyncCopy.copy(stagingBuffer.buffer, dst, copySize);
+			asyncCopy.flush();
+			chrono::time_point t2 = chrono::high_resolution_clock::now();
+			return totalSize / chrono::duration<float>(t2 - t1).count();
+		};
+	result.transferQueueBandwidth = measureCopies(transferQueueCopy, dstBuffer.buffer);
+	result.computeQueueBandwidth = measureCopies(computeQueueCopy, dstBuffer.buffer);
+
+	// shader module
+	vk::UniqueShaderModule shaderModule =
+		vk::createShaderModuleUnique(
+			vk::ShaderModuleCreateInfo{
+				.flags = {},
+				.codeSize = sizeof(contentionSpirv),
+				.pCode = contentionSpirv,
+			}
+		);
+
+	// pipeline layout
+	vk::UniquePipelineLayout pipelineLayout =
+		vk::createPipelineLayoutUnique(
+			vk::PipelineLayoutCreateInfo{
+				.flags = {},
+				.setLayoutCount = 0,
+				.pSetLayouts = nullptr,
+				.pushConstantRangeCount = 1,
+				.pPushConstantRanges =
+					&(const vk::PushConstantRange&)vk::PushConstantRange{
+						.stageFlags = vk::ShaderStageFlagBits::eCompute,
+						.offset = 0,
+						.size = sizeof(uint32_t),
+					},
+			}
+		);
+
+	// pipeline
+	vk::UniquePipeline pipeline =
+		vk::createComputePipelineUnique(
+			nullptr,
+			vk::ComputePipelineCreateInfo{
+				.flags = {},
+				.stage =
+					vk::PipelineShaderStageCreateInfo{
+						.flags = {},
+						.stage = vk::ShaderStageFlagBits::eCompute,
+						.module = shaderModule,
+						.pName = "main",
+						.pSpecializationInfo = nullptr,
+					},
+				.layout = pipelineLayout,
+				.basePipelineHandle = nullptr,
+				.basePipelineIndex = -1,
+			}
+		);
+
+	// command pool and command buffer
+	vk::UniqueCommandPool commandPool =
+		vk::createCommandPoolUnique(
+			vk::CommandPoolCreateInfo{
+				.flags = {},
+				.queueFamilyIndex = computeQueue.family,
+			}
+		);
+	vk::CommandBuffer commandBuffer =
+		vk::allocateCommandBuffer(
+			vk::CommandBufferAllocateInfo{
+				.commandPool = commandPool,
+				.level = vk::CommandBufferLevel::ePrimary,
+				.commandBufferCount = 1,
+			}
+		);
+	auto recordCommandBuffer =
+		[&](uint32_t numLoops, unsigned numDispatches)
+		{
+			vk::resetCommandPool(commandPool, {});
+			vk::beginCommandBuffer(
+				commandBuffer,
+				vk::CommandBufferBeginInfo{
+					.flags = {},
+					.pInheritanceInfo = nullptr,
+				}
+			);
+			vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+			vk::cmdPushConstants(commandBuffer, pipelineLayout, vk::ShaderStageFlagBits::eCompute,
+			                     0, sizeof(uint32_t), &numLoops);
+			for(unsigned i=0; i<numDispatches; i++)
+				vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, 1);
+			vk::endCommandBuffer(commandBuffer);
+		};
+
+	// fence
+	vk::UniqueFence fence =
+		vk::createFenceUnique(
+			vk::FenceCreateInfo{
+				.flags = {}
+			}
+		);
+	auto submitDispatches =
+		[&]()
+		{
+			vk::queueSubmit(
+				computeQueue.queue,
+				vk::SubmitInfo{
+					.waitSemaphoreCount = 0,
+					.pWaitSemaphores = nullptr,
+					.pWaitDstStageMask = nullptr,
+					.commandBufferCount = 1,
+					.pCommandBuffers = &commandBuffer,
+					.signalSemaphoreCount = 0,
+					.pSignalSemaphores = nullptr,
+				},
+				fence
+			);
+		};
+	auto runDispatches =
+		[&]() -> float
+		{
+			chrono::time_point t1 = chrono::high_resolution_clock::now();
+			submitDispatches();
+			while(!isSignaled(fence))
+				checkTimeout(t1);
+			chrono::time_point t2 = chrono::high_resolution_clock::now();
+			vk::resetFence(fence);
+			return chrono::duration<float>(t2 - t1).count();
+		};
+
+	// calibrate FMA dispatch
+	// (number of loops is doubled until the dispatch takes at least minDispatchTime;
+	// then, number of dispatches is chosen to take about the same time as the copies on the compute queue)
+	uint32_t numLoops = 1;
+	float dispatchTime;
+	while(true) {
+		recordCommandBuffer(numLoops, 1);
+		dispatchTime = runDispatches();
+		if(dispatchTime >= minDispatchTime || numLoops >= maxNumLoops)
+			break;
+		numLoops *= 2;
+	}
+	float copyTime = totalSize / result.computeQueueBandwidth;
+	result.numDispatches = clamp(unsigned(ceil(copyTime / dispatchTime)), 1u, maxNumDispatches);
+	recordCommandBuffer(numLoops, result.numDispatches);
+
+	// FMA dispatches alone
+	result.computeTime = runDispatches();
+
+	// FMA dispatches followed by the copies on the compute queue
+	chrono::time_point t1 = chrono::high_resolution_clock::now();
+	submitDispatches();
+	for(unsigned i=0; i<numCopies; i++)
+		computeQueueCopy.copy(stagingBuffer.buffer, dstBuffer.buffer, copySize);
+	while(!isSignaled(fence) || !computeQueueCopy.poll())
+		checkTimeout(t1);
+	chrono::time_point t2 = chrono::high_resolution_clock::now();
+	vk::resetFence(fence);
+	result.serialTime = chrono::duration<float>(t2 - t1).count();
+
+	// FMA dispatches on the compute queue concurrently with the copies on the transfer queue;
+	// copy bandwidth is measured until the transfer queue finishes the copies,
+	// the hand-over to the compute queue is included in overlapTime
+	bool computeDone = false;
+	bool copiesDone = false;
+	chrono::time_point tCompute = t1;
+	chrono::time_point tCopies = t1;
+	t1 = chrono::high_resolution_clock::now();
+	submitDispatches();
+	for(unsigned i=0; i<numCopies; i++)
+		overlapCopy.copy(stagingBuffer.buffer, overlapDstBuffer.buffer, copySize);
+	while(!computeDone || !copiesDone) {
+		if(!computeDone && isSignaled(fence)) {
+			computeDone = true;
+			tCompute = chrono::high_resolution_clock::now();
+		}
+		if(!copiesDone && overlapCopy.pollCopies()) {
+			copiesDone = true;
+			tCopies = chrono::high_resolution_clock::now();
+		}
+		checkTimeout(t1);
+	}
+	while(!overlapCopy.poll())
+		checkTimeout(t1);
+	t2 = chrono::high_resolution_clock::now();
+	vk::resetFence(fence);
+	result.overlapTime = chrono::duration<float>(t2 - t1).count();
+	result.overlapComputeTime = chrono::duration<float>(tCompute - t1).count();
+	result.overlapBandwidth = totalSize / chrono::duration<float>(tCopies - t1).count();
+
+	return result;
+}
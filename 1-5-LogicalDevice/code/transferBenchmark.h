@@ -0,0 +1,39 @@
+#pragma once
+
+#include "queueAllocator.h"
+
+
+// Results of the transfer benchmark.
+// Times are in seconds, bandwidths in bytes per second.
+struct TransferResult {
+	vk::DeviceSize copySize;  // size of a single copy
+	unsigned numCopies;
+	unsigned numDispatches;
+	bool ownershipTransfer;  // copies on the transfer queue require queue family ownership transfer
+	bool copyBuffer2;        // vkCmdCopyBuffer2 was used
+
+	// copies alone
+	float transferQueueBandwidth;  // on the transfer queue, handed to the compute queue
+	float computeQueueBandwidth;   // on the compute queue
+
+	// FMA dispatches alone, and together with the copies
+	float computeTime;         // FMA dispatches alone
+	float serialTime;          // FMA dispatches followed by the copies, all on the compute queue
+	float overlapTime;         // FMA dispatches on the compute queue, copies on the transfer queue
+	float overlapComputeTime;  // time until FMA dispatches finished in overlapTime measurement
+	float overlapBandwidth;    // copy bandwidth in overlapTime measurement
+};
+
+
+// Run the transfer benchmark.
+//
+// Host-visible staging buffer is copied to device-local buffer numCopies times,
+// first on transferQueue and then on computeQueue, to measure copy throughput.
+// Then, FMA dispatches of about the same duration as the copies are run
+// on computeQueue, first alone, then followed by the copies on computeQueue
+// and finally concurrently with the copies on transferQueue. This shows whether
+// uploads should leave the compute queue.
+//
+// The device must be created with shaderInt64 and bufferDeviceAddress enabled.
+TransferResult runTransferBenchmark(vk::PhysicalDevice pd, const AllocatedQueue& transferQueue,
+	const AllocatedQueue& computeQueue, bool useCopyBuffer2);
@@ -1,9 +1,11 @@
 #include <algorithm>
 #include <array>
 #include <cstdlib>
+#include <iomanip>
 #include <iostream>
 #include <tuple>
 #include <vector>
+#include "recordingBenchmark.h"
 #include "vkg.h"
 
 using namespace std;
@@ -218,6 +220,26 @@ int main(int argc, char* argv[])
 
 		cout << "Done." << endl;
 
+		// recording benchmark
+		// (time to record the list of dispatches on single thread and in parallel
+		// into secondary command buffers stitched into primary command buffer)
+		cout << "Running recording benchmark..." << endl;
+		vector<RecordingResult> recordingResultList = runRecordingBenchmark(queueFamily, queue);
+		cout << "Recording time:\n"
+		        "   dispatches  threads      time    dispatches/s" << endl;
+		for(const RecordingResult& r : recordingResultList) {
+			cout << "   " << setw(10) << r.numCommands << "  ";
+			if(r.numThreads == 0)
+				cout << " primary";
+			else
+				cout << setw(8) << r.numThreads;
+			cout << "  " << setw(7) << fixed << setprecision(2) << r.recordTime * 1e3f << "ms"
+			     << "  " << setw(12) << setprecision(3) << scientific << r.numCommands / r.recordTime
+			     << defaultfloat << endl;
+		}
+		cout << "   (primary - recorded directly into primary command buffer;\n"
+		        "   threads - recorded into secondary command buffers and executed from primary command buffer)" << endl;
+
 	// catch exceptions
 	} catch(vk::Error& e) {
 		cout << e.what() << endl;
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include "parallelRecorder.h"
+
+using namespace std;
+
+
+ParallelRecorder::ParallelRecorder(uint32_t queueFamily, unsigned numThreads)
+{
+	// primary command buffer
+	_primaryCommandPool =
+		vk::createCommandPoolUnique(
+			vk::CommandPoolCreateInfo{
+				.flags = vk::CommandPoolCreateFlagBits::eTransient,
+				.queueFamilyIndex = queueFamily,
+			}
+		);
+	_primaryCommandBuffer =
+		vk::allocateCommandBuffer(
+			vk::CommandBufferAllocateInfo{
+				.commandPool = _primaryCommandPool,
+				.level = vk::CommandBufferLevel::ePrimary,
+				.commandBufferCount = 1,
+			}
+		);
+
+	// command pool and secondary command buffer for each thread
+	// (command pools are externally synchronized, so each thread needs its own pool)
+	_sliceList.resize(max(numThreads, 1u));
+	_secondaryCommandBufferList.resize(_sliceList.size());
+	for(size_t i=0; i<_sliceList.size(); i++) {
+		Slice& slice = _sliceList[i];
+		slice.commandPool =
+			vk::createCommandPoolUnique(
+				vk::CommandPoolCreateInfo{
+					.flags = vk::CommandPoolCreateFlagBits::eTransient,
+					.queueFamilyIndex = queueFamily,
+				}
+			);
+		slice.commandBuffer =
+			vk::allocateCommandBuffer(
+				vk::CommandBufferAllocateInfo{
+					.commandPool = slice.commandPool,
+					.level = vk::CommandBufferLevel::eSecondary,
+					.commandBufferCount = 1,
+				}
+			);
+		_secondaryCommandBufferList[i] = slice.commandBuffer;
+	}
+
+	// worker threads
+	// (the first slice is recorded by the thread calling record())
+	try {
+		_threadList.reserve(_sliceList.size() - 1);
+		for(size_t i=1; i<_sliceList.size(); i++)
+			_threadList.emplace_back(&ParallelRecorder::workerMain, this, i);
+	} catch(...) {
+		stopThreads();
+		throw;
+	}
+}
+
+
+ParallelRecorder::~ParallelRecorder()
+{
+	stopThreads();
+}
+
+
+void ParallelRecorder::stopThreads() noexcept
+{
+	{
+		lock_guard lock(_mutex);
+		_quit = true;
+	}
+	_workCondition.notify_all();
+	for(thread& t : _threadList)
+		if(t.joinable())
+			t.join();
+	_threadList.clear();
+}
+
+
+void ParallelRecorder::recordSlice(Slice& slice, const RecordFunc& recordFunc) noexcept
+{
+	try {
+
+		// reset all command buffers of the pool at once
+		vk::resetCommandPool(slice.commandPool, {});
+
+		// record secondary command buffer
+		// (secondary command buffers executed outside of render pass inherit nothing)
+		vk::beginCommandBuffer(
+			slice.commandBuffer,
+			vk::CommandBufferBeginInfo{
+				.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+				.pInheritanceInfo =
+					&(const vk::CommandBufferInheritanceInfo&)vk::CommandBufferInheritanceInfo{
+						.renderPass = nullptr,
+						.subpass = 0,
+						.framebuffer = nullptr,
+						.occlusionQueryEnable = false,
+						.queryFlags = {},
+						.pipelineStatistics = {},
+					},
+			}
+		);
+		recordFunc(slice.commandBuffer, slice.first, slice.count);
+		vk::endCommandBuffer(slice.commandBuffer);
+
+	} catch(...) {
+		slice.exception = current_exception();
+	}
+}
+
+
+void ParallelRecorder::workerMain(size_t sliceIndex)
+{
+	uint64_t generation = 0;
+	while(true) {
+
+		// wait for work
+		const RecordFunc* recordFunc;
+		{
+			unique_lock lock(_mutex);
+			_workCondition.wait(lock, [this, generation]() { return _quit || _generation != generation; });
+			if(_quit)
+				return;
+			generation = _generation;
+			recordFunc = _recordFunc;
+		}
+
+		recordSlice(_sliceList[sliceIndex], *recordFunc);
+
+		// report finished work
+		{
+			lock_guard lock(_mutex);
+			_numBusyThreads--;
+			if(_numBusyThreads == 0)
+				_doneCondition.notify_one();
+		}
+	}
+}
+
+
+vk::CommandBuffer ParallelRecorder::record(size_t numCommands, const RecordFunc& recordFunc)
+{
+	// split command list into slices
+	size_t n = _sliceList.size();
+	for(size_t i=0; i<n; i++) {
+		Slice& slice = _sliceList[i];
+		slice.first = numCommands * i / n;
+		slice.count = numCommands * (i+1) / n - slice.first;
+		slice.exception = nullptr;
+	}
+
+	// start worker threads
+	{
+		lock_guard lock(_mutex);
+		_recordFunc = &recordFunc;
+		_numBusyThreads = unsigned(n - 1);
+		_generation++;
+	}
+	_workCondition.notify_all();
+
+	// record the first slice and wait for the others
+	recordSlice(_sliceList[0], recordFunc);
+	{
+		unique_lock lock(_mutex);
+		_doneCondition.wait(lock, [this]() { return _numBusyThreads == 0; });
+	}
+	for(Slice& slice : _sliceList)
+		if(slice.exception)
+			rethrow_exception(slice.exception);
+
+	// stitch secondary command buffers into the primary command buffer
+	vk::resetCommandPool(_primaryCommandPool, {});
+	vk::beginCommandBuffer(
+		_primaryCommandBuffer,
+		vk::CommandBufferBeginInfo{
+			.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+			.pInheritanceInfo = nullptr,
+		}
+	);
+	vk::cmdExecuteCommands(_primaryCommandBuffer, uint32_t(n), _secondaryCommandBufferList.data());
+	vk::endCommandBuffer(_primaryCommandBuffer);
+	return _primaryCommandBuffer;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "vkg.h"
+
+
+// Parallel command recorder.
+//
+// The command list of numCommands commands is split into numThreads slices.
+// Each worker thread owns its transient command pool and records its slice
+// into a secondary command buffer. The secondary command buffers are then
+// stitched into the primary command buffer by vkCmdExecuteCommands.
+// The calling thread records the first slice, so numThreads-1 worker threads
+// are created. They live as long as the recorder.
+//
+// Command pools are reset by vkResetCommandPool on each record() call, so the
+// previously recorded command buffers must not be in use by the device any more.
+class ParallelRecorder {
+public:
+	// records commands [first, first+count) of the command list into commandBuffer;
+	// it is called concurrently from multiple threads, each with its own commandBuffer
+	using RecordFunc = std::function<void(vk::CommandBuffer commandBuffer, size_t first, size_t count)>;
+
+protected:
+	struct Slice {
+		vk::UniqueCommandPool commandPool;
+		vk::CommandBuffer commandBuffer;
+		size_t first;
+		size_t count;
+		std::exception_ptr exception;
+	};
+	std::vector<Slice> _sliceList;
+	std::vector<vk::CommandBuffer> _secondaryCommandBufferList;
+	vk::UniqueCommandPool _primaryCommandPool;
+	vk::CommandBuffer _primaryCommandBuffer;
+
+	std::vector<std::thread> _threadList;
+	std::mutex _mutex;
+	std::condition_variable _workCondition;
+	std::condition_variable _doneCondition;
+	const RecordFunc* _recordFunc = nullptr;
+	uint64_t _generation = 0;  // incremented on each record() call
+	unsigned _numBusyThreads = 0;
+	bool _quit = false;
+
+	void stopThreads() noexcept;
+	void recordSlice(Slice& slice, const RecordFunc& recordFunc) noexcept;
+	void workerMain(size_t sliceIndex);
+
+public:
+
+	ParallelRecorder(uint32_t queueFamily, unsigned numThreads);
+	~ParallelRecorder();
+
+	// record numCommands commands in parallel and return the primary command buffer
+	vk::CommandBuffer record(size_t numCommands, const RecordFunc& recordFunc);
+
+	unsigned numThreads() const  { return unsigned(_sliceList.size()); }
+	vk::CommandBuffer primaryCommandBuffer() const  { return _primaryCommandBuffer; }
+
+};
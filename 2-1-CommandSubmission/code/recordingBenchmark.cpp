@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include "parallelRecorder.h"
+#include "recordingBenchmark.h"
+
+using namespace std;
+
+// shader code as SPIR-V binary
+static const uint32_t noopSpirv[] = {
+#include "noop.comp.spv"
+};
+
+// benchmark parameters
+static constexpr const array<size_t, 3> numCommandsList = { 10000, 100000, 1000000 };
+static constexpr const unsigned numRepetitions = 5;
+static constexpr const size_t numValidationCommands = 10000;
+
+
+template<typename Func>
+static float measureRecording(Func&& recordFunc)
+{
+	// median of numRepetitions recordings
+	array<float, numRepetitions> timeList;
+	for(float& t : timeList) {
+		auto t1 = chrono::high_resolution_clock::now();
+		recordFunc();
+		auto t2 = chrono::high_resolution_clock::now();
+		t = chrono::duration<float>(t2 - t1).count();
+	}
+	sort(timeList.begin(), timeList.end());
+	return timeList[numRepetitions / 2];
+}
+
+
+vector<RecordingResult> runRecordingBenchmark(uint32_t queueFamily, vk::Queue queue)
+{
+	// pipeline
+	vk::UniqueShaderModule shaderModule =
+		vk::createShaderModuleUnique(
+			vk::ShaderModuleCreateInfo{
+				.flags = {},
+				.codeSize = sizeof(noopSpirv),
+				.pCode = noopSpirv,
+			}
+		);
+	vk::UniquePipelineLayout pipelineLayout =
+		vk::createPipelineLayoutUnique(
+			vk::PipelineLayoutCreateInfo{
+				.flags = {},
+				.setLayoutCount = 0,
+				.pSetLayouts = nullptr,
+				.pushConstantRangeCount = 0,
+				.pPushConstantRanges = nullptr,
+			}
+		);
+	vk::UniquePipeline pipeline =
+		vk::createComputePipelineUnique(
+			nullptr,
+			vk::ComputePipelineCreateInfo{
+				.flags = {},
+				.stage =
+					vk::PipelineShaderStageCreateInfo{
+						.flags = {},
+						.stage = vk::ShaderStageFlagBits::eCompute,
+						.module = shaderModule,
+						.pName = "main",
+						.pSpecializationInfo = nullptr,
+					},
+				.layout = pipelineLayout,
+				.basePipelineHandle = nullptr,
+				.basePipelineIndex = -1,
+			}
+		);
+
+	// slice of the dispatch list
+	// (pipeline binding is not inherited by secondary command buffers, so each slice binds it)
+	vk::Pipeline p = pipeline;
+	ParallelRecorder::RecordFunc recordDispatches =
+		[p](vk::CommandBuffer commandBuffer, size_t, size_t count) {
+			vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, p);
+			for(size_t i=0; i<count; i++)
+				vk::cmdDispatch(commandBuffer, 1, 1, 1);
+		};
+
+	vector<RecordingResult> resultList;
+
+	// direct recording into primary command buffer
+	{
+		vk::UniqueCommandPool commandPool =
+			vk::createCommandPoolUnique(
+				vk::CommandPoolCreateInfo{
+					.flags = vk::CommandPoolCreateFlagBits::eTransient,
+					.queueFamilyIndex = queueFamily,
+				}
+			);
+		vk::CommandBuffer commandBuffer =
+			vk::allocateCommandBuffer(
+				vk::CommandBufferAllocateInfo{
+					.commandPool = commandPool,
+					.level = vk::CommandBufferLevel::ePrimary,
+					.commandBufferCount = 1,
+				}
+			);
+		for(size_t numCommands : numCommandsList) {
+			float t =
+				measureRecording(
+					[&]() {
+						vk::resetCommandPool(commandPool, {});
+						vk::beginCommandBuffer(
+							commandBuffer,
+							vk::CommandBufferBeginInfo{
+								.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+								.pInheritanceInfo = nullptr,
+							}
+						);
+						recordDispatches(commandBuffer, 0, numCommands);
+						vk::endCommandBuffer(commandBuffer);
+					}
+				);
+			resultList.emplace_back(numCommands, 0, t);
+		}
+	}
+
+	// parallel recording with 1, 2, 4, ... threads
+	unsigned maxThreads = max(thread::hardware_concurrency(), 1u);
+	for(unsigned numThreads=1; ; numThreads=min(numThreads*2, maxThreads)) {
+		ParallelRecorder recorder(queueFamily, numThreads);
+		for(size_t numCommands : numCommandsList) {
+			float t = measureRecording([&]() { recorder.record(numCommands, recordDispatches); });
+			resultList.emplace_back(numCommands, numThreads, t);
+		}
+		if(numThreads == maxThreads)
+			break;
+	}
+
+	// execute one stitched command buffer
+	// to verify that secondary command buffers recorded on multiple threads work
+	ParallelRecorder recorder(queueFamily, maxThreads);
+	vk::CommandBuffer commandBuffer = recorder.record(numValidationCommands, recordDispatches);
+	vk::UniqueFence fence =
+		vk::createFenceUnique(
+			vk::FenceCreateInfo{
+				.flags = {}
+			}
+		);
+	vk::queueSubmit(
+		queue,
+		vk::SubmitInfo{
+			.waitSemaphoreCount = 0,
+			.pWaitSemaphores = nullptr,
+			.pWaitDstStageMask = nullptr,
+			.commandBufferCount = 1,
+			.pCommandBuffers = &commandBuffer,
+			.signalSemaphoreCount = 0,
+			.pSignalSemaphores = nullptr,
+		},
+		fence
+	);
+	vk::Result r =
+		vk::waitForFence_noThrow(
+			fence,
+			uint64_t(3e9)  // timeout (3 seconds)
+		);
+	if(r == vk::Result::eTimeout) {
+		cout << "Vulkan device timeout. Task is probably hanging." << endl;
+		// use std::quick_exit() to terminate the application
+		// (Do not throw, do not return, do not call std::exit().
+		// The device is still busy and it uses number of handles such as
+		// fence and device handle itself.
+		// Destruction of the handles in use or the unallowed access to them
+		// is forbidden by Vulkan specification.
+		quick_exit(-1);
+	} else
+		vk::checkForSuccessValue(r, "vkWaitForFences");
+
+	return resultList;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vector>
+#include "vkg.h"
+
+
+// Result of a single recording benchmark measurement.
+// recordTime is the median of several recordings in seconds.
+struct RecordingResult {
+	size_t numCommands;
+	unsigned numThreads;  // 0 means single primary command buffer recorded directly without secondary command buffers
+	float recordTime;
+};
+
+
+// Run the recording benchmark.
+//
+// Lists of 10k, 100k and 1M dispatches are recorded into a primary command buffer
+// directly on the calling thread and then by ParallelRecorder using 1, 2, 4, ...
+// threads up to the number of hardware threads. Finally, one recording
+// is submitted to the queue to verify that the stitched command buffer executes.
+std::vector<RecordingResult> runRecordingBenchmark(uint32_t queueFamily, vk::Queue queue);
@@ -0,0 +1,974 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "vkg.h"
+
+using namespace std;
+
+
+// constants
+constexpr const char* appName = "2-10-AtomicOperations";
+constexpr const float totalMeasuringTime = 10.f;  // total time in seconds for which measurements are made and median time of the measurements is taken at the end
+constexpr const float singleMeasurementTargetTime = 0.01f;  // single measurement time in seconds; the load will be continually adjusted to target this time
+constexpr const float minTimeOfValidMeasurement = 0.002f;  // minimal measurement time to consider it valid measurement
+constexpr const float maxNumWorkgroupsMultiplier = 10.f;  // limits number of workgroups in the next measurement to not be more than 10 times higher then in the current measurement
+constexpr const uint32_t workgroupSize = 128;  // must match local_size_x in atomic-*.comp
+constexpr const uint32_t operationsPerInvocation = 100;  // must match the number of atomic operations in atomic-*.comp
+constexpr const size_t minNumBufferElements = 1024 * 1024;  // initial number of counters in the buffer; the buffer grows with the dispatch size
+
+
+// shader code as SPIR-V binary
+static const uint32_t atomicInt32Spirv[] = {
+#include "atomic-int32.comp.spv"
+};
+static const uint32_t atomicInt64Spirv[] = {
+#include "atomic-int64.comp.spv"
+};
+static const uint32_t atomicFloatSpirv[] = {
+#include "atomic-float.comp.spv"
+};
+
+
+// names of data types, operations and contention levels
+// (the index of operation and contention level is passed to the shader as specialization constant)
+constexpr const array<const char*, 3> dataTypeNames = { "int32", "int64", "float" };
+constexpr const array<const char*, 3> operationNames = {
+	"atomicAdd       ",
+	"atomicCompSwap  ",
+	"atomicExchange  ",
+};
+constexpr const array<const char*, 4> contentionNames = {
+	"one global counter:      ",
+	"counter per workgroup:   ",
+	"counter per subgroup:    ",
+	"counter per invocation:  ",
+};
+
+
+// Convert float value to c-string.
+//
+// It prints float followed by SI suffix, such as K, M, G, m, u, n, etc.
+// for kilo, mega, giga, milli, micro, nano,
+// It uses precision of three digits, taking form of one of three variants:
+// 1.23, 12.3, or 123, followed by space and SI suffix.
+// To make it always the same length, third variant appends a space before the number:
+// "1.23 K", "12.3 M", or " 123 G"
+// Supported range is from "100 a" to "999 E". Bigger values are converted to "+inf   ".
+// Lower values including negative numbers are converted to "   0  ".
+static auto formatFloatSI(float v)
+{
+	// return type with implicit conversion to const char*
+	struct SmallString {
+		array<char,7> buffer;
+		operator const char*() const { return buffer.data(); }
+	};
+	SmallString s;
+
+	// compute significand and exponent
+	int exponent = floorf(log10f(v));
+	float divisor = expf(float(exponent - 2) * logf(10));  // this computes exp10f(exponent - 2)
+	int significand = int(v / divisor + 0.5f);  // value is >=100 and <1000, actually it might be
+		// a little out this range because of small floating computation imprecisions; +0.5 makes proper
+		// rounding and avoids underflow to 99, but might cause overflow to 1000 (or even 1001?)
+
+	// convert significand to numbers
+	char n[4];
+	n[3] = significand % 10;
+	significand /= 10;
+	n[2] = significand % 10;
+	significand /= 10;
+	n[1] = significand % 10;
+	int thousandNumber = significand / 10;  // thousandNumber is 0 or 1; value 1 is present in some extreme cases
+	n[0] = thousandNumber;
+	exponent += thousandNumber;  // increment exponent if n contains >=1000
+
+	// make exponent ready to index into SI prefix table
+	constexpr const array<char,13> siPrefix = {
+		'a', 'f', 'p', 'n', 'u', 'm', ' ', 'K', 'M', 'G', 'T', 'P', 'E'
+	};
+	exponent += 18;  // make zero exponent point on the ' ' in siPrefixes
+	if(exponent < 0) {
+		s.buffer = { ' ', ' ', ' ', '0', ' ', ' ', 0 };
+		return s;
+	}
+	if(exponent >= 39) {
+		s.buffer = { '+', 'i', 'n', 'f', ' ', ' ', 0 };
+		return s;
+	}
+
+	// create final string
+	s.buffer[6] = 0;
+	s.buffer[5] = siPrefix[exponent / 3];
+	s.buffer[4] = ' ';
+	int dotPos = (exponent % 3) + 1;
+	if(dotPos == 3)
+		s.buffer[0] = ' ';
+	else
+		s.buffer[dotPos] = '.';
+	s.buffer[3] = '0' + n[3 - thousandNumber];
+	s.buffer[dotPos==2 ? 1 : 2] = '0' + n[2 - thousandNumber];
+	s.buffer[dotPos==3 ? 1 : 0] = '0' + n[1 - thousandNumber];
+	return s;
+}
+
+
+int main(int argc, char* argv[])
+{
+	// catch exceptions
+	// (vk functions throw if they fail)
+	try {
+
+		// parse command-line arguments
+		bool printHelp = false;
+		size_t selectedDeviceIndex = 0;
+		char* deviceFilterString = nullptr;
+		for(int i=1; i<argc; i++) {
+
+			// parse options starting with '-'
+			if(argv[i][0] == '-') {
+
+				// print help
+				if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+					printHelp = true;
+					continue;
+				}
+
+				// parse device index
+				if(argv[i][1] >= '0' && argv[i][1] <= '9') {
+					char* endp = nullptr;
+					selectedDeviceIndex = strtoull(&argv[i][1], &endp, 10);
+					if(selectedDeviceIndex == 0 || endp == &argv[i][1] || (endp && *endp != 0))
+						printHelp = true;
+					continue;
+				}
+
+				printHelp = true;
+				continue;
+			}
+
+			// parse device filter string
+			deviceFilterString = argv[i];
+
+		}
+
+		// print help
+		if(printHelp) {
+			cout << appName << " prints the throughput of atomic operations of a Vulkan device\n"
+			        "\n"
+			        "Usage: " << appName << " [-<deviceIndex>] [deviceNameFilter]\n"
+			        "   -<deviceIndex> - for example -1 or -3, specifies the index\n"
+			        "      of the device used for the performance test; it might be\n"
+			        "      useful when more devices are present in the system;\n"
+			        "      devices are numbered starting from one\n"
+			        "   deviceNameFilter - only devices matching the given string\n"
+			        "      will be considered; for example AMD, GeForce, Intel\n" << endl;
+			return 99;
+		}
+
+		// load Vulkan library
+		vk::loadLib();
+
+		// Vulkan instance
+		vk::initInstance(
+			vk::InstanceCreateInfo{
+				.flags = {},
+				.pApplicationInfo =
+					&(const vk::ApplicationInfo&)vk::ApplicationInfo{
+						.pApplicationName = appName,
+						.applicationVersion = 0,
+						.pEngineName = nullptr,
+						.engineVersion = 0,
+						.apiVersion = vk::ApiVersion12,  // highest api version used by the application
+					},
+				.enabledLayerCount = 0,
+				.ppEnabledLayerNames = nullptr,
+				.enabledExtensionCount = 0,
+				.ppEnabledExtensionNames = nullptr,
+			}
+		);
+
+		// get compatible and incompatible devices
+		//
+		// required functionality: Vulkan 1.2, shaderInt64, bufferDeviceAddress,
+		//                         compute queue, timestamp support
+		// optional functionality: shaderBufferInt64Atomics, shaderSharedInt64Atomics,
+		//                         VK_EXT_shader_atomic_float
+		vk::vector<vk::PhysicalDevice> deviceList = vk::enumeratePhysicalDevices();
+		vector<tuple<vk::PhysicalDevice, uint32_t, vk::PhysicalDeviceProperties,
+			vk::QueueFamilyProperties>> compatibleDevices;
+		vector<vk::PhysicalDeviceProperties> incompatibleDevices;
+		for(vk::PhysicalDevice pd : deviceList) {
+
+			// device version 1.2+
+			// (we need it for bufferDeviceAddress)
+			vk::PhysicalDeviceProperties props = vk::getPhysicalDeviceProperties(pd);
+			if(props.apiVersion < vk::ApiVersion12) {
+				incompatibleDevices.emplace_back(props);
+				continue;
+			}
+
+			// shaderInt64 and bufferDeviceAddress are required
+			vk::PhysicalDeviceVulkan12Features features12;
+			vk::PhysicalDeviceFeatures2 features10 {
+				.pNext = &features12
+			};
+			vk::getPhysicalDeviceFeatures2(pd, features10);
+			if(features10.features.shaderInt64 == false || features12.bufferDeviceAddress == false) {
+				incompatibleDevices.emplace_back(props);
+				continue;
+			}
+
+			// append compatible queue families
+			vk::vector<vk::QueueFamilyProperties> queueFamilyPropList = vk::getPhysicalDeviceQueueFamilyProperties(pd);
+			bool found = false;
+			for(uint32_t i=0, c=uint32_t(queueFamilyPropList.size()); i<c; i++) {
+
+				// test for compute operations support and for timestamp support
+				vk::QueueFamilyProperties& qfp = queueFamilyPropList[i];
+				if(qfp.queueFlags & vk::QueueFlagBits::eCompute) {
+					if(qfp.timestampValidBits != 0) {
+						found = true;
+						compatibleDevices.emplace_back(pd, i, props, qfp);
+					}
+				}
+
+			}
+
+			// append incompatible devices
+			if(!found)
+				incompatibleDevices.emplace_back(props);
+
+		}
+
+		// print device list
+		cout << "List of devices:" << endl;
+		for(size_t i=0, c=compatibleDevices.size(); i<c; i++) {
+			auto& t = compatibleDevices[i];
+			cout << "   " << i+1 << ": " << get<2>(t).deviceName << " (compute queue family: "
+			     << get<1>(t) << ", type: " << to_cstr(get<2>(t).deviceType) << ")" << endl;
+		}
+		for(size_t i=0, c=incompatibleDevices.size(); i<c; i++) {
+			auto& props = incompatibleDevices[i];
+			cout << "   incompatible: " << props.deviceName
+			     << " (type: " << to_cstr(props.deviceType) << ")" << endl;
+		}
+
+		// handle empty compatibleDevices list
+		if(compatibleDevices.empty()) {
+			cout << "No compatible devices." << endl;
+			return 0;
+		}
+
+		// select the device
+		decltype(compatibleDevices)::iterator selectedDevice;
+		if(deviceFilterString)
+		{
+			// select the device by name and index:
+			// (1) filter devices by name and
+			// (2) on the resulting list, choose the device on the index selectedDeviceIndex-1
+			size_t counter = 1;
+			for(size_t i=0, c=compatibleDevices.size(); i<c; i++) {
+				if(strstr(get<2>(compatibleDevices[i]).deviceName, deviceFilterString)) {
+					if(counter == selectedDeviceIndex || selectedDeviceIndex == 0) {
+						selectedDevice = compatibleDevices.begin() + i;
+						goto deviceFound;
+					}
+					counter++;
+				}
+			}
+
+			// if no device was selected, print error and exit
+			if(counter == 1)
+				cout << "No device selected. Invalid filter string: " << deviceFilterString << "." << endl;
+			else
+				cout << "Invalid device index.\n"
+				     << "Index value: " << selectedDeviceIndex << ", filter string: "
+				     << deviceFilterString << "." << endl;
+			return 99;
+
+		deviceFound:;
+		}
+		else if(selectedDeviceIndex > 0)
+		{
+			// select the device by index
+			if(selectedDeviceIndex > compatibleDevices.size()) {
+				cout << "Invalid device index." << endl;
+				return 99;
+			}
+			selectedDevice = compatibleDevices.begin() + selectedDeviceIndex - 1;
+		}
+		else
+		{
+			// choose the device automatically
+			// using score heuristic
+			selectedDevice = compatibleDevices.begin();
+			constexpr const array deviceTypeScore = {
+				10,  // vk::PhysicalDeviceType::eOther         - lowest score
+				40,  // vk::PhysicalDeviceType::eIntegratedGpu - high score
+				50,  // vk::PhysicalDeviceType::eDiscreteGpu   - highest score
+				30,  // vk::PhysicalDeviceType::eVirtualGpu    - normal score
+				20,  // vk::PhysicalDeviceType::eCpu           - low score
+				10,  // unknown vk::PhysicalDeviceType
+			};
+			int score = deviceTypeScore[clamp(int(get<2>(*selectedDevice).deviceType), 0, int(deviceTypeScore.size())-1)];
+			for(auto it=compatibleDevices.begin()+1; it!=compatibleDevices.end(); it++) {
+				int newScore = deviceTypeScore[clamp(int(get<2>(*it).deviceType), 0, int(deviceTypeScore.size())-1)];
+				if(newScore > score) {
+					selectedDevice = it;
+					score = newScore;
+				}
+			}
+		}
+
+		// device to use
+		cout << "Using device:\n"
+		        "   " << get<2>(*selectedDevice).deviceName << endl;
+		vk::PhysicalDevice pd = get<0>(*selectedDevice);
+		uint32_t queueFamily = get<1>(*selectedDevice);
+		uint32_t timestampValidBits = get<3>(*selectedDevice).timestampValidBits;
+		uint64_t timestampValidBitMask = (timestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << timestampValidBits) - 1;
+		float timestampPeriod = get<2>(*selectedDevice).limits.timestampPeriod;
+
+		// release resources
+		compatibleDevices.clear();
+		incompatibleDevices.clear();
+
+		// optional atomic features
+		// (int64 atomics are part of Vulkan 1.2 features, float atomics are provided by VK_EXT_shader_atomic_float)
+		bool atomicFloatExtensionSupport = false;
+		vk::vector<vk::ExtensionProperties> extensionList =
+			vk::enumerateDeviceExtensionProperties(pd, nullptr);
+		for(const vk::ExtensionProperties& e : extensionList)
+			if(strcmp(e.extensionName, "VK_EXT_shader_atomic_float") == 0)
+				atomicFloatExtensionSupport = true;
+		extensionList.clear();
+		vk::PhysicalDeviceShaderAtomicFloatFeaturesEXT atomicFloatFeatures;
+		vk::PhysicalDeviceVulkan12Features features12 {
+			.pNext = (atomicFloatExtensionSupport) ? &atomicFloatFeatures : nullptr,
+		};
+		vk::PhysicalDeviceFeatures2 features10 { .pNext = &features12 };
+		vk::getPhysicalDeviceFeatures2(pd, features10);
+
+		// supported combinations of data type, memory and operation
+		// (indexed by [dataType][useSharedMemory][operation])
+		bool supported[3][2][3] = {
+			{  // int32 atomics are always supported
+				{ true, true, true },
+				{ true, true, true },
+			},
+			{  // int64
+				{ bool(features12.shaderBufferInt64Atomics), bool(features12.shaderBufferInt64Atomics), bool(features12.shaderBufferInt64Atomics) },
+				{ bool(features12.shaderSharedInt64Atomics), bool(features12.shaderSharedInt64Atomics), bool(features12.shaderSharedInt64Atomics) },
+			},
+			{  // float; compSwap is not available for floats
+				{ bool(atomicFloatFeatures.shaderBufferFloat32AtomicAdd), false, bool(atomicFloatFeatures.shaderBufferFloat32Atomics) },
+				{ bool(atomicFloatFeatures.shaderSharedFloat32AtomicAdd), false, bool(atomicFloatFeatures.shaderSharedFloat32Atomics) },
+			},
+		};
+
+		// float shader contains atomicAdd on both, buffer and shared memory,
+		// so its module requires AtomicFloat32AddEXT capability and it can be used only if float atomicAdd is supported on buffers
+		if(!atomicFloatFeatures.shaderBufferFloat32AtomicAdd)
+			for(auto& m : supported[2])
+				for(bool& b : m)
+					b = false;
+
+		// int64 shader contains 64-bit atomics on both, buffer and shared memory,
+		// so its module can be used only if int64 atomics are supported on both
+		if(!features12.shaderBufferInt64Atomics || !features12.shaderSharedInt64Atomics)
+			for(auto& m : supported[1])
+				for(bool& b : m)
+					b = false;
+
+		// atomic info
+		cout << "Atomic info:" << endl;
+		cout << "   Int64 atomics on buffers:  " << (features12.shaderBufferInt64Atomics ? "supported" : "not supported") << endl;
+		cout << "   Int64 atomics on shared memory:  " << (features12.shaderSharedInt64Atomics ? "supported" : "not supported") << endl;
+		cout << "   Float atomics (VK_EXT_shader_atomic_float):  " << (atomicFloatExtensionSupport ? "supported" : "not supported") << endl;
+		if(atomicFloatExtensionSupport) {
+			cout << "      atomicAdd on buffers:  " << (atomicFloatFeatures.shaderBufferFloat32AtomicAdd ? "supported" : "not supported") << endl;
+			cout << "      atomicExchange on buffers:  " << (atomicFloatFeatures.shaderBufferFloat32Atomics ? "supported" : "not supported") << endl;
+			cout << "      atomicAdd on shared memory:  " << (atomicFloatFeatures.shaderSharedFloat32AtomicAdd ? "supported" : "not supported") << endl;
+			cout << "      atomicExchange on shared memory:  " << (atomicFloatFeatures.shaderSharedFloat32Atomics ? "supported" : "not supported") << endl;
+		}
+
+		// create device
+		vk::initDevice(
+			pd,  // physicalDevice
+			vk::DeviceCreateInfo{  // pCreateInfo
+				.flags = {},
+				.queueCreateInfoCount = 1,
+				.pQueueCreateInfos =
+					array{
+						vk::DeviceQueueCreateInfo{
+							.flags = {},
+							.queueFamilyIndex = queueFamily,
+							.queueCount = 1,
+							.pQueuePriorities = &(const float&)1.f,
+						}
+					}.data(),
+				.enabledLayerCount = 0,  // no enabled layers
+				.ppEnabledLayerNames = nullptr,
+				.enabledExtensionCount = (atomicFloatExtensionSupport) ? 1u : 0u,
+				.ppEnabledExtensionNames =
+					array<const char*, 1>{
+						"VK_EXT_shader_atomic_float",
+					}.data(),
+				.pEnabledFeatures =
+					&(const vk::PhysicalDeviceFeatures&)vk::PhysicalDeviceFeatures{
+						.shaderInt64 = true,
+					},
+			}
+			.setPNext(
+				&(const vk::PhysicalDeviceVulkan12Features&)vk::PhysicalDeviceVulkan12Features{
+					.shaderBufferInt64Atomics = features12.shaderBufferInt64Atomics,
+					.shaderSharedInt64Atomics = features12.shaderSharedInt64Atomics,
+					.bufferDeviceAddress = true,
+				}
+				.setPNext(
+					(atomicFloatExtensionSupport)
+						? &(const vk::PhysicalDeviceShaderAtomicFloatFeaturesEXT&)vk::PhysicalDeviceShaderAtomicFloatFeaturesEXT{
+							  .shaderBufferFloat32Atomics = atomicFloatFeatures.shaderBufferFloat32Atomics,
+							  .shaderBufferFloat32AtomicAdd = atomicFloatFeatures.shaderBufferFloat32AtomicAdd,
+							  .shaderSharedFloat32Atomics = atomicFloatFeatures.shaderSharedFloat32Atomics,
+							  .shaderSharedFloat32AtomicAdd = atomicFloatFeatures.shaderSharedFloat32AtomicAdd,
+						  }
+						: nullptr
+				)
+			)
+		);
+
+		// get queue
+		vk::Queue queue = vk::getDeviceQueue(queueFamily, 0);
+
+		// buffer of counters;
+		// it holds numBufferElements of 64-bit counters and it is reallocated
+		// when the dispatch uses more counters than the buffer holds
+		// (the buffer size is limited to the quarter of the memory heap)
+		vk::UniqueBuffer buffer;
+		vk::UniqueDeviceMemory memory;
+		vk::DeviceAddress bufferAddress = 0;
+		size_t numBufferElements = 0;
+		size_t maxNumBufferElements = 0;
+		uint32_t memoryTypeIndex = ~uint32_t(0);
+		auto allocateBuffer =
+			[&](size_t numElements) {
+
+				// release the previous buffer
+				buffer.reset();
+				memory.reset();
+
+				// buffer
+				buffer =
+					vk::createBufferUnique(
+						vk::BufferCreateInfo{
+							.flags = {},
+							.size = numElements * sizeof(uint64_t),
+							.usage = vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eShaderDeviceAddress |
+							         vk::BufferUsageFlagBits::eTransferDst,
+							.sharingMode = vk::SharingMode::eExclusive,
+							.queueFamilyIndexCount = 0,
+							.pQueueFamilyIndices = nullptr,
+						}
+					);
+
+				// memory type of the buffer;
+				// prefer device-local memory
+				vk::MemoryRequirements memoryRequirements = vk::getBufferMemoryRequirements(buffer);
+				if(memoryTypeIndex == ~uint32_t(0)) {
+					vk::PhysicalDeviceMemoryProperties memoryProperties = vk::getPhysicalDeviceMemoryProperties(pd);
+					for(uint32_t i=0; i<memoryProperties.memoryTypeCount; i++)
+						if(memoryRequirements.memoryTypeBits & (1 << i)) {
+							if(memoryProperties.memoryTypes[i].propertyFlags & vk::MemoryPropertyFlagBits::eDeviceLocal) {
+								memoryTypeIndex = i;
+								break;
+							}
+							if(memoryTypeIndex == ~uint32_t(0))
+								memoryTypeIndex = i;
+						}
+					if(memoryTypeIndex == ~uint32_t(0))
+						throw runtime_error("No suitable memory type found for the buffer.");
+					uint32_t heapIndex = memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+					maxNumBufferElements = size_t(min(memoryProperties.memoryHeaps[heapIndex].size / 4 / sizeof(uint64_t),
+					                                  uint64_t(1) << 32));  // counter indices are 32-bit in the shaders
+				}
+
+				// memory of the buffer
+				memory =
+					vk::allocateMemoryUnique(
+						vk::MemoryAllocateInfo{
+							.pNext =
+								&(const vk::MemoryAllocateFlagsInfo&)vk::MemoryAllocateFlagsInfo{
+									.flags = vk::MemoryAllocateFlagBits::eDeviceAddress,
+									.deviceMask = 0,
+								},
+							.allocationSize = memoryRequirements.size,
+							.memoryTypeIndex = memoryTypeIndex,
+						}
+					);
+				vk::bindBufferMemory(buffer, memory, 0);
+				bufferAddress = vk::getBufferDeviceAddress(buffer);
+				numBufferElements = numElements;
+
+			};
+		allocateBuffer(minNumBufferElements);
+
+		// shader modules
+		array<vk::UniqueShaderModule, 3> shaderModuleList;
+		shaderModuleList[0] =
+			vk::createShaderModuleUnique(
+				vk::ShaderModuleCreateInfo{
+					.flags = {},
+					.codeSize = sizeof(atomicInt32Spirv),
+					.pCode = atomicInt32Spirv,
+				}
+			);
+		if(features12.shaderBufferInt64Atomics && features12.shaderSharedInt64Atomics)
+			shaderModuleList[1] =
+				vk::createShaderModuleUnique(
+					vk::ShaderModuleCreateInfo{
+						.flags = {},
+						.codeSize = sizeof(atomicInt64Spirv),
+						.pCode = atomicInt64Spirv,
+					}
+				);
+		if(atomicFloatFeatures.shaderBufferFloat32AtomicAdd)
+			shaderModuleList[2] =
+				vk::createShaderModuleUnique(
+					vk::ShaderModuleCreateInfo{
+						.flags = {},
+						.codeSize = sizeof(atomicFloatSpirv),
+						.pCode = atomicFloatSpirv,
+					}
+				);
+
+		// pipeline layout
+		// (push constant holds the device address of the buffer)
+		vk::UniquePipelineLayout pipelineLayout =
+			vk::createPipelineLayoutUnique(
+				vk::PipelineLayoutCreateInfo{
+					.flags = {},
+					.setLayoutCount = 0,
+					.pSetLayouts = nullptr,
+					.pushConstantRangeCount = 1,
+					.pPushConstantRanges =
+						&(const vk::PushConstantRange&)vk::PushConstantRange{
+							.stageFlags = vk::ShaderStageFlagBits::eCompute,
+							.offset = 0,
+							.size = sizeof(uint64_t),
+						},
+				}
+			);
+
+		// test list;
+		// there is one test for each supported combination of data type, memory, operation and contention level
+		// (one global counter is not tested on shared memory as it is the same as the counter per workgroup)
+		struct Test {
+			uint32_t dataType;
+			bool useSharedMemory;
+			uint32_t operation;
+			uint32_t contention;
+			vk::UniquePipeline pipeline;
+			size_t numWorkgroups = 1;
+			float lastTime;
+			vector<float> performanceList;
+		};
+		vector<Test> testList;
+
+		// create pipelines
+		cout << "Creating pipelines..." << flush;
+		chrono::time_point creationStart = chrono::high_resolution_clock::now();
+		for(uint32_t dataType=0; dataType<3; dataType++)
+			for(bool useSharedMemory : { false, true })
+				for(uint32_t operation=0; operation<3; operation++) {
+					if(!supported[dataType][useSharedMemory][operation])
+						continue;
+					for(uint32_t contention=(useSharedMemory)?1:0; contention<4; contention++) {
+
+						struct SpecializationData {
+							uint32_t operation;
+							uint32_t contention;
+							vk::Bool32 useSharedMemory;
+						} specializationData = { operation, contention, useSharedMemory };
+						array<vk::SpecializationMapEntry, 3> mapEntries = {
+							vk::SpecializationMapEntry{
+								.constantID = 0,
+								.offset = offsetof(SpecializationData, operation),
+								.size = sizeof(uint32_t),
+							},
+							vk::SpecializationMapEntry{
+								.constantID = 1,
+								.offset = offsetof(SpecializationData, contention),
+								.size = sizeof(uint32_t),
+							},
+							vk::SpecializationMapEntry{
+								.constantID = 2,
+								.offset = offsetof(SpecializationData, useSharedMemory),
+								.size = sizeof(vk::Bool32),
+							},
+						};
+						testList.emplace_back(
+							dataType,
+							useSharedMemory,
+							operation,
+							contention,
+							vk::createComputePipelineUnique(
+								nullptr,
+								vk::ComputePipelineCreateInfo{
+									.flags = {},
+									.stage =
+										vk::PipelineShaderStageCreateInfo{
+											.flags = {},
+											.stage = vk::ShaderStageFlagBits::eCompute,
+											.module = shaderModuleList[dataType],
+											.pName = "main",
+											.pSpecializationInfo =
+												&(const vk::SpecializationInfo&)vk::SpecializationInfo{
+													.mapEntryCount = uint32_t(mapEntries.size()),
+													.pMapEntries = mapEntries.data(),
+													.dataSize = sizeof(SpecializationData),
+													.pData = &specializationData,
+												},
+										},
+									.layout = pipelineLayout,
+									.basePipelineHandle = nullptr,
+									.basePipelineIndex = -1,
+								}
+							)
+						);
+
+					}
+				}
+		chrono::time_point creationEnd = chrono::high_resolution_clock::now();
+		cout << " done.\n   " << testList.size() << " pipelines were created in "
+		     << chrono::duration<float>(creationEnd - creationStart).count() * 1e3 << "ms." << endl;
+
+		// timestamp pool
+		vk::UniqueQueryPool timestampPool =
+			vk::createQueryPoolUnique(
+				vk::QueryPoolCreateInfo{
+					.flags = {},
+					.queryType = vk::QueryType::eTimestamp,
+					.queryCount = 2,
+					.pipelineStatistics = {},
+				}
+			);
+
+		// command pool
+		vk::UniqueCommandPool commandPool =
+			vk::createCommandPoolUnique(
+				vk::CommandPoolCreateInfo{
+					.flags = vk::CommandPoolCreateFlagBits::eTransient |
+					         vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+					.queueFamilyIndex = queueFamily,
+				}
+			);
+
+		// allocate command buffer
+		vk::CommandBuffer commandBuffer =
+			vk::allocateCommandBuffer(
+				vk::CommandBufferAllocateInfo{
+					.commandPool = commandPool,
+					.level = vk::CommandBufferLevel::ePrimary,
+					.commandBufferCount = 1,
+				}
+			);
+
+		// fence
+		vk::UniqueFence computingFinishedFence =
+			vk::createFenceUnique(
+				vk::FenceCreateInfo{
+					.flags = {}
+				}
+			);
+
+		// submit the command buffer and wait for its completion
+		auto submitAndWait =
+			[&]() {
+
+				// submit work
+				vk::queueSubmit(
+					queue,
+					vk::SubmitInfo{
+						.waitSemaphoreCount = 0,
+						.pWaitSemaphores = nullptr,
+						.pWaitDstStageMask = nullptr,
+						.commandBufferCount = 1,
+						.pCommandBuffers = &commandBuffer,
+						.signalSemaphoreCount = 0,
+						.pSignalSemaphores = nullptr,
+					},
+					computingFinishedFence
+				);
+
+				// wait for the work
+				vk::Result r =
+					vk::waitForFence_noThrow(
+						computingFinishedFence,
+						uint64_t(1.5e9)  // timeout (1.5 seconds)
+					);
+				if(r == vk::Result::eTimeout) {
+					cout << "Vulkan device timeout. Task is probably hanging." << endl;
+					// use std::quick_exit() to terminate the application
+					// (Do not throw, do not return, do not call std::exit().
+					// The device is still busy and it uses number of handles such as
+					// computingFinishedFence and device handle itself.
+					// Destruction of the handles in use or the unallowed access to them
+					// is forbidden by Vulkan specification.
+					quick_exit(-1);
+				} else
+					vk::checkForSuccessValue(r, "vkWaitForFences");
+
+				// reset fence
+				vk::resetFence(computingFinishedFence);
+
+			};
+
+		// zero the counters
+		auto zeroCounters =
+			[&]() {
+				vk::beginCommandBuffer(
+					commandBuffer,
+					vk::CommandBufferBeginInfo{
+						.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+						.pInheritanceInfo = nullptr,
+					}
+				);
+				vk::cmdFillBuffer(commandBuffer, buffer, 0, numBufferElements * sizeof(uint64_t), 0);
+				vk::cmdPipelineBarrier(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eTransfer,  // srcStageMask
+					vk::PipelineStageFlagBits::eComputeShader,  // dstStageMask
+					vk::DependencyFlags(),  // dependencyFlags
+					1,  // memoryBarrierCount
+					&(const vk::MemoryBarrier&)vk::MemoryBarrier{  // pMemoryBarriers
+						.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+						.dstAccessMask = vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite,
+					},
+					0, nullptr,  // bufferMemoryBarrierCount, pBufferMemoryBarriers
+					0, nullptr  // imageMemoryBarrierCount, pImageMemoryBarriers
+				);
+				vk::endCommandBuffer(commandBuffer);
+				submitAndWait();
+			};
+		zeroCounters();
+
+		auto performTest =
+			[&](vk::Pipeline pipeline, size_t numWorkgroups) -> float {
+
+				// begin command buffer
+				vk::beginCommandBuffer(
+					commandBuffer,
+					vk::CommandBufferBeginInfo{
+						.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+						.pInheritanceInfo = nullptr,
+					}
+				);
+
+				// reset timestamp pool
+				vk::cmdResetQueryPool(
+					commandBuffer,
+					timestampPool,
+					0,  // firstQuery
+					2);  // queryCount
+
+				// bind pipeline
+				vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+
+				// set push constants
+				vk::cmdPushConstants(
+					commandBuffer,
+					pipelineLayout,
+					vk::ShaderStageFlagBits::eCompute,
+					0,  // offset
+					sizeof(uint64_t),  // size
+					&bufferAddress  // pValues
+				);
+
+				// write timestamp 0
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eTopOfPipe,
+					timestampPool,
+					0);  // query
+
+				// dispatch computation
+				// (avoid any dimension to go over 10000)
+				uint32_t workgroupCountX;
+				uint32_t workgroupCountY;
+				uint32_t workgroupCountZ;
+				if(numWorkgroups > 10000 * 10000) {
+					workgroupCountZ = 1 + ((numWorkgroups - 1) / (10000 * 10000));
+					uint64_t remainder = numWorkgroups / workgroupCountZ;
+					workgroupCountY = 1 + ((remainder - 1) / 10000);
+					workgroupCountX = remainder / workgroupCountY;
+				}
+				else {
+					if(numWorkgroups == 0)
+						numWorkgroups = 1;
+					workgroupCountZ = 1;
+					workgroupCountY = 1 + ((numWorkgroups - 1) / 10000);
+					workgroupCountX = numWorkgroups / workgroupCountY;
+				}
+				vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
+
+				// write timestamp 1
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eBottomOfPipe,
+					timestampPool,
+					1);  // query
+
+				// end command buffer
+				vk::endCommandBuffer(commandBuffer);
+
+				// submit the work and wait for it
+				submitAndWait();
+
+				// read timestamps
+				array<uint64_t, 2> timestamps;
+				vk::getQueryPoolResults(
+					timestampPool,  // queryPool
+					0,  // firstQuery
+					2,  // queryCount
+					2 * sizeof(uint64_t),  // dataSize
+					timestamps.data(),  // pData
+					sizeof(uint64_t),  // stride
+					vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait  // flags
+				);
+
+				// return time as float in seconds
+				return float((timestamps[1] - timestamps[0]) & timestampValidBitMask) * timestampPeriod / 1e9;
+
+			};
+
+		// record the performance in atomic operations per second
+		auto processResult =
+			[](float time, size_t numWorkgroups, vector<float>& performanceList) {
+				if(time >= minTimeOfValidMeasurement) {
+					uint64_t numOperations = uint64_t(operationsPerInvocation) * workgroupSize * numWorkgroups;
+					float performance = float(numOperations) / time;
+					performanceList.push_back(performance);
+				}
+			};
+
+		// compute number of workgroups in the next iteration
+		// to eventually reach singleMeasurementTargetTime
+		auto computeNumWorkgroups =
+			[](size_t lastNumWorkgroups, float lastTime) -> size_t
+			{
+				if(lastTime < (singleMeasurementTargetTime / maxNumWorkgroupsMultiplier)) {
+					// multiply numWorkgroups by maxNumWorkgroupsMultiplier
+					return lastNumWorkgroups * maxNumWorkgroupsMultiplier;
+				}
+				else {
+					// multiply numWorkgroups by ratio
+					float ratio = singleMeasurementTargetTime / lastTime;
+					size_t newNumWorkgroups = size_t(lastNumWorkgroups * ratio);
+					return (newNumWorkgroups >= 1) ? newNumWorkgroups : 1;
+				}
+			};
+
+		// number of counters in the buffer used by the dispatch of numWorkgroups;
+		// counter per subgroup uses at most as many counters as counter per invocation
+		auto numCountersUsed =
+			[](const Test& t, size_t numWorkgroups) -> size_t {
+				if(t.useSharedMemory || t.contention == 0)
+					return 1;
+				if(t.contention == 1)
+					return numWorkgroups;
+				return numWorkgroups * workgroupSize;
+			};
+
+		cout << "Running tests..." << endl;
+		chrono::time_point startTime = chrono::high_resolution_clock::now();
+		do {
+
+			// perform tests
+			for(Test& t : testList) {
+
+				// grow the buffer, so each counter index of the dispatch has its own counter
+				// (the counters are not wrapped around the buffer as it would change the contention)
+				size_t numCounters = numCountersUsed(t, t.numWorkgroups);
+				if(numCounters > numBufferElements) {
+					allocateBuffer(min(max(numCounters, numBufferElements * 2), maxNumBufferElements));
+					zeroCounters();
+				}
+
+				t.lastTime = performTest(t.pipeline, t.numWorkgroups);
+				processResult(t.lastTime, t.numWorkgroups, t.performanceList);
+			}
+
+			// stop measurements after totalMeasuringTime passed
+			float totalTime = chrono::duration<float>(chrono::high_resolution_clock::now() - startTime).count();
+			if(totalTime >= totalMeasuringTime)
+				break;
+
+			// compute new numWorkgroups;
+			// limit it by the maximal size of the buffer of counters
+			for(Test& t : testList) {
+				t.numWorkgroups = computeNumWorkgroups(t.numWorkgroups, t.lastTime);
+				if(numCountersUsed(t, t.numWorkgroups) > maxNumBufferElements)
+					t.numWorkgroups = max(maxNumBufferElements / numCountersUsed(t, 1), size_t(1));
+			}
+
+		} while(true);
+
+		// sort the results
+		for(Test& t : testList)
+			sort(t.performanceList.begin(), t.performanceList.end());
+
+		// print results
+		auto printResult =
+			[](const string_view text, const vector<float>& performanceList) {
+				cout << text;
+				if(performanceList.empty())
+					cout << "measurement error" << endl;
+				else {
+
+					// print median
+					cout << formatFloatSI(performanceList[performanceList.size()/2]) << "OPS";
+
+					// print dispersion using IQR (Interquartile Range);
+					// Q1 is the value in 25% and Q3 in 75%
+					cout << "  (Q1: " << formatFloatSI(performanceList[performanceList.size()/4]) << "OPS,"
+					        " Q3: " << formatFloatSI(performanceList[(performanceList.size()*3)/4]) << "OPS,"
+					        " num measurements: " << performanceList.size() << ")";
+					cout << endl;
+				}
+			};
+		cout << "Atomic operation throughput\n"
+		        "(operations per second summed over all shader invocations):" << endl;
+		for(uint32_t dataType=0; dataType<3; dataType++)
+			for(bool useSharedMemory : { false, true }) {
+				cout << dataTypeNames[dataType] << (useSharedMemory ? " on shared memory:" : " on buffer:") << endl;
+				bool found = false;
+				for(const Test& t : testList)
+					if(t.dataType == dataType && t.useSharedMemory == useSharedMemory) {
+						printResult(string("   ") + operationNames[t.operation] + contentionNames[t.contention], t.performanceList);
+						found = true;
+					}
+				if(!found)
+					cout << "   not supported" << endl;
+			}
+
+	// catch exceptions
+	} catch(vk::Error& e) {
+		cout << e.what() << endl;
+	} catch(exception& e) {
+		cout << "Failed because of exception: " << e.what() << endl;
+	} catch(...) {
+		cout << "Failed because of unspecified exception." << endl;
+	}
+
+	vk::cleanUp();
+	return 0;
+}
@@ -3,12 +3,14 @@
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
+#include <cstddef>
 #include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <tuple>
 #include <vector>
 #include "vkg.h"
+#include "commandRecycler.h"
 
 using namespace std;
 
@@ -17,12 +19,60 @@ using namespace std;
 constexpr const char* appName = "2-4-AdjustedMeasurement";
 constexpr const float totalMeasuringTime = 3.f;  // total time in seconds for which measurements are made and median time of the measurements is taken at the end
 constexpr const float singleMeasurementTargetTime = 0.02f;  // single measurement time in seconds; the load will be continually adjusted to target this time
+constexpr const uint32_t indirectIterationsPerSubmission = 20;  // number of measurements chained in a single submission in the indirect mode
 
 
 // shader code as SPIR-V binary
 static const uint32_t performanceSpirv[] = {
 #include "performance.comp.spv"
 };
+static const uint32_t adjustSpirv[] = {
+#include "adjust.comp.spv"
+};
+
+
+// Record of a single measurement in the indirect mode.
+//
+// The layout must match IterationRef in adjust.comp.
+// workgroupCount is consumed by vk::cmdDispatchIndirect() as vk::DispatchIndirectCommand.
+struct IndirectIteration {
+	uint32_t workgroupCount[3];
+	uint32_t padding;
+	uint64_t timestamps[2];
+};
+static_assert(sizeof(IndirectIteration) == 32, "IndirectIteration must match IterationRef of adjust.comp.");
+
+
+// Push constants of adjust.comp.
+struct AdjustPushConstants {
+	uint64_t iterationListAddress;
+	uint64_t timestampValidBitMask;
+	uint32_t iteration;
+	float timestampPeriod;  // in nanoseconds
+	float targetTime;  // in seconds
+};
+
+
+// Split number of workgroups into three dimensions.
+//
+// It avoids any dimension to go over 10000.
+// adjust.comp performs the same computation on the GPU.
+static void splitWorkgroups(uint64_t numWorkgroups, uint32_t& workgroupCountX, uint32_t& workgroupCountY, uint32_t& workgroupCountZ)
+{
+	if(numWorkgroups > 10000 * 10000) {
+		workgroupCountZ = 1 + ((numWorkgroups - 1) / (10000 * 10000));
+		uint64_t remainder = numWorkgroups / workgroupCountZ;
+		workgroupCountY = 1 + ((remainder - 1) / 10000);
+		workgroupCountX = remainder / workgroupCountY;
+	}
+	else {
+		if(numWorkgroups == 0)
+			numWorkgroups = 1;
+		workgroupCountZ = 1;
+		workgroupCountY = 1 + ((numWorkgroups - 1) / 10000);
+		workgroupCountX = numWorkgroups / workgroupCountY;
+	}
+}
 
 
 // Convert float value to c-string.
@@ -102,6 +152,8 @@ int main(int argc, char* argv[])
 		bool printHelp = false;
 		size_t selectedDeviceIndex = 0;
 		char* deviceFilterString = nullptr;
+		bool indirectMode = false;
+		RecordingMode recordingMode = RecordingMode::eRerecord;
 		for(int i=1; i<argc; i++) {
 
 			// parse options starting with '-'
@@ -113,6 +165,24 @@ int main(int argc, char* argv[])
 					continue;
 				}
 
+				// indirect mode
+				if(strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--indirect") == 0) {
+					indirectMode = true;
+					continue;
+				}
+
+				// command buffer recording mode
+				if(strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "--recording") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					if(!parseRecordingMode(argv[i], recordingMode))
+						printHelp = true;
+					continue;
+				}
+
 				// parse device index
 				if(argv[i][1] >= '0' && argv[i][1] <= '9') {
 					char* endp = nullptr;
@@ -135,11 +205,24 @@ int main(int argc, char* argv[])
 		if(printHelp) {
 			cout << appName << " prints the performance of a Vulkan device\n"
 			        "\n"
-			        "Usage: " << appName << " [-<deviceIndex>] [deviceNameFilter]\n"
+			        "Usage: " << appName << " [-<deviceIndex>] [-i] [-r <mode>] [deviceNameFilter]\n"
 			        "   -<deviceIndex> - for example -1 or -3, specifies the index\n"
 			        "      of the device used for the performance test; it might be\n"
 			        "      useful when more devices are present in the system;\n"
 			        "      devices are numbered starting from one\n"
+			        "   -i or --indirect - the number of workgroups is adjusted\n"
+			        "      on the GPU by a small compute pass using timestamps\n"
+			        "      and the computation is started by vkCmdDispatchIndirect();\n"
+			        "      " << indirectIterationsPerSubmission << " measurements are chained in a single submission\n"
+			        "   -r <mode> or --recording <mode> - the way the command buffer\n"
+			        "      is prepared for each submission; CPU record+submit cost\n"
+			        "      is printed at the end; mode is one of:\n"
+			        "      rerecord - record the command buffer again (default),\n"
+			        "      pool-reset - reset the command pool by vkResetCommandPool\n"
+			        "         and record the command buffer again,\n"
+			        "      reuse - record a command buffer once per dispatch size\n"
+			        "         and submit it again; the number of workgroups is rounded\n"
+			        "         to two significant digits to make the sizes repeat\n"
 			        "   deviceNameFilter - only devices matching the given string\n"
 			        "      will be considered; for example AMD, GeForce, Intel\n" << endl;
 			return 99;
@@ -170,7 +253,8 @@ int main(int argc, char* argv[])
 		// get compatible and incompatible devices
 		//
 		// required functionality: Vulkan 1.2, shaderInt64, bufferDeviceAddress, compute queue
-		// optional functionality: Vulkan 1.3, pipelineCreationCacheControl
+		// optional functionality: Vulkan 1.3, pipelineCreationCacheControl,
+		//                         timestamp support (required by the indirect mode)
 		vk::vector<vk::PhysicalDevice> deviceList = vk::enumeratePhysicalDevices();
 		vector<tuple<vk::PhysicalDevice, uint32_t, vk::PhysicalDeviceProperties>> compatibleDevices;
 		vector<vk::PhysicalDeviceProperties> incompatibleDevices;
@@ -301,6 +385,13 @@ int main(int argc, char* argv[])
 		vk::PhysicalDevice pd = get<0>(*selectedDevice);
 		uint32_t queueFamily = get<1>(*selectedDevice);
 		bool vulkan13Support = get<2>(*selectedDevice).apiVersion >= vk::ApiVersion13;
+		float timestampPeriod = get<2>(*selectedDevice).limits.timestampPeriod;
+		uint32_t timestampValidBits = vk::getPhysicalDeviceQueueFamilyProperties(pd)[queueFamily].timestampValidBits;
+		uint64_t timestampValidBitMask = (timestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << timestampValidBits) - 1;
+		if(indirectMode && timestampValidBits == 0) {
+			cout << "Timestamps are not supported by the queue. Indirect mode is not available." << endl;
+			indirectMode = false;
+		}
 
 		// release resources
 		compatibleDevices.clear();
@@ -445,25 +536,8 @@ int main(int argc, char* argv[])
 				cout << " done.\n   The pipeline was created in " << delta * 1e3 << "ms." << endl;
 		}
 
-		// command pool
-		vk::UniqueCommandPool commandPool =
-			vk::createCommandPoolUnique(
-				vk::CommandPoolCreateInfo{
-					.flags = vk::CommandPoolCreateFlagBits::eTransient |
-					         vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
-					.queueFamilyIndex = queueFamily,
-				}
-			);
-
-		// allocate command buffer
-		vk::CommandBuffer commandBuffer =
-			vk::allocateCommandBuffer(
-				vk::CommandBufferAllocateInfo{
-					.commandPool = commandPool,
-					.level = vk::CommandBufferLevel::ePrimary,
-					.commandBufferCount = 1,
-				}
-			);
+		// command pool and command buffers
+		CommandRecycler commandRecycler(queueFamily, recordingMode);
 
 		// fence
 		vk::UniqueFence computingFinishedFence =
@@ -478,113 +552,375 @@ int main(int argc, char* argv[])
 		        " Measurement        Number of         Computation     Performance\n"
 		        "  time stamp     local workgroups         time" << endl;
 
-		uint32_t workgroupCountX = 1;
-		uint32_t workgroupCountY = 1;
-		uint32_t workgroupCountZ = 1;
-		chrono::time_point startTime = chrono::high_resolution_clock::now();
-		do {
-
-			// begin command buffer
-			vk::beginCommandBuffer(
-				commandBuffer,
-				vk::CommandBufferBeginInfo{
-					.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
-					.pInheritanceInfo = nullptr,
+		if(indirectMode) {
+
+			// buffer of measurement records
+			// (one more record is allocated for the number of workgroups
+			// computed by the last measurement of the submission)
+			vk::UniqueBuffer iterationBuffer =
+				vk::createBufferUnique(
+					vk::BufferCreateInfo{
+						.flags = {},
+						.size = (indirectIterationsPerSubmission + 1) * sizeof(IndirectIteration),
+						.usage = vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eIndirectBuffer |
+						         vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eShaderDeviceAddress,
+						.sharingMode = vk::SharingMode::eExclusive,
+						.queueFamilyIndexCount = 0,
+						.pQueueFamilyIndices = nullptr,
+					}
+				);
+
+			// memory of the buffer;
+			// it must be host visible and coherent as the records are printed by the CPU
+			vk::MemoryRequirements memoryRequirements = vk::getBufferMemoryRequirements(iterationBuffer);
+			vk::PhysicalDeviceMemoryProperties memoryProperties = vk::getPhysicalDeviceMemoryProperties(pd);
+			uint32_t memoryTypeIndex = ~uint32_t(0);
+			for(uint32_t i=0; i<memoryProperties.memoryTypeCount; i++)
+				if(memoryRequirements.memoryTypeBits & (1 << i))
+					if((memoryProperties.memoryTypes[i].propertyFlags & (vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)) ==
+					   (vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent))
+					{
+						memoryTypeIndex = i;
+						break;
+					}
+			if(memoryTypeIndex == ~uint32_t(0))
+				throw runtime_error("No suitable memory type found for the buffer.");
+			vk::UniqueDeviceMemory iterationMemory =
+				vk::allocateMemoryUnique(
+					vk::MemoryAllocateInfo{
+						.pNext =
+							&(const vk::MemoryAllocateFlagsInfo&)vk::MemoryAllocateFlagsInfo{
+								.flags = vk::MemoryAllocateFlagBits::eDeviceAddress,
+								.deviceMask = 0,
+							},
+						.allocationSize = memoryRequirements.size,
+						.memoryTypeIndex = memoryTypeIndex,
+					}
+				);
+			vk::bindBufferMemory(iterationBuffer, iterationMemory, 0);
+			IndirectIteration* iterationList = reinterpret_cast<IndirectIteration*>(
+				vk::mapMemory(iterationMemory, 0, memoryRequirements.size));
+			iterationList[0] = { .workgroupCount = { 1, 1, 1 } };
+
+			// adjust pipeline
+			// (it computes the number of workgroups of the next measurement)
+			vk::UniqueShaderModule adjustShaderModule =
+				vk::createShaderModuleUnique(
+					vk::ShaderModuleCreateInfo{
+						.flags = {},
+						.codeSize = sizeof(adjustSpirv),
+						.pCode = adjustSpirv,
+					}
+				);
+			vk::UniquePipelineLayout adjustPipelineLayout =
+				vk::createPipelineLayoutUnique(
+					vk::PipelineLayoutCreateInfo{
+						.flags = {},
+						.setLayoutCount = 0,
+						.pSetLayouts = nullptr,
+						.pushConstantRangeCount = 1,
+						.pPushConstantRanges =
+							&(const vk::PushConstantRange&)vk::PushConstantRange{
+								.stageFlags = vk::ShaderStageFlagBits::eCompute,
+								.offset = 0,
+								.size = sizeof(AdjustPushConstants),
+							},
+					}
+				);
+			vk::UniquePipeline adjustPipeline =
+				vk::createComputePipelineUnique(
+					nullptr,
+					vk::ComputePipelineCreateInfo{
+						.flags = {},
+						.stage =
+							vk::PipelineShaderStageCreateInfo{
+								.flags = {},
+								.stage = vk::ShaderStageFlagBits::eCompute,
+								.module = adjustShaderModule,
+								.pName = "main",
+								.pSpecializationInfo = nullptr,
+							},
+						.layout = adjustPipelineLayout,
+						.basePipelineHandle = nullptr,
+						.basePipelineIndex = -1,
+					}
+				);
+			AdjustPushConstants pushConstants{
+				.iterationListAddress = vk::getBufferDeviceAddress(iterationBuffer),
+				.timestampValidBitMask = timestampValidBitMask,
+				.iteration = 0,
+				.timestampPeriod = timestampPeriod,
+				.targetTime = singleMeasurementTargetTime,
+			};
+
+			// timestamp pool
+			vk::UniqueQueryPool timestampPool =
+				vk::createQueryPoolUnique(
+					vk::QueryPoolCreateInfo{
+						.flags = {},
+						.queryType = vk::QueryType::eTimestamp,
+						.queryCount = 2 * indirectIterationsPerSubmission,
+						.pipelineStatistics = {},
+					}
+				);
+
+			uint64_t firstTimestamp = 0;
+			chrono::time_point startTime = chrono::high_resolution_clock::now();
+			do {
+
+				// get command buffer
+				// (the number of workgroups is read by vkCmdDispatchIndirect() from iterationBuffer,
+				// so the recorded commands are the same in all submissions)
+				bool needsRecording;
+				vk::CommandBuffer commandBuffer = commandRecycler.begin(pipeline, 0, 0, 0, needsRecording);
+				if(needsRecording) {
+
+					// reset timestamp pool
+					vk::cmdResetQueryPool(commandBuffer, timestampPool, 0, 2 * indirectIterationsPerSubmission);
+
+					// chain the measurements
+					// without any CPU round trip in between
+					for(uint32_t i=0; i<indirectIterationsPerSubmission; i++) {
+
+						// dispatch computation surrounded by timestamps;
+						// the first timestamp waits for the compute shader stage of the previous adjust pass
+						vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+						vk::cmdWriteTimestamp(commandBuffer, vk::PipelineStageFlagBits::eComputeShader, timestampPool, 2*i);
+						vk::cmdDispatchIndirect(commandBuffer, iterationBuffer, i * sizeof(IndirectIteration));
+						vk::cmdWriteTimestamp(commandBuffer, vk::PipelineStageFlagBits::eBottomOfPipe, timestampPool, 2*i+1);
+
+						// copy timestamps into the measurement record
+						vk::cmdCopyQueryPoolResults(
+							commandBuffer,
+							timestampPool,  // queryPool
+							2*i,  // firstQuery
+							2,  // queryCount
+							iterationBuffer,  // dstBuffer
+							i * sizeof(IndirectIteration) + offsetof(IndirectIteration, timestamps),  // dstOffset
+							sizeof(uint64_t),  // stride
+							vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait  // flags
+						);
+						vk::cmdPipelineBarrier(
+							commandBuffer,
+							vk::PipelineStageFlagBits::eTransfer,  // srcStageMask
+							vk::PipelineStageFlagBits::eComputeShader,  // dstStageMask
+							vk::DependencyFlags(),  // dependencyFlags
+							1,  // memoryBarrierCount
+							&(const vk::MemoryBarrier&)vk::MemoryBarrier{  // pMemoryBarriers
+								.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+								.dstAccessMask = vk::AccessFlagBits::eShaderRead,
+							},
+							0, nullptr, 0, nullptr  // no buffer and image barriers
+						);
+
+						// compute number of workgroups of the next measurement
+						// and make it visible to vkCmdDispatchIndirect() and to the next adjust pass
+						// (the next adjust pass reads the workgroupCount written here)
+						vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, adjustPipeline);
+						pushConstants.iteration = i;
+						vk::cmdPushConstants(commandBuffer, adjustPipelineLayout, vk::ShaderStageFlagBits::eCompute,
+						                     0, sizeof(AdjustPushConstants), &pushConstants);
+						vk::cmdDispatch(commandBuffer, 1, 1, 1);
+						vk::cmdPipelineBarrier(
+							commandBuffer,
+							vk::PipelineStageFlagBits::eComputeShader,  // srcStageMask
+							vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eComputeShader,  // dstStageMask
+							vk::DependencyFlags(),  // dependencyFlags
+							1,  // memoryBarrierCount
+							&(const vk::MemoryBarrier&)vk::MemoryBarrier{  // pMemoryBarriers
+								.srcAccessMask = vk::AccessFlagBits::eShaderWrite,
+								.dstAccessMask = vk::AccessFlagBits::eIndirectCommandRead | vk::AccessFlagBits::eShaderRead,
+							},
+							0, nullptr, 0, nullptr  // no buffer and image barriers
+						);
+
+					}
+
+					// make the records visible to the host
+					vk::cmdPipelineBarrier(
+						commandBuffer,
+						vk::PipelineStageFlagBits::eComputeShader | vk::PipelineStageFlagBits::eTransfer,  // srcStageMask
+						vk::PipelineStageFlagBits::eHost,  // dstStageMask
+						vk::DependencyFlags(),  // dependencyFlags
+						1,  // memoryBarrierCount
+						&(const vk::MemoryBarrier&)vk::MemoryBarrier{  // pMemoryBarriers
+							.srcAccessMask = vk::AccessFlagBits::eShaderWrite | vk::AccessFlagBits::eTransferWrite,
+							.dstAccessMask = vk::AccessFlagBits::eHostRead,
+						},
+						0, nullptr, 0, nullptr  // no buffer and image barriers
+					);
+
+					// end command buffer
+					vk::endCommandBuffer(commandBuffer);
 				}
-			);
 
-			// bind pipeline
-			vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
-
-			// dispatch computation
-			vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
-
-			// end command buffer
-			vk::endCommandBuffer(commandBuffer);
-
-
-			// submit work
-			chrono::time_point t1 = chrono::high_resolution_clock::now();
-			vk::queueSubmit(
-				queue,
-				vk::SubmitInfo{
-					.waitSemaphoreCount = 0,
-					.pWaitSemaphores = nullptr,
-					.pWaitDstStageMask = nullptr,
-					.commandBufferCount = 1,
-					.pCommandBuffers = &commandBuffer,
-					.signalSemaphoreCount = 0,
-					.pSignalSemaphores = nullptr,
-				},
-				computingFinishedFence
-			);
+				// submit work
+				vk::queueSubmit(
+					queue,
+					vk::SubmitInfo{
+						.waitSemaphoreCount = 0,
+						.pWaitSemaphores = nullptr,
+						.pWaitDstStageMask = nullptr,
+						.commandBufferCount = 1,
+						.pCommandBuffers = &commandBuffer,
+						.signalSemaphoreCount = 0,
+						.pSignalSemaphores = nullptr,
+					},
+					computingFinishedFence
+				);
+				commandRecycler.submitted();
+
+				// wait for the work
+				vk::Result r =
+					vk::waitForFence_noThrow(
+						computingFinishedFence,
+						uint64_t(1.5e9)  // timeout (1.5 seconds)
+					);
+				if(r == vk::Result::eTimeout) {
+					cout << "Vulkan device timeout. Task is probably hanging." << endl;
+					// use std::quick_exit() to terminate the application
+					// (Do not throw, do not return, do not call std::exit().
+					// The device is still busy and it uses number of handles such as
+					// computingFinishedFence and device handle itself.
+					// Destruction of the handles in use or the unallowed access to them
+					// is forbidden by Vulkan specification.
+					quick_exit(-1);
+				} else
+					vk::checkForSuccessValue(r, "vkWaitForFences");
+
+				// reset fence
+				vk::resetFence(computingFinishedFence);
+
+				// print results
+				if(firstTimestamp == 0)
+					firstTimestamp = iterationList[0].timestamps[0];
+				for(uint32_t i=0; i<indirectIterationsPerSubmission; i++) {
+					IndirectIteration& it = iterationList[i];
+					float time = float((it.timestamps[1] - it.timestamps[0]) & timestampValidBitMask) * timestampPeriod / 1e9;
+					float timestampTime = float((it.timestamps[1] - firstTimestamp) & timestampValidBitMask) * timestampPeriod / 1e9;
+					uint64_t numWorkgroups = uint64_t(it.workgroupCount[0]) * it.workgroupCount[1] * it.workgroupCount[2];
+					uint64_t numInstructions = uint64_t(20000) * 128 * numWorkgroups;
+					cout << fixed << setprecision(2)
+					     << setw(9) << timestampTime * 1000 << "ms       "
+					     << setw(9) << numWorkgroups << "        "
+					     << "     " << formatFloatSI(time) << "s   "
+					     << "    " << formatFloatSI(float(numInstructions) / time) << "FLOPS" << endl;
+				}
 
-			// wait for the work
-			vk::Result r =
-				vk::waitForFence_noThrow(
-					computingFinishedFence,
-					uint64_t(1.5e9)  // timeout (1.5 seconds)
+				// stop measurements after totalMeasuringTime passed
+				float totalTime = chrono::duration<float>(chrono::high_resolution_clock::now() - startTime).count();
+				if(totalTime >= totalMeasuringTime)
+					break;
+
+				// continue by the number of workgroups computed by the last measurement
+				iterationList[0] = iterationList[indirectIterationsPerSubmission];
+
+			} while(true);
+
+		}
+		else {
+
+			uint32_t workgroupCountX = 1;
+			uint32_t workgroupCountY = 1;
+			uint32_t workgroupCountZ = 1;
+			chrono::time_point startTime = chrono::high_resolution_clock::now();
+			do {
+
+				// get command buffer
+				// (depending on recordingMode, it needs to be recorded or it was already recorded)
+				bool needsRecording;
+				vk::CommandBuffer commandBuffer =
+					commandRecycler.begin(pipeline, workgroupCountX, workgroupCountY, workgroupCountZ, needsRecording);
+				if(needsRecording) {
+
+					// bind pipeline
+					vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+
+					// dispatch computation
+					vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
+
+					// end command buffer
+					vk::endCommandBuffer(commandBuffer);
+				}
+
+
+				// submit work
+				chrono::time_point t1 = chrono::high_resolution_clock::now();
+				vk::queueSubmit(
+					queue,
+					vk::SubmitInfo{
+						.waitSemaphoreCount = 0,
+						.pWaitSemaphores = nullptr,
+						.pWaitDstStageMask = nullptr,
+						.commandBufferCount = 1,
+						.pCommandBuffers = &commandBuffer,
+						.signalSemaphoreCount = 0,
+						.pSignalSemaphores = nullptr,
+					},
+					computingFinishedFence
 				);
-			chrono::time_point t2 = chrono::high_resolution_clock::now();
-			if(r == vk::Result::eTimeout) {
-				cout << "Vulkan device timeout. Task is probably hanging." << endl;
-				// use std::quick_exit() to terminate the application
-				// (Do not throw, do not return, do not call std::exit().
-				// The device is still busy and it uses number of handles such as
-				// computingFinishedFence and device handle itself.
-				// Destruction of the handles in use or the unallowed access to them
-				// is forbidden by Vulkan specification.
-				quick_exit(-1);
-			} else
-				vk::checkForSuccessValue(r, "vkWaitForFences");
-
-			// reset fence
-			vk::resetFence(computingFinishedFence);
-
-			// print results
-			float time = chrono::duration<float>(t2 - t1).count();
-			float totalTime = chrono::duration<float>(t2 - startTime).count();
-			uint64_t numInstructions = uint64_t(20000) * 128 * workgroupCountX * workgroupCountY * workgroupCountZ;
-			cout << fixed << setprecision(2)
-			     << setw(9) << totalTime * 1000 << "ms       "
-			     << setw(9) << workgroupCountX * workgroupCountY * workgroupCountZ << "        "
-			     << "     " << formatFloatSI(time) << "s   "
-			     << "    " << formatFloatSI(float(numInstructions) / time) << "FLOPS" << endl;
-
-			// stop measurements after totalMeasuringTime passed
-			if(totalTime >= totalMeasuringTime)
-				break;
-
-			// update number of local workgroups
-			// to reach computation time given by singleMeasurementTargetTime;
-			// just do not increase number of local workgroups more than ten times
-			if(time < singleMeasurementTargetTime / 10.f) {
-				if(workgroupCountX <= 1000)
-					workgroupCountX *= 10;
-				else if(workgroupCountY <= 1000)
-					workgroupCountY *= 10;
-				else if(workgroupCountZ <= 1000)
-					workgroupCountZ *= 10;
-			}
-			else {
-				float ratio = singleMeasurementTargetTime / time;
-				uint64_t newNumGroups = uint64_t(ratio * (uint64_t(workgroupCountX) * workgroupCountY * workgroupCountZ));
-				if(newNumGroups > 10000 * 10000) {
-					workgroupCountZ = 1 + ((newNumGroups - 1) / (10000 * 10000));
-					uint64_t remainder = newNumGroups / workgroupCountZ;
-					workgroupCountY = 1 + ((remainder - 1) / 10000);
-					workgroupCountX = remainder / workgroupCountY;
+				commandRecycler.submitted();
+
+				// wait for the work
+				vk::Result r =
+					vk::waitForFence_noThrow(
+						computingFinishedFence,
+						uint64_t(1.5e9)  // timeout (1.5 seconds)
+					);
+				chrono::time_point t2 = chrono::high_resolution_clock::now();
+				if(r == vk::Result::eTimeout) {
+					cout << "Vulkan device timeout. Task is probably hanging." << endl;
+					// use std::quick_exit() to terminate the application
+					// (Do not throw, do not return, do not call std::exit().
+					// The device is still busy and it uses number of handles such as
+					// computingFinishedFence and device handle itself.
+					// Destruction of the handles in use or the unallowed access to them
+					// is forbidden by Vulkan specification.
+					quick_exit(-1);
+				} else
+					vk::checkForSuccessValue(r, "vkWaitForFences");
+
+				// reset fence
+				vk::resetFence(computingFinishedFence);
+
+				// print results
+				float time = chrono::duration<float>(t2 - t1).count();
+				float totalTime = chrono::duration<float>(t2 - startTime).count();
+				uint64_t numInstructions = uint64_t(20000) * 128 * workgroupCountX * workgroupCountY * workgroupCountZ;
+				cout << fixed << setprecision(2)
+				     << setw(9) << totalTime * 1000 << "ms       "
+				     << setw(9) << workgroupCountX * workgroupCountY * workgroupCountZ << "        "
+				     << "     " << formatFloatSI(time) << "s   "
+				     << "    " << formatFloatSI(float(numInstructions) / time) << "FLOPS" << endl;
+
+				// stop measurements after totalMeasuringTime passed
+				if(totalTime >= totalMeasuringTime)
+					break;
+
+				// update number of local workgroups
+				// to reach computation time given by singleMeasurementTargetTime;
+				// just do not increase number of local workgroups more than ten times
+				if(time < singleMeasurementTargetTime / 10.f) {
+					if(workgroupCountX <= 1000)
+						workgroupCountX *= 10;
+					else if(workgroupCountY <= 1000)
+						workgroupCountY *= 10;
+					else if(workgroupCountZ <= 1000)
+						workgroupCountZ *= 10;
 				}
 				else {
-					if(newNumGroups == 0)
-						newNumGroups = 1;
-					workgroupCountZ = 1;
-					workgroupCountY = 1 + ((newNumGroups - 1) / 10000);
-					workgroupCountX = newNumGroups / workgroupCountY;
+					float ratio = singleMeasurementTargetTime / time;
+					uint64_t newNumGroups = uint64_t(ratio * (uint64_t(workgroupCountX) * workgroupCountY * workgroupCountZ));
+					newNumGroups = commandRecycler.roundNumWorkgroups(newNumGroups);
+					splitWorkgroups(newNumGroups, workgroupCountX, workgroupCountY, workgroupCountZ);
 				}
-			}
 
-		} while(true);
+			} while(true);
+
+		}
+
+		// print CPU cost of command buffer recording and submission
+		commandRecycler.printStatistics();
 
 	// catch exceptions
 	} catch(vk::Error& e) {
@@ -6784,6 +6784,14 @@ struct BufferDeviceAddressInfo {
 using BufferDeviceAddressInfoKHR = BufferDeviceAddressInfo;
 using BufferDeviceAddressInfoEXT = BufferDeviceAddressInfo;
 
+struct MemoryAllocateFlagsInfo {
+	vk::StructureType sType = StructureType::eMemoryAllocateFlagsInfo;
+	const void*    pNext = {};
+	vk::MemoryAllocateFlags    flags = {};
+	uint32_t    deviceMask = {};
+};
+using MemoryAllocateFlagsInfoKHR = MemoryAllocateFlagsInfo;
+
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
 struct SurfaceFullScreenExclusiveInfoEXT {
 	vk::StructureType sType = StructureType::eSurfaceFullScreenExclusiveInfoEXT;
@@ -13254,6 +13262,40 @@ inline void deviceWaitIdle_throw()  { deviceWaitIdle_throw(device()); }
 inline Result deviceWaitIdle_noThrow() noexcept { return deviceWaitIdle_noThrow(device()); }
 inline void deviceWaitIdle()  { deviceWaitIdle_throw(device()); }
 
+inline Buffer createBuffer_throw(const BufferCreateInfo& createInfo)  { Buffer::HandleType h; Result r = funcs.vkCreateBuffer(detail::_device.handle(), &createInfo, nullptr, &h); detail::processResult(r, h, "vkCreateBuffer"); return h; }
+inline Result createBuffer_noThrow(const BufferCreateInfo& createInfo, Buffer& buffer) noexcept  { return funcs.vkCreateBuffer(detail::_device.handle(), &createInfo, nullptr, reinterpret_cast<Buffer::HandleType*>(&buffer)); }
+inline Buffer createBuffer(const BufferCreateInfo& createInfo)  { return createBuffer_throw(createInfo); }
+inline UniqueBuffer createBufferUnique_throw(const BufferCreateInfo& createInfo)  { return UniqueBuffer(createBuffer_throw(createInfo)); }
+inline Result createBufferUnique_noThrow(const BufferCreateInfo& createInfo, UniqueBuffer& buffer) noexcept  { buffer.reset(); return funcs.vkCreateBuffer(detail::_device.handle(), &createInfo, nullptr, reinterpret_cast<Buffer::HandleType*>(&buffer)); }
+inline UniqueBuffer createBufferUnique(const BufferCreateInfo& createInfo)  { return createBufferUnique_throw(createInfo); }
+
+inline void destroyBuffer(Buffer buffer) noexcept  { funcs.vkDestroyBuffer(detail::_device.handle(), buffer.handle(), nullptr); }
+inline void destroy(Buffer buffer) noexcept  { funcs.vkDestroyBuffer(detail::_device.handle(), buffer.handle(), nullptr); }
+
+inline MemoryRequirements getBufferMemoryRequirements(Buffer buffer) noexcept  { MemoryRequirements m; funcs.vkGetBufferMemoryRequirements(detail::_device.handle(), buffer.handle(), &m); return m; }
+
+inline DeviceAddress getBufferDeviceAddress(const BufferDeviceAddressInfo& info) noexcept  { return funcs.vkGetBufferDeviceAddress(detail::_device.handle(), &info); }
+inline DeviceAddress getBufferDeviceAddress(Buffer buffer) noexcept  { BufferDeviceAddressInfo info{ .buffer = buffer }; return funcs.vkGetBufferDeviceAddress(detail::_device.handle(), &info); }
+
+inline DeviceMemory allocateMemory_throw(const MemoryAllocateInfo& allocateInfo)  { DeviceMemory::HandleType h; Result r = funcs.vkAllocateMemory(detail::_device.handle(), &allocateInfo, nullptr, &h); detail::processResult(r, h, "vkAllocateMemory"); return h; }
+inline Result allocateMemory_noThrow(const MemoryAllocateInfo& allocateInfo, DeviceMemory& memory) noexcept  { return funcs.vkAllocateMemory(detail::_device.handle(), &allocateInfo, nullptr, reinterpret_cast<DeviceMemory::HandleType*>(&memory)); }
+inline DeviceMemory allocateMemory(const MemoryAllocateInfo& allocateInfo)  { return allocateMemory_throw(allocateInfo); }
+inline UniqueDeviceMemory allocateMemoryUnique_throw(const MemoryAllocateInfo& allocateInfo)  { return UniqueDeviceMemory(allocateMemory_throw(allocateInfo)); }
+inline Result allocateMemoryUnique_noThrow(const MemoryAllocateInfo& allocateInfo, UniqueDeviceMemory& memory) noexcept  { memory.reset(); return funcs.vkAllocateMemory(detail::_device.handle(), &allocateInfo, nullptr, reinterpret_cast<DeviceMemory::HandleType*>(&memory)); }
+inline UniqueDeviceMemory allocateMemoryUnique(const MemoryAllocateInfo& allocateInfo)  { return allocateMemoryUnique_throw(allocateInfo); }
+
+inline void freeMemory(DeviceMemory memory) noexcept  { funcs.vkFreeMemory(detail::_device.handle(), memory.handle(), nullptr); }
+inline void destroy(DeviceMemory memory) noexcept  { funcs.vkFreeMemory(detail::_device.handle(), memory.handle(), nullptr); }
+
+inline void bindBufferMemory_throw(Buffer buffer, DeviceMemory memory, DeviceSize memoryOffset)  { Result r = funcs.vkBindBufferMemory(detail::_device.handle(), buffer.handle(), memory.handle(), memoryOffset); checkForSuccessValue(r, "vkBindBufferMemory"); }
+inline Result bindBufferMemory_noThrow(Buffer buffer, DeviceMemory memory, DeviceSize memoryOffset) noexcept  { return funcs.vkBindBufferMemory(detail::_device.handle(), buffer.handle(), memory.handle(), memoryOffset); }
+inline void bindBufferMemory(Buffer buffer, DeviceMemory memory, DeviceSize memoryOffset)  { bindBufferMemory_throw(buffer, memory, memoryOffset); }
+
+inline void* mapMemory_throw(DeviceMemory memory, DeviceSize offset, DeviceSize size, MemoryMapFlags flags = {})  { void* p; Result r = funcs.vkMapMemory(detail::_device.handle(), memory.handle(), offset, size, flags, &p); checkForSuccessValue(r, "vkMapMemory"); return p; }
+inline Result mapMemory_noThrow(DeviceMemory memory, DeviceSize offset, DeviceSize size, MemoryMapFlags flags, void** ppData) noexcept  { return funcs.vkMapMemory(detail::_device.handle(), memory.handle(), offset, size, flags, ppData); }
+inline void* mapMemory(DeviceMemory memory, DeviceSize offset, DeviceSize size, MemoryMapFlags flags = {})  { return mapMemory_throw(memory, offset, size, flags); }
+inline void unmapMemory(DeviceMemory memory) noexcept  { funcs.vkUnmapMemory(detail::_device.handle(), memory.handle()); }
+
 inline ShaderModule createShaderModule_throw(const ShaderModuleCreateInfo& createInfo)  { ShaderModule::HandleType h; Result r = funcs.vkCreateShaderModule(detail::_device.handle(), &createInfo, nullptr, &h); detail::processResult(r, h, "vkCreateShaderModule"); return h; }
 inline Result createShaderModule_noThrow(const ShaderModuleCreateInfo& createInfo, ShaderModule& shaderModule) noexcept  { return funcs.vkCreateShaderModule(detail::_device.handle(), &createInfo, nullptr, reinterpret_cast<ShaderModule::HandleType*>(&shaderModule)); }
 inline ShaderModule createShaderModule(const ShaderModuleCreateInfo& createInfo)  { return createShaderModule_throw(createInfo); }
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include "vkg.h"
+
+
+// The way the command buffer of each measurement is obtained.
+enum class RecordingMode {
+	eRerecord,   // single command buffer is recorded from scratch before each submission
+	ePoolReset,  // the whole command pool is reset by vkResetCommandPool and the command buffer is recorded again
+	eReuse,      // command buffers are recorded once per pipeline and dispatch size and submitted again when they repeat
+};
+
+const char* to_cstr(RecordingMode mode);
+
+// parse mode name (rerecord, pool-reset, reuse); return false on unknown name
+bool parseRecordingMode(const char* s, RecordingMode& mode);
+
+
+// Command buffer source of the measurement loop.
+//
+// begin() returns the command buffer for the pipeline and dispatch size.
+// If needsRecording is set to true, the command buffer was begun and the caller
+// records the commands and ends it. Otherwise, the command buffer contains
+// the same commands from an earlier measurement and it is just submitted again.
+// CPU time from begin() until submitted() is collected as record+submit cost.
+//
+// The previously returned command buffer must not be pending execution when begin() is called.
+class CommandRecycler {
+protected:
+	struct CacheEntry {
+		vk::Pipeline pipeline;
+		uint32_t workgroupCountX;
+		uint32_t workgroupCountY;
+		uint32_t workgroupCountZ;
+		vk::CommandBuffer commandBuffer;
+	};
+	RecordingMode _mode;
+	vk::UniqueCommandPool _commandPool;
+	vk::CommandBuffer _commandBuffer;
+	std::vector<CacheEntry> _cache;
+	size_t _maxCacheSize;
+	size_t _nextEviction = 0;
+	size_t _numReused = 0;
+	std::chrono::high_resolution_clock::time_point _beginTime;
+	std::vector<float> _cpuTimeList;
+
+public:
+
+	CommandRecycler(uint32_t queueFamily, RecordingMode mode, size_t maxCacheSize = 64);
+
+	vk::CommandBuffer begin(vk::Pipeline pipeline, uint32_t workgroupCountX, uint32_t workgroupCountY,
+	                        uint32_t workgroupCountZ, bool& needsRecording);
+	void submitted();
+
+	// round the number of workgroups to two significant digits in eReuse mode,
+	// so the dispatch sizes repeat and the recorded command buffers can be reused;
+	// other modes return numWorkgroups unchanged
+	uint64_t roundNumWorkgroups(uint64_t numWorkgroups) const;
+
+	// print average, median and minimum of record+submit cost
+	void printStatistics() const;
+
+	RecordingMode mode() const  { return _mode; }
+
+};
@@ -0,0 +1,419 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "deviceSelection.h"
+
+using namespace std;
+
+
+// constants
+static constexpr const float scoreTargetTime = 0.005f;  // the load of the micro-benchmark is increased until a single dispatch takes this time in seconds
+static constexpr const unsigned numScoreMeasurements = 5;  // the shortest time of this number of dispatches is taken
+static constexpr const vk::DeviceSize maxBandwidthBufferSize = 256 * 1024 * 1024;  // large enough to not fit into the caches
+static constexpr const vk::DeviceSize bandwidthBufferGranularity = 2 * 16 * 128 * 1024;  // two halves of 16-byte elements, 128 invocations per workgroup, 1024 workgroups per row
+
+
+// shader code as SPIR-V binary
+static const uint32_t performanceSpirv[] = {
+#include "performance.comp.spv"
+};
+static const uint32_t bandwidthSpirv[] = {
+#include "bandwidth.comp.spv"
+};
+
+
+float workloadScore(const DeviceScore& s, WorkloadClass workloadClass)
+{
+	switch(workloadClass) {
+	case WorkloadClass::eCompute:   return s.flops;
+	case WorkloadClass::eBandwidth: return s.bytesPerSecond;
+	default:                        return sqrtf(s.flops) * sqrtf(s.bytesPerSecond);
+	}
+}
+
+
+DeviceScore measureDeviceScore(vk::PhysicalDevice pd, uint32_t queueFamily,
+	uint32_t timestampValidBits, float timestampPeriod)
+{
+	DeviceScore score{ 0.f, 0.f };
+	uint64_t timestampValidBitMask = (timestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << timestampValidBits) - 1;
+
+	try {
+
+		// create device
+		vk::initDevice(
+			pd,  // physicalDevice
+			vk::DeviceCreateInfo{  // pCreateInfo
+				.flags = {},
+				.queueCreateInfoCount = 1,
+				.pQueueCreateInfos =
+					array{
+						vk::DeviceQueueCreateInfo{
+							.flags = {},
+							.queueFamilyIndex = queueFamily,
+							.queueCount = 1,
+							.pQueuePriorities = &(const float&)1.f,
+						}
+					}.data(),
+				.enabledLayerCount = 0,  // no enabled layers
+				.ppEnabledLayerNames = nullptr,
+				.enabledExtensionCount = 0,  // no enabled extensions
+				.ppEnabledExtensionNames = nullptr,
+				.pEnabledFeatures =
+					&(const vk::PhysicalDeviceFeatures&)vk::PhysicalDeviceFeatures{
+						.shaderInt64 = true,
+					},
+			}
+			.setPNext(
+				&(const vk::PhysicalDeviceVulkan12Features&)vk::PhysicalDeviceVulkan12Features{
+					.bufferDeviceAddress = true,
+				}
+			)
+		);
+
+		// all the handles are destroyed at the end of this block,
+		// before the device is destroyed
+		{
+			// get queue
+			vk::Queue queue = vk::getDeviceQueue(queueFamily, 0);
+
+			// pipeline layout
+			// (push constants are used by bandwidth shader only)
+			vk::UniquePipelineLayout pipelineLayout =
+				vk::createPipelineLayoutUnique(
+					vk::PipelineLayoutCreateInfo{
+						.flags = {},
+						.setLayoutCount = 0,
+						.pSetLayouts = nullptr,
+						.pushConstantRangeCount = 1,
+						.pPushConstantRanges =
+							&(const vk::PushConstantRange&)vk::PushConstantRange{
+								.stageFlags = vk::ShaderStageFlagBits::eCompute,
+								.offset = 0,
+								.size = 2 * sizeof(uint64_t),
+							},
+					}
+				);
+
+			// pipelines
+			auto createPipeline =
+				[&](const uint32_t* code, size_t codeSize) {
+					vk::UniqueShaderModule shaderModule =
+						vk::createShaderModuleUnique(
+							vk::ShaderModuleCreateInfo{
+								.flags = {},
+								.codeSize = codeSize,
+								.pCode = code,
+							}
+						);
+					return
+						vk::createComputePipelineUnique(
+							nullptr,
+							vk::ComputePipelineCreateInfo{
+								.flags = {},
+								.stage =
+									vk::PipelineShaderStageCreateInfo{
+										.flags = {},
+										.stage = vk::ShaderStageFlagBits::eCompute,
+										.module = shaderModule,
+										.pName = "main",
+										.pSpecializationInfo = nullptr,
+									},
+								.layout = pipelineLayout,
+								.basePipelineHandle = nullptr,
+								.basePipelineIndex = -1,
+							}
+						);
+				};
+			vk::UniquePipeline fmaPipeline = createPipeline(performanceSpirv, sizeof(performanceSpirv));
+			vk::UniquePipeline bandwidthPipeline = createPipeline(bandwidthSpirv, sizeof(bandwidthSpirv));
+
+			// buffer for bandwidth test;
+			// its size is limited to a quarter of the largest device-local heap
+			vk::PhysicalDeviceMemoryProperties memoryProperties = vk::getPhysicalDeviceMemoryProperties(pd);
+			vk::DeviceSize heapSize = 0;
+			for(uint32_t i=0; i<memoryProperties.memoryHeapCount; i++)
+				if(memoryProperties.memoryHeaps[i].flags & vk::MemoryHeapFlagBits::eDeviceLocal)
+					heapSize = max(heapSize, memoryProperties.memoryHeaps[i].size);
+			vk::DeviceSize bufferSize = min(maxBandwidthBufferSize, heapSize / 4);
+			bufferSize = max(bufferSize / bandwidthBufferGranularity, vk::DeviceSize(1)) * bandwidthBufferGranularity;
+			vk::UniqueBuffer buffer =
+				vk::createBufferUnique(
+					vk::BufferCreateInfo{
+						.flags = {},
+						.size = bufferSize,
+						.usage = vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eShaderDeviceAddress,
+						.sharingMode = vk::SharingMode::eExclusive,
+						.queueFamilyIndexCount = 0,
+						.pQueueFamilyIndices = nullptr,
+					}
+				);
+
+			// memory of the buffer;
+			// prefer device-local memory
+			vk::MemoryRequirements memoryRequirements = vk::getBufferMemoryRequirements(buffer);
+			uint32_t memoryTypeIndex = ~uint32_t(0);
+			for(uint32_t i=0; i<memoryProperties.memoryTypeCount; i++)
+				if(memoryRequirements.memoryTypeBits & (1 << i)) {
+					if(memoryProperties.memoryTypes[i].propertyFlags & vk::MemoryPropertyFlagBits::eDeviceLocal) {
+						memoryTypeIndex = i;
+						break;
+					}
+					if(memoryTypeIndex == ~uint32_t(0))
+						memoryTypeIndex = i;
+				}
+			if(memoryTypeIndex == ~uint32_t(0))
+				throw runtime_error("No suitable memory type found for the buffer.");
+			vk::UniqueDeviceMemory memory =
+				vk::allocateMemoryUnique(
+					vk::MemoryAllocateInfo{
+						.pNext =
+							&(const vk::MemoryAllocateFlagsInfo&)vk::MemoryAllocateFlagsInfo{
+								.flags = vk::MemoryAllocateFlagBits::eDeviceAddress,
+								.deviceMask = 0,
+							},
+						.allocationSize = memoryRequirements.size,
+						.memoryTypeIndex = memoryTypeIndex,
+					}
+				);
+			vk::bindBufferMemory(buffer, memory, 0);
+			vk::DeviceAddress bufferAddress = vk::getBufferDeviceAddress(buffer);
+
+			// timestamp pool
+			vk::UniqueQueryPool timestampPool =
+				vk::createQueryPoolUnique(
+					vk::QueryPoolCreateInfo{
+						.flags = {},
+						.queryType = vk::QueryType::eTimestamp,
+						.queryCount = 2,
+						.pipelineStatistics = {},
+					}
+				);
+
+			// command pool
+			vk::UniqueCommandPool commandPool =
+				vk::createCommandPoolUnique(
+					vk::CommandPoolCreateInfo{
+						.flags = vk::CommandPoolCreateFlagBits::eTransient |
+						         vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+						.queueFamilyIndex = queueFamily,
+					}
+				);
+
+			// allocate command buffer
+			vk::CommandBuffer commandBuffer =
+				vk::allocateCommandBuffer(
+					vk::CommandBufferAllocateInfo{
+						.commandPool = commandPool,
+						.level = vk::CommandBufferLevel::ePrimary,
+						.commandBufferCount = 1,
+					}
+				);
+
+			// fence
+			vk::UniqueFence computingFinishedFence =
+				vk::createFenceUnique(
+					vk::FenceCreateInfo{
+						.flags = {}
+					}
+				);
+
+			// run single dispatch and return its time in seconds
+			auto runDispatch =
+				[&](vk::Pipeline pipeline, uint32_t workgroupCountX, uint32_t workgroupCountY,
+				    const array<uint64_t, 2>* pushData) -> float
+				{
+					// record command buffer
+					vk::beginCommandBuffer(
+						commandBuffer,
+						vk::CommandBufferBeginInfo{
+							.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+							.pInheritanceInfo = nullptr,
+						}
+					);
+					vk::cmdResetQueryPool(commandBuffer, timestampPool, 0, 2);
+					vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+					if(pushData)
+						vk::cmdPushConstants(
+							commandBuffer,
+							pipelineLayout,
+							vk::ShaderStageFlagBits::eCompute,
+							0,  // offset
+							sizeof(*pushData),  // size
+							pushData->data()  // pValues
+						);
+					vk::cmdWriteTimestamp(commandBuffer, vk::PipelineStageFlagBits::eTopOfPipe, timestampPool, 0);
+					vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, 1);
+					vk::cmdWriteTimestamp(commandBuffer, vk::PipelineStageFlagBits::eBottomOfPipe, timestampPool, 1);
+					vk::endCommandBuffer(commandBuffer);
+
+					// submit work
+					vk::queueSubmit(
+						queue,
+						vk::SubmitInfo{
+							.waitSemaphoreCount = 0,
+							.pWaitSemaphores = nullptr,
+							.pWaitDstStageMask = nullptr,
+							.commandBufferCount = 1,
+							.pCommandBuffers = &commandBuffer,
+							.signalSemaphoreCount = 0,
+							.pSignalSemaphores = nullptr,
+						},
+						computingFinishedFence
+					);
+
+					// wait for the work
+					vk::Result r =
+						vk::waitForFence_noThrow(
+							computingFinishedFence,
+							uint64_t(1.5e9)  // timeout (1.5 seconds)
+						);
+					if(r == vk::Result::eTimeout) {
+						cout << "Vulkan device timeout. Task is probably hanging." << endl;
+						// use std::quick_exit() to terminate the application
+						// (Do not throw, do not return, do not call std::exit().
+						// The device is still busy and it uses number of handles such as
+						// computingFinishedFence and device handle itself.
+						// Destruction of the handles in use or the unallowed access to them
+						// is forbidden by Vulkan specification.
+						quick_exit(-1);
+					} else
+						vk::checkForSuccessValue(r, "vkWaitForFences");
+					vk::resetFence(computingFinishedFence);
+
+					// read timestamps
+					array<uint64_t, 2> timestamps;
+					vk::getQueryPoolResults(
+						timestampPool,  // queryPool
+						0,  // firstQuery
+						2,  // queryCount
+						2 * sizeof(uint64_t),  // dataSize
+						timestamps.data(),  // pData
+						sizeof(uint64_t),  // stride
+						vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait  // flags
+					);
+					return float((timestamps[1] - timestamps[0]) & timestampValidBitMask) * timestampPeriod / 1e9f;
+				};
+
+			// the shortest time of numScoreMeasurements dispatches
+			auto measure =
+				[&](vk::Pipeline pipeline, uint32_t workgroupCountX, uint32_t workgroupCountY,
+				    const array<uint64_t, 2>* pushData) -> float
+				{
+					float bestTime = runDispatch(pipeline, workgroupCountX, workgroupCountY, pushData);
+					for(unsigned i=1; i<numScoreMeasurements; i++)
+						bestTime = min(bestTime, runDispatch(pipeline, workgroupCountX, workgroupCountY, pushData));
+					return bestTime;
+				};
+
+			// FMA throughput;
+			// number of workgroups is multiplied by four until the dispatch takes scoreTargetTime;
+			// each workgroup performs 20000 floating point operations in each of its 128 invocations
+			uint32_t numWorkgroups = 1;
+			while(numWorkgroups < 1024 * 1024) {
+				float time = runDispatch(fmaPipeline, min(numWorkgroups, 1024u), max(numWorkgroups / 1024, 1u), nullptr);
+				if(time >= scoreTargetTime)
+					break;
+				numWorkgroups *= 4;
+			}
+			float fmaTime = measure(fmaPipeline, min(numWorkgroups, 1024u), max(numWorkgroups / 1024, 1u), nullptr);
+			if(fmaTime > 0.f)
+				score.flops = float(uint64_t(20000) * 128 * numWorkgroups) / fmaTime;
+
+			// memory bandwidth;
+			// the first half of the buffer is copied to the second half
+			vk::DeviceSize halfSize = bufferSize / 2;
+			array<uint64_t, 2> pushData = { bufferAddress, bufferAddress + halfSize };
+			uint32_t numCopyWorkgroups = uint32_t(halfSize / (16 * 128));
+			float copyTime = measure(bandwidthPipeline, 1024, numCopyWorkgroups / 1024, &pushData);
+			if(copyTime > 0.f)
+				score.bytesPerSecond = float(2 * halfSize) / copyTime;
+
+		}
+
+	} catch(exception&) {
+		score = { 0.f, 0.f };
+	}
+
+	vk::destroyDevice();
+	return score;
+}
+
+
+static string scoreKey(vk::PhysicalDevice pd, uint32_t queueFamily)
+{
+	// get deviceUUID
+	// (compatible devices are Vulkan 1.2+)
+	vk::PhysicalDeviceVulkan11Properties properties11;
+	vk::PhysicalDeviceProperties2 properties2{
+		.pNext = &properties11,
+	};
+	vk::getPhysicalDeviceProperties2(pd, properties2);
+	const vk::PhysicalDeviceProperties& p = properties2.properties;
+
+	// vendorID:deviceID:driverVersion:deviceUUID:queueFamily
+	stringstream ss;
+	ss << hex << setfill('0')
+	   << setw(4) << p.vendorID << ':' << setw(4) << p.deviceID << ':'
+	   << setw(8) << p.driverVersion << ':';
+	for(uint8_t b : properties11.deviceUUID)
+		ss << setw(2) << unsigned(b);
+	ss << ':' << dec << queueFamily;
+	return ss.str();
+}
+
+
+void DeviceScoreCache::load(const string& fileName)
+{
+	_scoreMap.clear();
+	_modified = false;
+	ifstream f(fileName);
+	string line;
+	while(getline(f, line)) {
+		if(line.empty() || line[0] == '#')
+			continue;
+		stringstream ss(line);
+		string key;
+		DeviceScore s;
+		if(ss >> key >> s.flops >> s.bytesPerSecond)
+			_scoreMap[key] = s;
+	}
+}
+
+
+void DeviceScoreCache::save(const string& fileName)
+{
+	if(!_modified)
+		return;
+	ofstream f(fileName, ios::out | ios::trunc);
+	if(!f) {
+		cout << "Cannot write device score file " << fileName << "." << endl;
+		return;
+	}
+	f << "# device scores: vendorID:deviceID:driverVersion:deviceUUID:queueFamily FLOPS bytesPerSecond\n";
+	for(auto& [key, s] : _scoreMap)
+		f << key << ' ' << s.flops << ' ' << s.bytesPerSecond << '\n';
+	_modified = false;
+}
+
+
+bool DeviceScoreCache::find(vk::PhysicalDevice pd, uint32_t queueFamily, DeviceScore& score) const
+{
+	auto it = _scoreMap.find(scoreKey(pd, queueFamily));
+	if(it == _scoreMap.end())
+		return false;
+	score = it->second;
+	return true;
+}
+
+
+void DeviceScoreCache::set(vk::PhysicalDevice pd, uint32_t queueFamily, const DeviceScore& score)
+{
+	_scoreMap[scoreKey(pd, queueFamily)] = score;
+	_modified = true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include "vkg.h"
+
+
+// Workload class used to choose the device.
+enum class WorkloadClass {
+	eCompute,    // floating point throughput (FMA)
+	eBandwidth,  // memory bandwidth
+	eBalanced,   // geometric mean of both
+};
+
+
+// Measured performance of the device and queue family.
+// Zero values mean that the measurement failed.
+struct DeviceScore {
+	float flops;
+	float bytesPerSecond;
+};
+
+
+// Score of the device for the given workload class.
+float workloadScore(const DeviceScore& s, WorkloadClass workloadClass);
+
+
+// Run short micro-benchmark on the device and queue family.
+//
+// It creates its own logical device and destroys it before returning,
+// so it must not be called while other device is in use.
+// It returns zero score if the measurement fails.
+DeviceScore measureDeviceScore(vk::PhysicalDevice pd, uint32_t queueFamily,
+	uint32_t timestampValidBits, float timestampPeriod);
+
+
+// Persistent cache of device scores.
+//
+// Scores are stored in a text file, one line per device and queue family.
+// The key contains vendorID, deviceID, driverVersion and deviceUUID,
+// so driver update or device change invalidates the score.
+class DeviceScoreCache {
+protected:
+	std::map<std::string, DeviceScore> _scoreMap;
+	bool _modified = false;
+public:
+	void load(const std::string& fileName);  // missing or corrupted file results in empty cache
+	void save(const std::string& fileName);  // the file is written only if the cache was modified
+	bool find(vk::PhysicalDevice pd, uint32_t queueFamily, DeviceScore& score) const;
+	void set(vk::PhysicalDevice pd, uint32_t queueFamily, const DeviceScore& score);
+};
@@ -9,6 +9,8 @@
 #include <tuple>
 #include <vector>
 #include "vkg.h"
+#include "commandRecycler.h"
+#include "deviceSelection.h"
 
 using namespace std;
 
@@ -17,6 +19,7 @@ using namespace std;
 constexpr const char* appName = "2-5-TimestampQueries";
 constexpr const float totalMeasuringTime = 3.f;  // total time in seconds for which measurements are made and median time of the measurements is taken at the end
 constexpr const float singleMeasurementTargetTime = 0.02f;  // single measurement time in seconds; the load will be continually adjusted to target this time
+constexpr const char* defaultScoreFileName = "2-5-TimestampQueries.scores";  // file of cached device scores
 
 
 // shader code as SPIR-V binary
@@ -102,6 +105,11 @@ int main(int argc, char* argv[])
 		bool printHelp = false;
 		size_t selectedDeviceIndex = 0;
 		char* deviceFilterString = nullptr;
+		WorkloadClass workloadClass = WorkloadClass::eCompute;
+		bool selectByType = false;
+		bool rescore = false;
+		const char* scoreFileName = defaultScoreFileName;
+		RecordingMode recordingMode = RecordingMode::eRerecord;
 		for(int i=1; i<argc; i++) {
 
 			// parse options starting with '-'
@@ -113,6 +121,59 @@ int main(int argc, char* argv[])
 					continue;
 				}
 
+				// workload class used for automatic device selection
+				if(strcmp(argv[i], "-w") == 0 || strcmp(argv[i], "--workload") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					if(strcmp(argv[i], "compute") == 0)
+						workloadClass = WorkloadClass::eCompute;
+					else if(strcmp(argv[i], "bandwidth") == 0)
+						workloadClass = WorkloadClass::eBandwidth;
+					else if(strcmp(argv[i], "balanced") == 0)
+						workloadClass = WorkloadClass::eBalanced;
+					else
+						printHelp = true;
+					continue;
+				}
+
+				// select device by its type instead of measured score
+				if(strcmp(argv[i], "--select-by-type") == 0) {
+					selectByType = true;
+					continue;
+				}
+
+				// ignore cached scores
+				if(strcmp(argv[i], "--rescore") == 0) {
+					rescore = true;
+					continue;
+				}
+
+				// score file
+				if(strcmp(argv[i], "--score-file") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					scoreFileName = argv[i];
+					continue;
+				}
+
+				// command buffer recording mode
+				if(strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "--recording") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					if(!parseRecordingMode(argv[i], recordingMode))
+						printHelp = true;
+					continue;
+				}
+
 				// parse device index
 				if(argv[i][1] >= '0' && argv[i][1] <= '9') {
 					char* endp = nullptr;
@@ -135,13 +196,34 @@ int main(int argc, char* argv[])
 		if(printHelp) {
 			cout << appName << " prints the performance of a Vulkan device\n"
 			        "\n"
-			        "Usage: " << appName << " [-<deviceIndex>] [deviceNameFilter]\n"
+			        "Usage: " << appName << " [-<deviceIndex>] [deviceNameFilter] [-w <workload>]\n"
+			        "          [--select-by-type] [--rescore] [--score-file <file>] [-r <mode>]\n"
 			        "   -<deviceIndex> - for example -1 or -3, specifies the index\n"
 			        "      of the device used for the performance test; it might be\n"
 			        "      useful when more devices are present in the system;\n"
 			        "      devices are numbered starting from one\n"
 			        "   deviceNameFilter - only devices matching the given string\n"
-			        "      will be considered; for example AMD, GeForce, Intel\n" << endl;
+			        "      will be considered; for example AMD, GeForce, Intel\n"
+			        "   -w <workload> or --workload <workload> - workload class used\n"
+			        "      for automatic device selection; the device with the best\n"
+			        "      measured score is chosen; workload is one of:\n"
+			        "      compute - FMA throughput (default),\n"
+			        "      bandwidth - memory copy bandwidth,\n"
+			        "      balanced - geometric mean of both\n"
+			        "   --select-by-type - choose the device automatically by its type\n"
+			        "      (discrete GPU, integrated GPU,...) instead of measured score\n"
+			        "   --rescore - measure the scores again, ignoring cached values\n"
+			        "   --score-file <file> - file of cached scores; default is\n"
+			        "      " << defaultScoreFileName << " in the current directory\n"
+			        "   -r <mode> or --recording <mode> - the way the command buffer\n"
+			        "      is prepared for each measurement; CPU record+submit cost\n"
+			        "      is printed at the end; mode is one of:\n"
+			        "      rerecord - record the command buffer again (default),\n"
+			        "      pool-reset - reset the command pool by vkResetCommandPool\n"
+			        "         and record the command buffer again,\n"
+			        "      reuse - record a command buffer once per dispatch size\n"
+			        "         and submit it again; the number of workgroups is rounded\n"
+			        "         to two significant digits to make the sizes repeat\n" << endl;
 			return 99;
 		}
 
@@ -276,8 +358,51 @@ int main(int argc, char* argv[])
 			}
 			selectedDevice = compatibleDevices.begin() + selectedDeviceIndex - 1;
 		}
+		else if(compatibleDevices.size() == 1)
+		{
+			// the only compatible device
+			selectedDevice = compatibleDevices.begin();
+		}
 		else
 		{
+			// choose the device automatically
+			// using measured score of each compatible device and queue family;
+			// the scores are cached in the score file, so the micro-benchmark runs
+			// only for new devices or after the driver update
+			bool scoreAvailable = false;
+			if(!selectByType) {
+				DeviceScoreCache scoreCache;
+				if(!rescore)
+					scoreCache.load(scoreFileName);
+				cout << "Device scores:" << endl;
+				float bestScore = 0.f;
+				for(auto it=compatibleDevices.begin(); it!=compatibleDevices.end(); it++) {
+					auto& [pd, queueFamily, props, queueFamilyProps] = *it;
+					cout << "   " << it-compatibleDevices.begin()+1 << ": " << flush;
+					DeviceScore s;
+					bool cached = scoreCache.find(pd, queueFamily, s);
+					if(!cached) {
+						s = measureDeviceScore(pd, queueFamily, queueFamilyProps.timestampValidBits, props.limits.timestampPeriod);
+						if(s.flops > 0.f && s.bytesPerSecond > 0.f)
+							scoreCache.set(pd, queueFamily, s);
+					}
+					if(s.flops > 0.f && s.bytesPerSecond > 0.f)
+						cout << formatFloatSI(s.flops) << "FLOPS, " << formatFloatSI(s.bytesPerSecond) << "B/s"
+						     << (cached ? "  (cached)" : "") << endl;
+					else
+						cout << "measurement failed" << endl;
+					float score = workloadScore(s, workloadClass);
+					if(score > bestScore) {
+						selectedDevice = it;
+						bestScore = score;
+						scoreAvailable = true;
+					}
+				}
+				scoreCache.save(scoreFileName);
+			}
+			if(scoreAvailable)
+				goto deviceSelected;
+
 			// choose the device automatically
 			// using score heuristic
 			selectedDevice = compatibleDevices.begin();
@@ -298,6 +423,7 @@ int main(int argc, char* argv[])
 				}
 			}
 		}
+	deviceSelected:
 
 		// device to use
 		cout << "Using device:\n"
@@ -463,25 +589,8 @@ int main(int argc, char* argv[])
 				}
 			);
 
-		// command pool
-		vk::UniqueCommandPool commandPool =
-			vk::createCommandPoolUnique(
-				vk::CommandPoolCreateInfo{
-					.flags = vk::CommandPoolCreateFlagBits::eTransient |
-					         vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
-					.queueFamilyIndex = queueFamily,
-				}
-			);
-
-		// allocate command buffer
-		vk::CommandBuffer commandBuffer =
-			vk::allocateCommandBuffer(
-				vk::CommandBufferAllocateInfo{
-					.commandPool = commandPool,
-					.level = vk::CommandBufferLevel::ePrimary,
-					.commandBufferCount = 1,
-				}
-			);
+		// command pool and command buffers
+		CommandRecycler commandRecycler(queueFamily, recordingMode);
 
 		// fence
 		vk::UniqueFence computingFinishedFence =
@@ -502,44 +611,43 @@ int main(int argc, char* argv[])
 		chrono::time_point startTime = chrono::high_resolution_clock::now();
 		do {
 
-			// begin command buffer
-			vk::beginCommandBuffer(
-				commandBuffer,
-				vk::CommandBufferBeginInfo{
-					.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
-					.pInheritanceInfo = nullptr,
-				}
-			);
-
-			// reset timestamp pool
-			vk::cmdResetQueryPool(
-				commandBuffer,
-				timestampPool,
-				0,  // firstQuery
-				2);  // queryCount
-
-			// bind pipeline
-			vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
-
-			// write timestamp 0
-			vk::cmdWriteTimestamp(
-				commandBuffer,
-				vk::PipelineStageFlagBits::eTopOfPipe,
-				timestampPool,
-				0);  // query
-
-			// dispatch computation
-			vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
-
-			// write timestamp 1
-			vk::cmdWriteTimestamp(
-				commandBuffer,
-				vk::PipelineStageFlagBits::eBottomOfPipe,
-				timestampPool,
-				1);  // query
-
-			// end command buffer
-			vk::endCommandBuffer(commandBuffer);
+			// get command buffer
+			// (depending on recordingMode, it needs to be recorded or it was already recorded)
+			bool needsRecording;
+			vk::CommandBuffer commandBuffer =
+				commandRecycler.begin(pipeline, workgroupCountX, workgroupCountY, workgroupCountZ, needsRecording);
+			if(needsRecording) {
+
+				// reset timestamp pool
+				vk::cmdResetQueryPool(
+					commandBuffer,
+					timestampPool,
+					0,  // firstQuery
+					2);  // queryCount
+
+				// bind pipeline
+				vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+
+				// write timestamp 0
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eTopOfPipe,
+					timestampPool,
+					0);  // query
+
+				// dispatch computation
+				vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
+
+				// write timestamp 1
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eBottomOfPipe,
+					timestampPool,
+					1);  // query
+
+				// end command buffer
+				vk::endCommandBuffer(commandBuffer);
+			}
 
 
 			// submit work
@@ -556,6 +664,7 @@ int main(int argc, char* argv[])
 				},
 				computingFinishedFence
 			);
+			commandRecycler.submitted();
 
 			// wait for the work
 			vk::Result r =
@@ -618,6 +727,7 @@ int main(int argc, char* argv[])
 			else {
 				float ratio = singleMeasurementTargetTime / time;
 				uint64_t newNumGroups = uint64_t(ratio * (uint64_t(workgroupCountX) * workgroupCountY * workgroupCountZ));
+				newNumGroups = commandRecycler.roundNumWorkgroups(newNumGroups);
 				if(newNumGroups > 10000 * 10000) {
 					workgroupCountZ = 1 + ((newNumGroups - 1) / (10000 * 10000));
 					uint64_t remainder = newNumGroups / workgroupCountZ;
@@ -635,6 +745,9 @@ int main(int argc, char* argv[])
 
 		} while(true);
 
+		// print CPU cost of command buffer recording and submission
+		commandRecycler.printStatistics();
+
 	// catch exceptions
 	} catch(vk::Error& e) {
 		cout << e.what() << endl;
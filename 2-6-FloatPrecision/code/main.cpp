@@ -8,6 +8,7 @@
 #include <tuple>
 #include <vector>
 #include "vkg.h"
+#include "commandRecycler.h"
 
 using namespace std;
 
@@ -109,6 +110,7 @@ int main(int argc, char* argv[])
 		bool printHelp = false;
 		size_t selectedDeviceIndex = 0;
 		char* deviceFilterString = nullptr;
+		RecordingMode recordingMode = RecordingMode::eRerecord;
 		for(int i=1; i<argc; i++) {
 
 			// parse options starting with '-'
@@ -120,6 +122,18 @@ int main(int argc, char* argv[])
 					continue;
 				}
 
+				// command buffer recording mode
+				if(strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "--recording") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					if(!parseRecordingMode(argv[i], recordingMode))
+						printHelp = true;
+					continue;
+				}
+
 				// parse device index
 				if(argv[i][1] >= '0' && argv[i][1] <= '9') {
 					char* endp = nullptr;
@@ -142,11 +156,20 @@ int main(int argc, char* argv[])
 		if(printHelp) {
 			cout << appName << " prints the performance of a Vulkan device\n"
 			        "\n"
-			        "Usage: " << appName << " [-<deviceIndex>] [deviceNameFilter]\n"
+			        "Usage: " << appName << " [-<deviceIndex>] [-r <mode>] [deviceNameFilter]\n"
 			        "   -<deviceIndex> - for example -1 or -3, specifies the index\n"
 			        "      of the device used for the performance test; it might be\n"
 			        "      useful when more devices are present in the system;\n"
 			        "      devices are numbered starting from one\n"
+			        "   -r <mode> or --recording <mode> - the way the command buffer\n"
+			        "      is prepared for each measurement; CPU record+submit cost\n"
+			        "      is printed at the end; mode is one of:\n"
+			        "      rerecord - record the command buffer again (default),\n"
+			        "      pool-reset - reset the command pool by vkResetCommandPool\n"
+			        "         and record the command buffer again,\n"
+			        "      reuse - record a command buffer once per pipeline and dispatch\n"
+			        "         size and submit it again; the number of workgroups is\n"
+			        "         rounded to two significant digits to make the sizes repeat\n"
 			        "   deviceNameFilter - only devices matching the given string\n"
 			        "      will be considered; for example AMD, GeForce, Intel\n" << endl;
 			return 99;
@@ -561,25 +584,8 @@ int main(int argc, char* argv[])
 				}
 			);
 
-		// command pool
-		vk::UniqueCommandPool commandPool =
-			vk::createCommandPoolUnique(
-				vk::CommandPoolCreateInfo{
-					.flags = vk::CommandPoolCreateFlagBits::eTransient |
-					         vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
-					.queueFamilyIndex = queueFamily,
-				}
-			);
-
-		// allocate command buffer
-		vk::CommandBuffer commandBuffer =
-			vk::allocateCommandBuffer(
-				vk::CommandBufferAllocateInfo{
-					.commandPool = commandPool,
-					.level = vk::CommandBufferLevel::ePrimary,
-					.commandBufferCount = 1,
-				}
-			);
+		// command pool and command buffers
+		CommandRecycler commandRecycler(queueFamily, recordingMode);
 
 		// fence
 		vk::UniqueFence computingFinishedFence =
@@ -592,33 +598,7 @@ int main(int argc, char* argv[])
 		auto performTest =
 			[&](vk::Pipeline pipeline, size_t numWorkgroups) -> float {
 
-				// begin command buffer
-				vk::beginCommandBuffer(
-					commandBuffer,
-					vk::CommandBufferBeginInfo{
-						.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
-						.pInheritanceInfo = nullptr,
-					}
-				);
-
-				// reset timestamp pool
-				vk::cmdResetQueryPool(
-					commandBuffer,
-					timestampPool,
-					0,  // firstQuery
-					2);  // queryCount
-
-				// bind pipeline
-				vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
-
-				// write timestamp 0
-				vk::cmdWriteTimestamp(
-					commandBuffer,
-					vk::PipelineStageFlagBits::eTopOfPipe,
-					timestampPool,
-					0);  // query
-
-				// dispatch computation
+				// dispatch size
 				// (avoid any dimension to go over 10000)
 				uint32_t workgroupCountX;
 				uint32_t workgroupCountY;
@@ -636,17 +616,44 @@ int main(int argc, char* argv[])
 					workgroupCountY = 1 + ((numWorkgroups - 1) / 10000);
 					workgroupCountX = numWorkgroups / workgroupCountY;
 				}
-				vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
-
-				// write timestamp 1
-				vk::cmdWriteTimestamp(
-					commandBuffer,
-					vk::PipelineStageFlagBits::eBottomOfPipe,
-					timestampPool,
-					1);  // query
 
-				// end command buffer
-				vk::endCommandBuffer(commandBuffer);
+				// get command buffer
+				// (depending on recordingMode, it needs to be recorded or it was already recorded)
+				bool needsRecording;
+				vk::CommandBuffer commandBuffer =
+					commandRecycler.begin(pipeline, workgroupCountX, workgroupCountY, workgroupCountZ, needsRecording);
+				if(needsRecording) {
+
+					// reset timestamp pool
+					vk::cmdResetQueryPool(
+						commandBuffer,
+						timestampPool,
+						0,  // firstQuery
+						2);  // queryCount
+
+					// bind pipeline
+					vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+
+					// write timestamp 0
+					vk::cmdWriteTimestamp(
+						commandBuffer,
+						vk::PipelineStageFlagBits::eTopOfPipe,
+						timestampPool,
+						0);  // query
+
+					// dispatch computation
+					vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
+
+					// write timestamp 1
+					vk::cmdWriteTimestamp(
+						commandBuffer,
+						vk::PipelineStageFlagBits::eBottomOfPipe,
+						timestampPool,
+						1);  // query
+
+					// end command buffer
+					vk::endCommandBuffer(commandBuffer);
+				}
 
 
 				// submit work
@@ -663,6 +670,7 @@ int main(int argc, char* argv[])
 					},
 					computingFinishedFence
 				);
+				commandRecycler.submitted();
 
 				// wait for the work
 				vk::Result r =
@@ -714,7 +722,7 @@ int main(int argc, char* argv[])
 		// compute number of workgroups in the next iteration
 		// to eventually reach singleMeasurementTargetTime
 		auto computeNumWorkgroups =
-			[](size_t lastNumWorkgroups, float lastTime) -> size_t
+			[&commandRecycler](size_t lastNumWorkgroups, float lastTime) -> size_t
 			{
 				if(lastTime < (singleMeasurementTargetTime / maxNumWorkgroupsMultiplier)) {
 					// multiply numWorkgroups by maxNumWorkgroupsMultiplier
@@ -724,6 +732,7 @@ int main(int argc, char* argv[])
 					// multiply numWorkgroups by ratio
 					float ratio = singleMeasurementTargetTime / lastTime;
 					size_t newNumWorkgroups = size_t(lastNumWorkgroups * ratio);
+					newNumWorkgroups = commandRecycler.roundNumWorkgroups(newNumWorkgroups);
 					return (newNumWorkgroups >= 1) ? newNumWorkgroups : 1;
 				}
 			};
@@ -798,6 +807,9 @@ int main(int argc, char* argv[])
 		printResult("Float (float32) performance:   ", true, floatPerformanceList);
 		printResult("Double (float64) performance:  ", float64Support, doublePerformanceList);
 
+		// print CPU cost of command buffer recording and submission
+		commandRecycler.printStatistics();
+
 	// catch exceptions
 	} catch(vk::Error& e) {
 		cout << e.what() << endl;
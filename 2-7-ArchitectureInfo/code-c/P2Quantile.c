@@ -0,0 +1,120 @@
+#include "P2Quantile.h"
+
+
+void quantile_init(struct P2Quantile* q, float p)
+{
+	q->p = p;
+	q->count = 0;
+}
+
+
+int quantile_empty(struct P2Quantile* q)
+{
+	return q->count == 0;
+}
+
+
+static void sortHeights(float* h, unsigned long n)
+{
+	unsigned long i,j;
+	float tmp;
+	for(i=1; i<n; i++)
+		for(j=i; j>0 && h[j-1]>h[j]; j--) {
+			tmp = h[j];
+			h[j] = h[j-1];
+			h[j-1] = tmp;
+		}
+}
+
+
+void quantile_add(struct P2Quantile* q, float value)
+{
+	int i,k;
+	float* h = q->height;
+	float* n = q->position;
+
+	// the first five samples are just stored
+	if(q->count < 5) {
+		h[q->count] = value;
+		q->count++;
+		if(q->count == 5) {
+			sortHeights(h, 5);
+			for(i=0; i<5; i++)
+				n[i] = (float)(i + 1);
+			q->desired[0] = 1.f;
+			q->desired[1] = 1.f + 2.f * q->p;
+			q->desired[2] = 1.f + 4.f * q->p;
+			q->desired[3] = 3.f + 2.f * q->p;
+			q->desired[4] = 5.f;
+			q->increment[0] = 0.f;
+			q->increment[1] = q->p / 2.f;
+			q->increment[2] = q->p;
+			q->increment[3] = (1.f + q->p) / 2.f;
+			q->increment[4] = 1.f;
+		}
+		return;
+	}
+
+	// find cell k containing the value and update extreme markers
+	if(value < h[0]) {
+		h[0] = value;
+		k = 0;
+	}
+	else if(value >= h[4]) {
+		h[4] = value;
+		k = 3;
+	}
+	else {
+		k = 0;
+		while(value >= h[k+1])
+			k++;
+	}
+	q->count++;
+
+	// increment positions of markers above the value
+	// and desired positions of all markers
+	for(i=k+1; i<5; i++)
+		n[i] += 1.f;
+	for(i=0; i<5; i++)
+		q->desired[i] += q->increment[i];
+
+	// adjust heights of the middle markers if they are off their desired positions
+	for(i=1; i<4; i++) {
+		float d = q->desired[i] - n[i];
+		if((d >= 1.f && n[i+1] - n[i] > 1.f) || (d <= -1.f && n[i-1] - n[i] < -1.f)) {
+			int s = (d >= 0.f) ? 1 : -1;
+			float ds = (float)s;
+
+			// piecewise parabolic prediction
+			float hp = h[i] + ds / (n[i+1] - n[i-1]) *
+				((n[i] - n[i-1] + ds) * (h[i+1] - h[i]) / (n[i+1] - n[i]) +
+				 (n[i+1] - n[i] - ds) * (h[i] - h[i-1]) / (n[i] - n[i-1]));
+
+			// use linear prediction if parabolic one is out of neighbour heights
+			if(h[i-1] < hp && hp < h[i+1])
+				h[i] = hp;
+			else
+				h[i] = h[i] + ds * (h[i+s] - h[i]) / (n[i+s] - n[i]);
+			n[i] += ds;
+		}
+	}
+}
+
+
+float quantile_get(struct P2Quantile* q)
+{
+	// less than five samples: return the sample at the quantile position
+	if(q->count < 5) {
+		float h[5];
+		unsigned long i;
+		if(q->count == 0)
+			return 0.f;
+		for(i=0; i<q->count; i++)
+			h[i] = q->height[i];
+		sortHeights(h, q->count);
+		i = (unsigned long)(q->count * q->p);
+		return h[i < q->count ? i : q->count - 1];
+	}
+
+	return q->height[2];
+}
@@ -0,0 +1,26 @@
+#ifndef P2_QUANTILE_H_
+#define P2_QUANTILE_H_
+
+
+// Streaming quantile estimator using P-square algorithm
+// (Jain and Chlamtac, 1985).
+//
+// It keeps only five markers instead of all the samples,
+// so the memory consumption is constant regardless of the number of samples.
+struct P2Quantile {
+	float p;  // estimated quantile, for example 0.5 for median
+	unsigned long count;  // number of samples
+	float height[5];  // marker heights; the middle one is the estimate
+	float position[5];  // actual marker positions
+	float desired[5];  // desired marker positions
+	float increment[5];  // increments of desired positions for each sample
+};
+
+
+void quantile_init(struct P2Quantile* q, float p);
+int quantile_empty(struct P2Quantile* q);
+void quantile_add(struct P2Quantile* q, float value);
+float quantile_get(struct P2Quantile* q);
+
+
+#endif
@@ -1,14 +1,32 @@
+// multithreading is implemented using POSIX threads;
+// DOS and other systems use single thread only
+#if !defined(NO_MULTITHREADING) && (defined(__unix__) || defined(__APPLE__))
+# define USE_PTHREADS
+# define _POSIX_C_SOURCE 200112L
+#endif
+
 #include <assert.h>
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #if defined(__DOS__)
 # include <bios.h>
 #endif
-#include "FloatVector.h"
+#if defined(USE_PTHREADS)
+# include <pthread.h>
+# include <unistd.h>
+#endif
+#include "P2Quantile.h"
 
 static const char appName[] = "2-7-ArchtectureInfo-c";
+#if defined(USE_PTHREADS)
+static float timestampPeriod = 1e-6f;
+#else
 static float timestampPeriod = 1.f / CLOCKS_PER_SEC;
+#endif
+static unsigned numThreads = 1;
 
 void printCpuInfo();
 void fmaFloatComputation1(
@@ -23,12 +41,150 @@ static unsigned long getTimestamp()
 	long startTicks;
 	_bios_timeofday(_TIME_GETCLOCK, &startTicks);
 	return startTicks;
+#elif defined(USE_PTHREADS)
+	// clock() returns processor time summed over all the threads,
+	// so we use wall clock time in microseconds instead;
+	// unsigned long wraps after 71 minutes on 32-bit systems,
+	// but differences of timestamps are still correct
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long)ts.tv_sec * 1000000ul + (unsigned long)(ts.tv_nsec / 1000);
 #else
 	return (unsigned long)clock();
 #endif
 }
 
 
+// Execute workgroups of the work assigned to the thread.
+//
+// Workgroups are distributed in round-robin fashion, e.g. the thread with id
+// processes workgroups id, id+numThreads, id+2*numThreads, etc.
+// in the order of x, y and z coordinates.
+static void processWorkgroups(unsigned id, void (*invocationFunc)(unsigned,unsigned,unsigned),
+	unsigned workgroupCountX, unsigned workgroupCountY, unsigned workgroupCountZ)
+{
+	unsigned x = id;
+	unsigned y = 0;
+	unsigned z = 0;
+	do {
+		while(x >= workgroupCountX) {
+			x -= workgroupCountX;
+			y++;
+			if(y >= workgroupCountY) {
+				y -= workgroupCountY;
+				z++;
+				if(z >= workgroupCountZ)
+					return;
+			}
+		}
+		invocationFunc(x, y, z);
+		x += numThreads;
+	} while(1);
+}
+
+
+#if defined(USE_PTHREADS)
+
+// Worker pool.
+//
+// Threads are created once at the start and reused by all the tests.
+// The main thread works as worker with id 0. Each new job is announced
+// by incrementing jobCounter, and the main thread waits
+// until numRunningWorkers drops to zero.
+static struct {
+	pthread_t* threadList;
+	pthread_mutex_t mutex;
+	pthread_cond_t jobCond;
+	pthread_cond_t doneCond;
+	unsigned long jobCounter;
+	unsigned numRunningWorkers;
+	int terminate;
+
+	// current job
+	void (*invocationFunc)(unsigned,unsigned,unsigned);
+	unsigned workgroupCountX;
+	unsigned workgroupCountY;
+	unsigned workgroupCountZ;
+} pool;
+
+
+static void* workerMain(void* arg)
+{
+	unsigned id = (unsigned)(size_t)arg;
+	unsigned long lastJob = 0;
+
+	do {
+
+		// wait for the job
+		pthread_mutex_lock(&pool.mutex);
+		while(pool.jobCounter == lastJob && !pool.terminate)
+			pthread_cond_wait(&pool.jobCond, &pool.mutex);
+		if(pool.terminate) {
+			pthread_mutex_unlock(&pool.mutex);
+			return NULL;
+		}
+		lastJob = pool.jobCounter;
+		pthread_mutex_unlock(&pool.mutex);
+
+		// do the work
+		processWorkgroups(id, pool.invocationFunc,
+			pool.workgroupCountX, pool.workgroupCountY, pool.workgroupCountZ);
+
+		// report job completion
+		pthread_mutex_lock(&pool.mutex);
+		pool.numRunningWorkers--;
+		if(pool.numRunningWorkers == 0)
+			pthread_cond_signal(&pool.doneCond);
+		pthread_mutex_unlock(&pool.mutex);
+
+	} while(1);
+}
+
+
+static int createWorkerPool()
+{
+	unsigned i;
+
+	pool.jobCounter = 0;
+	pool.numRunningWorkers = 0;
+	pool.terminate = 0;
+	pthread_mutex_init(&pool.mutex, NULL);
+	pthread_cond_init(&pool.jobCond, NULL);
+	pthread_cond_init(&pool.doneCond, NULL);
+	pool.threadList = (pthread_t*)malloc(sizeof(pthread_t) * numThreads);
+	if(pool.threadList == NULL)
+		return 0;
+	for(i=1; i<numThreads; i++)
+		if(pthread_create(&pool.threadList[i], NULL, workerMain, (void*)(size_t)i) != 0) {
+			numThreads = i;
+			return 0;
+		}
+	return 1;
+}
+
+
+static void destroyWorkerPool()
+{
+	unsigned i;
+
+	if(pool.threadList == NULL)
+		return;
+	pthread_mutex_lock(&pool.mutex);
+	pool.terminate = 1;
+	pthread_cond_broadcast(&pool.jobCond);
+	pthread_mutex_unlock(&pool.mutex);
+	for(i=1; i<numThreads; i++)
+		pthread_join(pool.threadList[i], NULL);
+	free(pool.threadList);
+	pool.threadList = NULL;
+	pthread_cond_destroy(&pool.doneCond);
+	pthread_cond_destroy(&pool.jobCond);
+	pthread_mutex_destroy(&pool.mutex);
+}
+
+#endif
+
+
 float performTest(void (*invocationFunc)(unsigned,unsigned,unsigned), unsigned long numWorkgroups)
 {
 	unsigned workgroupCountX;
@@ -55,25 +211,67 @@ float performTest(void (*invocationFunc)(unsigned,unsigned,unsigned), unsigned l
 	}
 
 	// perform computation
-	ts1 = getTimestamp();
-	for(z=0; z<workgroupCountZ; z++)
-		for(y=0; y<workgroupCountY; y++)
-			for(x=0; x<workgroupCountX; x++)
-				invocationFunc(x, y, z);
-	ts2 = getTimestamp();
+	if(numThreads == 1) {
+		ts1 = getTimestamp();
+		for(z=0; z<workgroupCountZ; z++)
+			for(y=0; y<workgroupCountY; y++)
+				for(x=0; x<workgroupCountX; x++)
+					invocationFunc(x, y, z);
+		ts2 = getTimestamp();
+	}
+	else {
+#if defined(USE_PTHREADS)
+		// start the job on all workers
+		ts1 = getTimestamp();
+		pthread_mutex_lock(&pool.mutex);
+		pool.invocationFunc = invocationFunc;
+		pool.workgroupCountX = workgroupCountX;
+		pool.workgroupCountY = workgroupCountY;
+		pool.workgroupCountZ = workgroupCountZ;
+		pool.numRunningWorkers = numThreads - 1;
+		pool.jobCounter++;
+		pthread_cond_broadcast(&pool.jobCond);
+		pthread_mutex_unlock(&pool.mutex);
+
+		// process the work of worker 0
+		processWorkgroups(0, invocationFunc, workgroupCountX, workgroupCountY, workgroupCountZ);
+
+		// wait for the other workers
+		pthread_mutex_lock(&pool.mutex);
+		while(pool.numRunningWorkers != 0)
+			pthread_cond_wait(&pool.doneCond, &pool.mutex);
+		pthread_mutex_unlock(&pool.mutex);
+		ts2 = getTimestamp();
+#else
+		ts1 = ts2 = 0;
+#endif
+	}
 
 	// return time as float in seconds
 	return (float)(ts2 - ts1) * timestampPeriod;
 }
 
 
-// record the performance in the list
-void processResult(float time, unsigned numWorkgroups, struct FloatVector* performanceList)
+// Q1, median and Q3 of the performance
+//
+// They are estimated on the fly, so long runs do not need to store
+// all the measured values.
+struct PerformanceQuantiles {
+	struct P2Quantile q1;
+	struct P2Quantile median;
+	struct P2Quantile q3;
+};
+
+
+// record the performance in the quantile estimators
+void processResult(float time, unsigned numWorkgroups, struct PerformanceQuantiles* performance)
 {
 	if(time >= 0.01f) {
 		unsigned long numInstructions = (unsigned long)2000 * numWorkgroups;
-		float performance = (float)numInstructions / time;
-		vector_push_back(performanceList, performance);
+		float value = (float)numInstructions / time;
+		quantile_add(&performance->q1, value);
+		quantile_add(&performance->median, value);
+		quantile_add(&performance->q3, value);
 	}
 }
 
@@ -162,24 +360,24 @@ static void printFloatSI(float v)
 
 
 // print results
-void printResult(const char* text, int supported, struct FloatVector* performanceList)
+void printResult(const char* text, int supported, struct PerformanceQuantiles* performance)
 {
 	printf(text);
 	if(supported) {
-		if(vector_empty(performanceList) != 0)
+		if(quantile_empty(&performance->median) != 0)
 			printf("measurement error\n");
 		else {
 
 			// print median
-			printFloatSI(vector_get(performanceList, vector_size(performanceList) / 2));
+			printFloatSI(quantile_get(&performance->median));
 			printf("FLOPS");
 
 			// print dispersion using IQR (Interquartile Range);
 			// Q1 is the value in 25% and Q3 in 75%
 			printf("  (Q1: ");
-			printFloatSI(vector_get(performanceList, vector_size(performanceList) / 4));
+			printFloatSI(quantile_get(&performance->q1));
 			printf("FLOPS, Q3: ");
-			printFloatSI(vector_get(performanceList, vector_size(performanceList) * 3 / 4));
+			printFloatSI(quantile_get(&performance->q3));
 			printf("FLOPS)\n");
 		}
 	}
@@ -190,20 +388,71 @@ void printResult(const char* text, int supported, struct FloatVector* performanc
 
 int main(int argc, char* argv[])
 {
+	int printHelp = 0;
+	int i;
+
 	assert(sizeof(long) == 4 && "Wrong long type size.");
 
+	// parse number of threads
+	for(i=1; i<argc; i++) {
+		if(argv[i][0] >= '0' && argv[i][0] <= '9') {
+			char* endp = NULL;
+			numThreads = strtoul(argv[i], &endp, 10);
+			if(numThreads == 0 || endp == argv[i] || *endp != 0)
+				printHelp = 1;
+		}
+		else
+			printHelp = 1;
+	}
+
+	// print help
+	if(printHelp) {
+		printf("%s prints the performance of your CPU\n"
+		       "\n"
+		       "Usage: %s [numThreads]\n"
+		       "\n"
+		       "numThreads - run test using specified number of threads.\n"
+		       "             Print the total performance of all the threads.\n"
+		       "             If omitted, single threaded test is used.\n",
+		       appName, appName);
+		return 99;
+	}
+
+	// only single thread if no multithreading support
+#if !defined(USE_PTHREADS)
+	if(numThreads != 1) {
+		printf("Requested %u threads, but the application was compiled\n"
+		       "without multithreading support. Terminating.\n", numThreads);
+		return 99;
+	}
+#endif
+
 	printf("%s prints the performance of the CPU\n\n", appName);
 	printCpuInfo();
 
-	printf("Running tests...\n");
+	// create worker threads
+#if defined(USE_PTHREADS)
+	if(numThreads != 1)
+		if(!createWorkerPool()) {
+			printf("Failed to create worker threads.\n");
+			destroyWorkerPool();
+			return 1;
+		}
+#endif
+
+	if(numThreads == 1)  printf("Running tests...\n");
+	else  printf("Running tests using %u threads...\n", numThreads);
 	{
 		enum { arraySize = 2 };
 		unsigned i;
 		unsigned numWorkgroups[arraySize] = { 1,1 };
-		struct FloatVector performanceList[arraySize];
+		struct PerformanceQuantiles performance[arraySize];
 		unsigned long startTick = getTimestamp();
-		for(i=0; i<arraySize; i++)
-			vector_init(&performanceList[i]);
+		for(i=0; i<arraySize; i++) {
+			quantile_init(&performance[i].q1, 0.25f);
+			quantile_init(&performance[i].median, 0.5f);
+			quantile_init(&performance[i].q3, 0.75f);
+		}
 		do {
 
 			// perform tests
@@ -212,7 +461,7 @@ int main(int argc, char* argv[])
 			t[0] = performTest(fmaFloatComputation1, numWorkgroups[0]);
 			t[1] = performTest(fmaDoubleComputation1, numWorkgroups[1]);
 			for(i=0; i<arraySize; i++)
-				processResult(t[i], numWorkgroups[i], &performanceList[i]);
+				processResult(t[i], numWorkgroups[i], &performance[i]);
 
 			// stop measurements after three seconds
 			totalTime = (float)(getTimestamp() - startTick) * timestampPeriod;
@@ -225,21 +474,19 @@ int main(int argc, char* argv[])
 
 		} while(1);
 
-		// sort the results
-		for(i=0; i<arraySize; i++)
-			vector_sort(&performanceList[i]);
-
 		// print results
 		printf("Float (float32) performance\n");
-		printResult("   non-parallel FMA:    ", 1, &performanceList[0]);
+		printResult("   non-parallel FMA:    ", 1, &performance[0]);
 		printf("Double (float64) performance\n");
-		printResult("   non-parallel FMA:    ", 1, &performanceList[1]);
+		printResult("   non-parallel FMA:    ", 1, &performance[1]);
 		printf("\n");
-
-		// destroy lists
-		for(i=0; i<arraySize; i++)
-			vector_destroy(&performanceList[i]);
 	}
 
+	// destroy worker threads
+#if defined(USE_PTHREADS)
+	if(numThreads != 1)
+		destroyWorkerPool();
+#endif
+
 	return 0;
 }
@@ -1,11 +1,23 @@
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
+#include <thread>
+#include <tuple>
+#include "cpuInfo.h"
 #if _M_X64
 #include <intrin.h>
 #endif
-#if defined(__arm__) || defined(__aarch64__)
+#if defined(__arm__) || defined(__aarch64__) || defined(__linux__)
 #include <fstream>
 #endif
+#if defined(__linux__)
+#include <filesystem>
+#include <string>
+#include <sched.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN  // exclude rarely-used services inclusion by windows.h
+#include <windows.h>
+#endif
 
 using namespace std;
 
@@ -821,3 +833,304 @@ void printCpuInfo()
 
 #endif
 }
+
+
+bool hasInvariantTimestampCounter()
+{
+#if defined(__aarch64__)
+
+	// CNTVCT_EL0 counts at the constant frequency of the system counter
+	// regardless of the core clock and it is accessible from the user space
+	return true;
+
+#elif defined(__arm__)
+
+	// 32-bit ARM may not allow user space access to the virtual counter
+	return false;
+
+#else
+
+	// invariant TSC is reported by bit 8 of EDX of cpuid function 0x80000007
+	uint32_t highestExtendedFunction;
+	uint32_t advancedPowerManagementEDX;
+
+# if __GNUC__
+
+	// gcc assembler code
+	asm volatile(
+
+		"mov $0x80000000,%%eax\n"
+		"cpuid\n"
+		"mov %%eax,%0\n"
+
+			: "=rm"(highestExtendedFunction)
+			:
+			: "%eax", "%ebx", "%ecx", "%edx");
+
+	if(highestExtendedFunction < 0x80000007)
+		return false;
+
+	asm volatile(
+
+		"mov $0x80000007,%%eax\n"
+		"cpuid\n"
+		"mov %%edx,%0\n"
+
+			: "=rm"(advancedPowerManagementEDX)
+			:
+			: "%eax", "%ebx", "%ecx", "%edx");
+
+# else
+
+	// assembler of Intel, Visual C++,...
+#  if _M_X64
+
+	int info[4];
+	__cpuid(info, 0x80000000);
+	highestExtendedFunction = info[0];
+	if(highestExtendedFunction < 0x80000007)
+		return false;
+	__cpuid(info, 0x80000007);
+	advancedPowerManagementEDX = info[3];
+
+#  else
+
+	__asm {
+		mov eax,0x80000000
+		cpuid
+		mov highestExtendedFunction,eax
+	};
+	if(highestExtendedFunction < 0x80000007)
+		return false;
+	__asm {
+		mov eax,0x80000007
+		cpuid
+		mov advancedPowerManagementEDX,edx
+	};
+
+#  endif
+# endif
+
+	return (advancedPowerManagementEDX & 0x100) != 0;
+
+#endif
+}
+
+
+#if defined(__linux__)
+
+// Parse cpu list in the format used by sysfs, such as "0-3,8,10-11".
+static vector<unsigned> parseCpuList(const string& text)
+{
+	vector<unsigned> list;
+	size_t pos = 0;
+	while(pos < text.size()) {
+		size_t end = text.find(',', pos);
+		if(end == string::npos)
+			end = text.size();
+		string item = text.substr(pos, end - pos);
+		size_t dash = item.find('-');
+		try {
+			if(dash == string::npos) {
+				if(!item.empty() && item[0] != '\n')
+					list.push_back(stoul(item));
+			}
+			else {
+				unsigned first = stoul(item.substr(0, dash));
+				unsigned last = stoul(item.substr(dash + 1));
+				for(unsigned i=first; i<=last; i++)
+					list.push_back(i);
+			}
+		} catch(exception&) {
+			// ignore malformed items
+		}
+		pos = end + 1;
+	}
+	return list;
+}
+
+
+// Read the first line of a sysfs file.
+// Empty string is returned if the file does not exist.
+static string readSysfsLine(const string& fileName)
+{
+	ifstream f(fileName);
+	string line;
+	getline(f, line);
+	return line;
+}
+
+#endif
+
+
+vector<LogicalProcessor> getCpuTopology()
+{
+	vector<LogicalProcessor> topology;
+
+#if defined(__linux__)
+
+	// online logical processors
+	vector<unsigned> cpuList = parseCpuList(readSysfsLine("/sys/devices/system/cpu/online"));
+	for(unsigned cpu : cpuList) {
+		string path = "/sys/devices/system/cpu/cpu" + to_string(cpu) + "/topology/";
+		string package = readSysfsLine(path + "physical_package_id");
+		string core = readSysfsLine(path + "core_id");
+		LogicalProcessor p;
+		p.id = cpu;
+		p.package = package.empty() ? 0 : unsigned(max(stoi(package), 0));
+		p.numaNode = 0;
+		p.core = core.empty() ? cpu : unsigned(max(stoi(core), 0));
+		p.smtIndex = 0;
+		p.efficiencyCore = false;
+		topology.push_back(p);
+	}
+
+	// NUMA nodes
+	error_code ec;
+	for(const filesystem::directory_entry& e : filesystem::directory_iterator("/sys/devices/system/node", ec)) {
+		string name = e.path().filename().string();
+		if(name.compare(0, 4, "node") != 0 || name.size() == 4 || !isdigit(name[4]))
+			continue;
+		unsigned node = stoul(name.substr(4));
+		for(unsigned cpu : parseCpuList(readSysfsLine(e.path().string() + "/cpulist")))
+			for(LogicalProcessor& p : topology)
+				if(p.id == cpu)
+					p.numaNode = node;
+	}
+
+	// efficiency cores of hybrid processors;
+	// Intel exposes them as cpu_atom PMU, ARM big.LITTLE uses lower cpu_capacity
+	vector<unsigned> atomList = parseCpuList(readSysfsLine("/sys/devices/cpu_atom/cpus"));
+	if(!atomList.empty()) {
+		for(LogicalProcessor& p : topology)
+			p.efficiencyCore = find(atomList.begin(), atomList.end(), p.id) != atomList.end();
+	}
+	else {
+		vector<unsigned> capacityList;
+		for(LogicalProcessor& p : topology) {
+			string c = readSysfsLine("/sys/devices/system/cpu/cpu" + to_string(p.id) + "/cpu_capacity");
+			capacityList.push_back(c.empty() ? 0 : stoul(c));
+		}
+		unsigned maxCapacity = capacityList.empty() ? 0 : *max_element(capacityList.begin(), capacityList.end());
+		for(size_t i=0; i<topology.size(); i++)
+			topology[i].efficiencyCore = capacityList[i] != 0 && capacityList[i] < maxCapacity;
+	}
+
+#endif
+
+	// fallback when topology is not available
+	// (each logical processor is considered a separate core)
+	if(topology.empty()) {
+		unsigned n = max(thread::hardware_concurrency(), 1u);
+		for(unsigned i=0; i<n; i++)
+			topology.push_back({ .id = i, .package = 0, .numaNode = 0, .core = i,
+			                     .smtIndex = 0, .efficiencyCore = false });
+	}
+
+	// SMT index of logical processors sharing the same core
+	sort(topology.begin(), topology.end(),
+		[](const LogicalProcessor& a, const LogicalProcessor& b) {
+			return tie(a.package, a.core, a.id) < tie(b.package, b.core, b.id);
+		});
+	for(size_t i=1; i<topology.size(); i++)
+		if(topology[i].package == topology[i-1].package && topology[i].core == topology[i-1].core)
+			topology[i].smtIndex = topology[i-1].smtIndex + 1;
+	sort(topology.begin(), topology.end(),
+		[](const LogicalProcessor& a, const LogicalProcessor& b) { return a.id < b.id; });
+
+	return topology;
+}
+
+
+void printCpuTopology(const vector<LogicalProcessor>& topology)
+{
+	// count packages, NUMA nodes and cores
+	vector<pair<unsigned,unsigned>> coreList;
+	vector<unsigned> packageList;
+	vector<unsigned> nodeList;
+	unsigned numEfficiencyCores = 0;
+	for(const LogicalProcessor& p : topology) {
+		if(find(packageList.begin(), packageList.end(), p.package) == packageList.end())
+			packageList.push_back(p.package);
+		if(find(nodeList.begin(), nodeList.end(), p.numaNode) == nodeList.end())
+			nodeList.push_back(p.numaNode);
+		if(p.smtIndex == 0) {
+			coreList.emplace_back(p.package, p.core);
+			if(p.efficiencyCore)
+				numEfficiencyCores++;
+		}
+	}
+
+	cout << "   Packages:    " << packageList.size() << "\n"
+	        "   NUMA nodes:  " << nodeList.size() << "\n"
+	        "   Cores:       " << coreList.size();
+	if(numEfficiencyCores != 0)
+		cout << " (" << coreList.size() - numEfficiencyCores << " performance, "
+		     << numEfficiencyCores << " efficiency)";
+	cout << "\n"
+	        "   Logical processors:  " << topology.size() << endl;
+}
+
+
+vector<unsigned> getPinningList(const vector<LogicalProcessor>& topology, PinningPolicy policy)
+{
+	// rank of the core of each logical processor within its NUMA node,
+	// used by scatter policy to alternate between nodes
+	const vector<LogicalProcessor>& t = topology;
+	vector<unsigned> coreRank(t.size(), 0);
+	for(size_t i=0; i<t.size(); i++)
+		for(size_t j=0; j<t.size(); j++)
+			if(t[j].numaNode == t[i].numaNode && t[j].smtIndex == 0 &&
+			   tie(t[j].package, t[j].core) < tie(t[i].package, t[i].core))
+				coreRank[i]++;
+
+	// sort indices of logical processors by the policy;
+	// performance cores always go before efficiency cores
+	vector<size_t> indexList;
+	for(size_t i=0; i<t.size(); i++)
+		if(policy != PinningPolicy::eOnePerCore || t[i].smtIndex == 0)
+			indexList.push_back(i);
+	switch(policy) {
+	case PinningPolicy::eCompact:
+	case PinningPolicy::eOnePerCore:
+		// fill all logical processors of a core, then cores of a node, then nodes
+		// (one-per-core uses just the first logical processor of each core)
+		sort(indexList.begin(), indexList.end(),
+			[&](size_t a, size_t b) {
+				return tie(t[a].efficiencyCore, t[a].numaNode, t[a].package, t[a].core, t[a].smtIndex) <
+				       tie(t[b].efficiencyCore, t[b].numaNode, t[b].package, t[b].core, t[b].smtIndex);
+			});
+		break;
+	case PinningPolicy::eScatter:
+		// one logical processor per core alternating between nodes,
+		// then the second logical processors of the cores, etc.
+		sort(indexList.begin(), indexList.end(),
+			[&](size_t a, size_t b) {
+				return tie(t[a].efficiencyCore, t[a].smtIndex, coreRank[a], t[a].numaNode) <
+				       tie(t[b].efficiencyCore, t[b].smtIndex, coreRank[b], t[b].numaNode);
+			});
+		break;
+	}
+
+	vector<unsigned> pinningList;
+	for(size_t i : indexList)
+		pinningList.push_back(t[i].id);
+	return pinningList;
+}
+
+
+bool pinCurrentThread(unsigned logicalProcessorId)
+{
+#if defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(logicalProcessorId, &set);
+	return sched_setaffinity(0, sizeof(set), &set) == 0;  // pid 0 is the calling thread
+#elif defined(_WIN32)
+	if(logicalProcessorId >= sizeof(DWORD_PTR) * 8)
+		return false;
+	return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << logicalProcessorId) != 0;
+#else
+	return false;
+#endif
+}
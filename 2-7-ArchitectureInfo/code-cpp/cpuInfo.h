@@ -1 +1,37 @@
+#pragma once
+
+#include <vector>
+
+
+// processor info
 void printCpuInfo();
+bool hasInvariantTimestampCounter();
+
+
+// logical processor and its place in the topology
+struct LogicalProcessor {
+	unsigned id;  // logical processor number used by the operating system
+	unsigned package;
+	unsigned numaNode;
+	unsigned core;  // core id, unique within the package
+	unsigned smtIndex;  // index among the logical processors of the same core
+	bool efficiencyCore;  // efficiency core of a hybrid processor
+};
+
+// thread pinning policies
+enum class PinningPolicy {
+	eCompact,  // fill all logical processors of a core before the next core
+	eScatter,  // spread threads over nodes and cores, use SMT siblings last
+	eOnePerCore,  // single thread per core, SMT siblings are not used
+};
+
+// Topology of the online logical processors, sorted by id.
+// Linux sysfs is used; elsewhere, each logical processor is reported as a separate core.
+std::vector<LogicalProcessor> getCpuTopology();
+void printCpuTopology(const std::vector<LogicalProcessor>& topology);
+
+// Logical processor ids in the order in which threads are pinned by the policy.
+std::vector<unsigned> getPinningList(const std::vector<LogicalProcessor>& topology, PinningPolicy policy);
+
+// Restrict the calling thread to the given logical processor.
+bool pinCurrentThread(unsigned logicalProcessorId);
@@ -1,31 +1,175 @@
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <chrono>
 #include <cmath>
 #include <cstring>
+#include <iomanip>
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
 #include "cpuInfo.h"
+#include "perfCounters.h"
+#include "shaderComputation.h"
 #if !defined(NO_MULTITHREADING)
 # include <latch>
+# include <mutex>
 # include <thread>
 #endif
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+# include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+#endif
 
 using namespace std;
 
 
 // constants
 constexpr const char* appName = "2-7-ArchitectureInfo-cpp";
+constexpr const size_t maxNumChains = 16;  // FMA computations are measured with 1 to maxNumChains independent chains
+constexpr const float measuringTimePerTest = 0.3f;  // measuring time in seconds per each test; the total time is the sum over all tests
+constexpr const float saturationThreshold = 0.95f;  // fraction of the maximal performance that is considered saturated
+constexpr const float cycleCounterCalibrationTime = 0.1f;  // time in seconds used to calibrate cycle counter against the clock of operating system
+constexpr const float coreFrequencyMeasuringTime = 0.2f;  // time in seconds used to measure effective core frequency
+constexpr const float sweepMeasuringTime = 0.5f;  // measuring time in seconds of each thread count of the scaling sweep
 
 
 // forward declarations
 static inline float getCpuTimestampPeriod();
 static inline uint64_t getCpuTimestamp();
+static inline bool isCycleCounterSupported();
+static inline uint64_t getCycleCounter();
 
 
 // global variables
 static unsigned numThreads = 1;
 static float cpuTimestampPeriod;
+static bool useCycleCounter = false;
+static vector<unsigned> pinningList;  // logical processor of each thread; empty if threads are not pinned
+
+
+// Pin the calling thread to its logical processor if pinning is enabled.
+static inline void pinThread(unsigned threadIndex)
+{
+	if(!pinningList.empty())
+		pinCurrentThread(pinningList[threadIndex % pinningList.size()]);
+}
+
+
+// 16-bit floating point types.
+//
+// Half precision uses _Float16 if supported by the compiler. Its arithmetic is native
+// on processors with AVX512-FP16 or ARMv8.2 FP16; otherwise, the compiler
+// computes in float32 and converts the results back (using F16C instructions if enabled).
+// Bfloat16 uses __bf16 of the compiler if it supports arithmetic on it;
+// otherwise, software emulation is used that computes in float32
+// and rounds the results to bfloat16.
+#if defined(__FLT16_MAX__)
+using float16 = _Float16;
+constexpr const bool float16Supported = true;
+# if defined(__AVX512FP16__) || defined(__ARM_FEATURE_FP16_SCALAR_ARITHMETIC)
+constexpr const char* float16Arithmetic = "native";
+# elif defined(__F16C__)
+constexpr const char* float16Arithmetic = "float32 with F16C conversions";
+# else
+constexpr const char* float16Arithmetic = "float32 with software conversions";
+# endif
+#else
+using float16 = float;  // placeholder, not measured
+constexpr const bool float16Supported = false;
+constexpr const char* float16Arithmetic = "";
+#endif
+
+#if defined(__BFLT16_MAX__)
+using bfloat16 = __bf16;
+constexpr const char* bfloat16Arithmetic = "float32 with __bf16 conversions of the compiler";
+#else
+struct bfloat16 {
+	uint16_t bits;
+	bfloat16() = default;
+	bfloat16(float v) {
+		// round to nearest even
+		uint32_t u = bit_cast<uint32_t>(v);
+		u += 0x7fff + ((u >> 16) & 1);
+		bits = uint16_t(u >> 16);
+	}
+	operator float() const  { return bit_cast<float>(uint32_t(bits) << 16); }
+	bfloat16& operator+=(float v)  { *this = float(*this) + v; return *this; }
+	bfloat16& operator*=(float v)  { *this = float(*this) * v; return *this; }
+};
+constexpr const char* bfloat16Arithmetic = "float32 with software conversions";
+#endif
+
+
+// Read the timer used for the measurements.
+//
+// It is the invariant TSC on x86 or CNTVCT on ARM if available;
+// otherwise, clock of the operating system is used.
+// The period of the timer in seconds is stored in cpuTimestampPeriod.
+static inline uint64_t readTimer()
+{
+	return useCycleCounter ? getCycleCounter() : getCpuTimestamp();
+}
+
+
+// Calibrate cycle counter against the clock of the operating system.
+//
+// Both clocks are read at the beginning and at the end of cycleCounterCalibrationTime.
+// It returns the period of the cycle counter in seconds.
+static float calibrateCycleCounter()
+{
+	float osPeriod = getCpuTimestampPeriod();
+	uint64_t c1 = getCycleCounter();
+	uint64_t t1 = getCpuTimestamp();
+	uint64_t c2, t2;
+	do {
+		c2 = getCycleCounter();
+		t2 = getCpuTimestamp();
+	} while(float(t2 - t1) * osPeriod < cycleCounterCalibrationTime);
+	return float(double(t2 - t1) * osPeriod / double(c2 - c1));
+}
+
+
+// Measure effective frequency of the core executing the calling thread.
+//
+// It executes chain of dependent integer additions. Addition has the latency
+// of a single clock cycle on all recent x86 and ARM cores, so the number
+// of additions divided by the elapsed time gives the core clock frequency
+// including any turbo or power saving state. Register operand is added
+// instead of an immediate value, because some cores eliminate additions
+// of immediate values during register renaming. The frequency is measured
+// in short steps and the median of the steps is returned.
+// Zero is returned if the measurement is not supported on the current platform.
+static float measureCoreFrequency()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+
+	constexpr const unsigned numIterations = 10000;  // each iteration performs 100 additions
+	vector<float> frequencyList;
+	uint64_t startTime = readTimer();
+	do {
+		size_t x = 0;
+		size_t one = 1;
+		uint64_t t1 = readTimer();
+		for(unsigned i=0; i<numIterations; i++) {
+		# if defined(__aarch64__)
+			asm volatile(".rept 100\n" "add %0, %0, %1\n" ".endr\n" : "+r"(x) : "r"(one));
+		# else
+			asm volatile(".rept 100\n" "add %1, %0\n" ".endr\n" : "+r"(x) : "r"(one));
+		# endif
+		}
+		uint64_t t2 = readTimer();
+		frequencyList.push_back(float(numIterations * 100) / (float(t2 - t1) * cpuTimestampPeriod));
+	} while(float(readTimer() - startTime) * cpuTimestampPeriod < coreFrequencyMeasuringTime);
+	sort(frequencyList.begin(), frequencyList.end());
+	return frequencyList[frequencyList.size()/2];
+
+#else
+	return 0.f;
+#endif
+}
 
 
 // Convert float value to c-string.
@@ -95,497 +239,80 @@ static auto formatFloatSI(float v)
 }
 
 
-template<typename T> static void shaderFmaComputation1(
-	unsigned globalInvocationIdX, unsigned globalInvocationIdY, unsigned globalInvocationIdZ)
+// List of tests of type T: FMA computations with 1 to sizeof...(I) chains
+// followed by Mul+Add computation with 3 chains.
+template<typename T, size_t... I>
+static constexpr auto makeTestGroup(index_sequence<I...>)
 {
-	// no parallelism, number of used registers: 3
-#define FMA1_10 \
-	x = x * y + z; \
-	x = x * y + z; \
-	x = x * y + z; \
-	x = x * y + z; \
-	x = x * y + z; \
-	x = x * y + z; \
-	x = x * y + z; \
-	x = x * y + z; \
-	x = x * y + z; \
-	x = x * y + z
-
-#define FMA1_100 \
-	FMA1_10; \
-	FMA1_10; \
-	FMA1_10; \
-	FMA1_10; \
-	FMA1_10; \
-	FMA1_10; \
-	FMA1_10; \
-	FMA1_10; \
-	FMA1_10; \
-	FMA1_10
-
-#define FMA1_1000 \
-	FMA1_100; \
-	FMA1_100; \
-	FMA1_100; \
-	FMA1_100; \
-	FMA1_100; \
-	FMA1_100; \
-	FMA1_100; \
-	FMA1_100; \
-	FMA1_100; \
-	FMA1_100
-
-	// initial values for the computation
-	// (make each variable in the range 0.0 to 0.16383)
-	T x = T(globalInvocationIdX & 0x3fff) * 0.00001;
-	T y = T(globalInvocationIdY & 0x3fff) * 0.00001;
-	T z = T(globalInvocationIdZ & 0x3fff) * 0.00001;
-
-	FMA1_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x == T(10)) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y;
-	}
-
-#if 0
-	// initial values of x, y and z
-	T x = globalInvocationIdX;
-	T y = globalInvocationIdY;
-	T z = globalInvocationIdZ;
-
-	FMA1_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x == 0.1f) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y;
-	}
-#endif
+	return array<void(*)(unsigned, unsigned, unsigned), sizeof...(I) + 1>{
+		shaderComputation<T, I+1>...,
+		shaderComputation<T, 3, false>
+	};
 }
 
 
-template<typename T> static void shaderFmaComputation2(
-	unsigned globalInvocationIdX, unsigned globalInvocationIdY, unsigned globalInvocationIdZ)
+// Float16 tests compiled for F16C and AVX512-FP16.
+//
+// Unless the whole program is compiled for AVX512-FP16, the float16 tests are compiled
+// also for these instruction set extensions using target attributes and the best one
+// supported by the processor is selected at runtime. Otherwise, default x86 builds
+// would convert every float16 result by a software routine.
+// Flatten attribute inlines all the computation steps, so they get the target as well.
+#if defined(__FLT16_MAX__) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(__AVX512FP16__)
+# define FLOAT16_RUNTIME_DISPATCH
+template<size_t numChains, bool fused = true>
+__attribute__((target("f16c"), flatten))
+static void shaderComputationF16C(unsigned globalInvocationIdX, unsigned globalInvocationIdY, unsigned globalInvocationIdZ)
 {
-	// two computations in parallel, number of used registers: 5
-#define FMA2_10 \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z
-
-#define FMA2_100 \
-	FMA2_10; \
-	FMA2_10; \
-	FMA2_10; \
-	FMA2_10; \
-	FMA2_10; \
-	FMA2_10; \
-	FMA2_10; \
-	FMA2_10; \
-	FMA2_10; \
-	FMA2_10
-
-#define FMA2_1000 \
-	FMA2_100; \
-	FMA2_100; \
-	FMA2_100; \
-	FMA2_100; \
-	FMA2_100; \
-	FMA2_100; \
-	FMA2_100; \
-	FMA2_100; \
-	FMA2_100; \
-	FMA2_100
-
-	// initial values for the computation
-	// (make x1, y1 and z in the range 0.0 to 0.16383,
-	// and x2 and y2 less than 0.333)
-	T x1 = T(globalInvocationIdX & 0x3fff) * 0.00001;
-	T y1 = T(globalInvocationIdY & 0x3fff) * 0.00001;
-	T z = T(globalInvocationIdZ & 0x3fff) * 0.00001;
-	T x2 = x1 + 0.165f;
-	T y2 = y1 + 0.165f;
-
-	FMA2_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x1 == T(10) || x2 == T(10)) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y1 + y2;
-	}
-
-#if 0
-	// initial values for the computation
-	T x1 = globalInvocationIdX;
-	T y1 = globalInvocationIdY;
-	T z = globalInvocationIdZ;
-	T x2 = x1 + 0.5f;
-	T y2 = y1 + 0.5f;
-
-	FMA2_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x1 == 0.1f || x2 == 0.1f) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y1 + y2;
-	}
-#endif
+	shaderComputation<float16, numChains, fused>(globalInvocationIdX, globalInvocationIdY, globalInvocationIdZ);
 }
 
-
-template<typename T> static void shaderFmaComputation3(
-	unsigned globalInvocationIdX, unsigned globalInvocationIdY, unsigned globalInvocationIdZ)
+template<size_t numChains, bool fused = true>
+__attribute__((target("avx512fp16"), flatten))
+static void shaderComputationAvx512Fp16(unsigned globalInvocationIdX, unsigned globalInvocationIdY, unsigned globalInvocationIdZ)
 {
-	// three computations in parallel, number of used registers: 7
-#define FMA3_9 \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x3 = x3 * y3 + z; \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x3 = x3 * y3 + z; \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x3 = x3 * y3 + z
-
-#define FMA3_99 \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9; \
-	FMA3_9
-
-#define FMA3_1000 \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_99; \
-	FMA3_9; \
-	x1 = x1 * y1 + z
-
-	// initial values for the computation
-	// (make x1, y1 and z in the range 0.0 to 0.16383,
-	// and x2, y2, x3 and y3 less than 0.333)
-	T x1 = T(globalInvocationIdX & 0x3fff) * 0.00001;
-	T y1 = T(globalInvocationIdY & 0x3fff) * 0.00001;
-	T z = T(globalInvocationIdZ & 0x3fff) * 0.00001;
-	T x2 = x1 + 0.165f;
-	T y2 = y1 + 0.1f;
-	T x3 = x1 + 0.1f;
-	T y3 = y1 + 0.165f;
-
-	FMA3_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x1 == T(10) || x2 == T(10) || x3 == T(10)) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y1 + y2 + y3;
-	}
-
-#if 0
-	// initial values for the computation
-	T x1 = globalInvocationIdX;
-	T y1 = globalInvocationIdY;
-	T z = globalInvocationIdZ;
-	T x2 = x1 + 0.5f;
-	T y2 = y1 + 0.5f;
-	T x3 = x1 + 0.25f;
-	T y3 = y1 + 0.25f;
-
-	FMA3_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x1 == 0.1f || x2 == 0.1f || x3 == 0.1f) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y1 + y2 + y3;
-	}
-#endif
+	shaderComputation<float16, numChains, fused>(globalInvocationIdX, globalInvocationIdY, globalInvocationIdZ);
 }
 
-
-template<typename T> static void shaderMulAddComputation3(
-	unsigned globalInvocationIdX, unsigned globalInvocationIdY, unsigned globalInvocationIdZ)
+template<size_t... I>
+static constexpr auto makeTestGroupF16C(index_sequence<I...>)
 {
-	// three computations in parallel, number of used registers: 7
-
-#define MulAdd_Prologue \
-	x2 *= y2
-
-#define MulAdd_9 \
-	x1 *= y1; \
-	x2 += z;  \
-	x3 *= y3; \
-	x1 += z;  \
-	x2 *= y2; \
-	x3 += z;  \
-	x1 *= y1; \
-	x2 += z;  \
-	x3 *= y3; \
-	x1 += z;  \
-	x2 *= y2; \
-	x3 += z;  \
-	x1 *= y1; \
-	x2 += z;  \
-	x3 *= y3; \
-	x1 += z;  \
-	x2 *= y2; \
-	x3 += z
-
-#define MulAdd_Epilogue \
-	x2 += z
-
-#define MulAdd_99 \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9; \
-	MulAdd_9
-
-#define MulAdd_1000 \
-	MulAdd_Prologue; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_99; \
-	MulAdd_9; \
-	MulAdd_Epilogue
-
-	// initial values for the computation
-	// (make x1, y1 and z in the range 0.0 to 0.16383,
-	// and x2, y2, x3 and y3 less than 0.333)
-	T x1 = T(globalInvocationIdX & 0x3fff) * 0.00001;
-	T y1 = T(globalInvocationIdY & 0x3fff) * 0.00001;
-	T z = T(globalInvocationIdZ & 0x3fff) * 0.00001;
-	T x2 = x1 + 0.165f;
-	T y2 = y1 + 0.1f;
-	T x3 = x1 + 0.1f;
-	T y3 = y1 + 0.165f;
-
-	MulAdd_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x1 == T(10) || x2 == T(10) || x3 == T(10)) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y1 + y2 + y3;
-	}
-
-#if 0
-	// initial values for the computation
-	T x1 = globalInvocationIdX;
-	T y1 = globalInvocationIdY;
-	T z = globalInvocationIdZ;
-	T x2 = x1 + 0.5f;
-	T y2 = y1 + 0.5f;
-	T x3 = x1 + 0.25f;
-	T y3 = y1 + 0.25f;
-
-	MulAdd_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x1 == 0.1f || x2 == 0.1f || x3 == 0.1f) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y1 + y2 + y3;
-	}
-#endif
+	return array<void(*)(unsigned, unsigned, unsigned), sizeof...(I) + 1>{
+		shaderComputationF16C<I+1>...,
+		shaderComputationF16C<3, false>
+	};
 }
 
-
-template<typename T> static void shaderFmaComputation4(
-	unsigned globalInvocationIdX, unsigned globalInvocationIdY, unsigned globalInvocationIdZ)
+template<size_t... I>
+static constexpr auto makeTestGroupAvx512Fp16(index_sequence<I...>)
 {
-	// four computations in parallel, number of used registers: 9
-#define FMA4_8 \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x3 = x3 * y3 + z; \
-	x4 = x4 * y4 + z; \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x3 = x3 * y3 + z; \
-	x4 = x4 * y4 + z
-
-#define FMA4_100 \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	FMA4_8; \
-	x1 = x1 * y1 + z; \
-	x2 = x2 * y2 + z; \
-	x3 = x3 * y3 + z; \
-	x4 = x4 * y4 + z
-
-#define FMA4_1000 \
-	FMA4_100; \
-	FMA4_100; \
-	FMA4_100; \
-	FMA4_100; \
-	FMA4_100; \
-	FMA4_100; \
-	FMA4_100; \
-	FMA4_100; \
-	FMA4_100; \
-	FMA4_100
-
-	// initial values for the computation
-	// (make x1, y1 and z in the range 0.0 to 0.16383,
-	// and x2, y2, x3, y3, x4 and y4 less than 0.333)
-	T x1 = T(globalInvocationIdX & 0x3fff) * 0.00001;
-	T y1 = T(globalInvocationIdY & 0x3fff) * 0.00001;
-	T z = T(globalInvocationIdZ & 0x3fff) * 0.00001;
-	T x2 = x1 + 0.165f;
-	T y2 = y1 + 0.1f;
-	T x3 = x1 + 0.05f;
-	T y3 = y1 + 0.165f;
-	T x4 = x1 + 0.1f;
-	T y4 = y1 + 0.05f;
-
-	FMA4_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x1 == T(10) || x2 == T(10) || x3 == T(10) || x4 == T(10)) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y1 + y2 + y3 + y4;
-	}
-
-#if 0
-	// initial values for the computation
-	T x1 = globalInvocationIdX;
-	T y1 = globalInvocationIdY;
-	T z = globalInvocationIdZ;
-	T x2 = x1 + 0.5f;
-	T y2 = y1 + 0.5f;
-	T x3 = x1 + 0.25f;
-	T y3 = y1 + 0.25f;
-	T x4 = x1 + 0.75f;
-	T y4 = y1 + 0.75f;
-
-	FMA4_1000;
-
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x1 == 0.1f || x2 == 0.1f || x3 == 0.1f || x4 == 0.1f) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y1 + y2 + y3 + y4;
-	}
+	return array<void(*)(unsigned, unsigned, unsigned), sizeof...(I) + 1>{
+		shaderComputationAvx512Fp16<I+1>...,
+		shaderComputationAvx512Fp16<3, false>
+	};
+}
 #endif
 
-#if 0
-	array<T,4> x;
-	array<T,4> y;
-	array<T,4> z;
-	x[0] = T(globalInvocationIdX);
-	x[1] = T(globalInvocationIdX) + 0.5f;
-	x[2] = T(globalInvocationIdX) + 0.25f;
-	x[3] = T(globalInvocationIdX) + 0.75f;
-	y[0] = T(globalInvocationIdY);
-	y[1] = T(globalInvocationIdY) + 0.5f;
-	y[2] = T(globalInvocationIdY) + 0.25f;
-	y[3] = T(globalInvocationIdY) + 0.75f;
-	z[0] = T(globalInvocationIdZ);
-	z[1] = T(globalInvocationIdZ);
-	z[2] = T(globalInvocationIdZ);
-	z[3] = T(globalInvocationIdZ);
-	for(size_t i=0; i<10000; i++) {
-		x[0] = x[0] * y[0] + z[0];
-		x[1] = x[1] * y[1] + z[1];
-		x[2] = x[2] * y[2] + z[2];
-		x[3] = x[3] * y[3] + z[3];
-	}
 
-	// condition that will never be true in reality
-	// (this avoids optimizer to consider the results of previous computations as unused
-	// and to optimize the final shader code by their removal)
-	if(x[0] == 0.1f || x[1] == 0.1f || x[2] == 0.1f || x[3] == 0.1f) {
-		// write to artificially generated address
-		// (the write will never happen in reality)
-		*reinterpret_cast<T*>(size_t(globalInvocationIdZ)) = y[0] + y[1] + y[2] + y[3];
+// List of float16 tests for the best code path supported by the processor.
+// The description of the selected path is returned in arithmetic.
+template<size_t... I>
+static auto makeFloat16TestGroup(index_sequence<I...> seq, string& arithmetic)
+{
+#if defined(FLOAT16_RUNTIME_DISPATCH)
+	if(__builtin_cpu_supports("avx512fp16")) {
+		arithmetic = "native (AVX512-FP16 selected at runtime)";
+		return makeTestGroupAvx512Fp16(seq);
+	}
+# if !defined(__F16C__)
+	if(__builtin_cpu_supports("f16c")) {
+		arithmetic = "float32 with F16C conversions (selected at runtime)";
+		return makeTestGroupF16C(seq);
 	}
+# endif
 #endif
-}
-
-
-static void workgroupInvocation(void (*func)(unsigned, unsigned, unsigned),
-	unsigned workgroupIdX, unsigned workgroupIdY, unsigned workgroupIdZ)
-{
-	// call 128 shader invocations
-	// each processing 20'000 floating instructions
-	for(unsigned y=0; y<4; y++)
-		for(unsigned x=0; x<32; x++)
-			func(
-				workgroupIdX*32 + x,
-				workgroupIdY*4 + y,
-				workgroupIdZ
-			);
+	arithmetic = float16Arithmetic;
+	return makeTestGroup<float16>(seq);
 }
 
 
@@ -596,6 +323,10 @@ int main(int argc, char* argv[])
 	try {
 
 		bool printHelp = false;
+		bool perfCountersEnabled = false;
+		bool pinningEnabled = false;
+		PinningPolicy pinningPolicy = PinningPolicy::eCompact;
+		bool sweepEnabled = false;
 		for(int i=1; i<argc; i++) {
 
 			// parse number of threads
@@ -616,6 +347,38 @@ int main(int argc, char* argv[])
 					continue;
 				}
 
+				// thread pinning
+				if(strcmp(argv[i], "-p") == 0 || strcmp(argv[i], "--pin") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					if(strcmp(argv[i], "compact") == 0)
+						pinningPolicy = PinningPolicy::eCompact;
+					else if(strcmp(argv[i], "scatter") == 0)
+						pinningPolicy = PinningPolicy::eScatter;
+					else if(strcmp(argv[i], "core") == 0)
+						pinningPolicy = PinningPolicy::eOnePerCore;
+					else
+						printHelp = true;
+					pinningEnabled = true;
+					continue;
+				}
+
+				// scaling sweep
+				if(strcmp(argv[i], "-w") == 0 || strcmp(argv[i], "--sweep") == 0) {
+					sweepEnabled = true;
+					pinningEnabled = true;
+					continue;
+				}
+
+				// hardware performance counters
+				if(strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--counters") == 0) {
+					perfCountersEnabled = true;
+					continue;
+				}
+
 				printHelp = true;
 				continue;
 			}
@@ -626,11 +389,27 @@ int main(int argc, char* argv[])
 		if(printHelp) {
 			cout << appName << " prints the performance of your CPU\n"
 			        "\n"
-			        "Usage: " << appName << " [numThreads]\n"
+			        "Usage: " << appName << " [-c] [-p <policy>] [-w] [numThreads]\n"
 			        "\n"
 			        "numThreads - run test using specified number of threads.\n"
 			        "             Print the total performance of all the threads.\n"
 			        "             If omitted, single threaded test is used.\n"
+			        "-c or --counters - print hardware performance counters\n"
+			        "             of each test, such as instructions per cycle,\n"
+			        "             floating point instructions by their width\n"
+			        "             and cache misses; Linux only, it requires\n"
+			        "             perf_event_paranoid to be 2 or lower.\n"
+			        "-p <policy> or --pin <policy> - pin threads to logical processors;\n"
+			        "             policy is one of:\n"
+			        "             compact - fill SMT siblings of a core before the next core,\n"
+			        "             scatter - spread threads over NUMA nodes and cores\n"
+			        "                       and use SMT siblings last,\n"
+			        "             core - one thread per core, SMT siblings are not used;\n"
+			        "             performance cores are used before efficiency cores\n"
+			        "-w or --sweep - measure float FMA performance for each number\n"
+			        "             of threads from one to the number of logical processors\n"
+			        "             selected by the pinning policy (compact by default)\n"
+			        "             and print the scaling curve instead of the regular tests\n"
 			        "\n"
 			        "To measure the maximum performance, make sure that this application\n"
 			        "is compiled in release mode with optimizations turned on and\n"
@@ -654,9 +433,22 @@ int main(int argc, char* argv[])
 		cout << "Processor info:" << endl;
 		printCpuInfo();
 
+		// topology
+		vector<LogicalProcessor> topology = getCpuTopology();
+		cout << "Topology:" << endl;
+		printCpuTopology(topology);
+		if(pinningEnabled)
+			pinningList = getPinningList(topology, pinningPolicy);
+
+		// performance counters
+		if(perfCountersEnabled)
+			perfCountersEnabled = initPerfCounters();
+
 		// perform computation of all workgroups
+		// (values of the performance counters of all the threads are added to counterValues)
 		auto performTest =
-			[&](void (*shaderInvocationFunc)(unsigned, unsigned, unsigned), size_t numWorkgroups) -> float {
+			[&](void (*shaderInvocationFunc)(unsigned, unsigned, unsigned), size_t numWorkgroups,
+			    PerfCounterValues& counterValues) -> float {
 
 				// compute workgroup grid dimensions
 				// (avoid any dimension to go over 10000)
@@ -679,13 +471,19 @@ int main(int argc, char* argv[])
 
 				// perform computation
 				uint64_t ts1, ts2;
+				counterValues.fill(0.);
 				if(numThreads == 1) {
-					ts1 = getCpuTimestamp();
+					pinThread(0);
+					PerfCounters counters(perfCountersEnabled);
+					counters.start();
+					ts1 = readTimer();
 					for(unsigned z=0; z<workgroupCountZ; z++)
 						for(unsigned y=0; y<workgroupCountY; y++)
 							for(unsigned x=0; x<workgroupCountX; x++)
 								workgroupInvocation(shaderInvocationFunc, x, y, z);
-					ts2 = getCpuTimestamp();
+					ts2 = readTimer();
+					counters.stop();
+					counters.addTo(counterValues);
 				}
 				else {
 
@@ -693,9 +491,13 @@ int main(int argc, char* argv[])
 
 					latch l1(1);
 					latch l2(numThreads);
+					mutex counterMutex;
 					auto worker =
 						[&](unsigned id) {
+							pinThread(id);
+							PerfCounters counters(perfCountersEnabled);
 							l1.wait();
+							counters.start();
 							unsigned x = id;
 							unsigned y = 0;
 							unsigned z = 0;
@@ -715,6 +517,11 @@ int main(int argc, char* argv[])
 							}
 							while(true);
 						workerDone:
+							counters.stop();
+							{
+								lock_guard lock(counterMutex);
+								counters.addTo(counterValues);
+							}
 							l2.arrive_and_wait();
 						};
 					vector<thread> threadList;
@@ -725,10 +532,10 @@ int main(int argc, char* argv[])
 						i++;
 					}
 
-					ts1 = getCpuTimestamp();
+					ts1 = readTimer();
 					l1.count_down();
 					worker(0);
-					ts2 = getCpuTimestamp();
+					ts2 = readTimer();
 					for(auto& t : threadList)
 						t.join();
 
@@ -742,12 +549,16 @@ int main(int argc, char* argv[])
 			};
 
 		// record the performance in the list
+		// and add the counter values of valid measurements to counterSum
 		auto processResult =
-			[](float time, size_t numWorkgroups, vector<float>& performanceList) {
+			[](float time, size_t numWorkgroups, vector<float>& performanceList,
+			   const PerfCounterValues& counterValues, PerfCounterValues& counterSum) {
 				if(time >= 0.01f) {
 					uint64_t numInstructions = uint64_t(2000) * 128 * numWorkgroups;
 					float performance = float(numInstructions) / time;
 					performanceList.push_back(performance);
+					for(size_t i=0; i<numPerfCounters; i++)
+						counterSum[i] += counterValues[i];
 				}
 			};
 
@@ -769,35 +580,143 @@ int main(int argc, char* argv[])
 				}
 			};
 
+		// timer
+		// (cycle counter, e.g. invariant TSC on x86 or CNTVCT on ARM, is preferred
+		// for its high resolution and low overhead; it is calibrated against
+		// the clock of operating system)
+		cpuTimestampPeriod = getCpuTimestampPeriod();
+		if(isCycleCounterSupported()) {
+			useCycleCounter = true;
+			cpuTimestampPeriod = calibrateCycleCounter();
+			cout << "Timer:  cycle counter (" << formatFloatSI(1.f / cpuTimestampPeriod) << "Hz)" << endl;
+		}
+		else
+			cout << "Timer:  clock of operating system" << endl;
+
+		// effective core frequency
+		// (it is measured by all the threads at once,
+		// so the frequency corresponds to the load during the tests)
+		vector<float> coreFrequencyList(numThreads);
+		pinThread(0);
+		if(numThreads == 1)
+			coreFrequencyList[0] = measureCoreFrequency();
+		else {
+		#if !defined(NO_MULTITHREADING)
+			vector<thread> threadList;
+			threadList.reserve(numThreads - 1);
+			for(unsigned i=1; i<numThreads; i++)
+				threadList.emplace_back(
+					[&coreFrequencyList, i]() {
+						pinThread(i);
+						coreFrequencyList[i] = measureCoreFrequency();
+					});
+			coreFrequencyList[0] = measureCoreFrequency();
+			for(auto& t : threadList)
+				t.join();
+		#endif
+		}
+		sort(coreFrequencyList.begin(), coreFrequencyList.end());
+		float coreFrequency = coreFrequencyList[coreFrequencyList.size()/2];
+		cout << "Effective core frequency:  ";
+		if(coreFrequency != 0.f)
+			cout << formatFloatSI(coreFrequency) << "Hz" << endl;
+		else
+			cout << "not supported" << endl;
+
+		// scaling sweep
+		// (each step adds one thread pinned to the next logical processor of the pinning policy)
+		if(sweepEnabled) {
+		#if defined(NO_MULTITHREADING)
+			cout << "Scaling sweep requires multithreading support. Terminating." << endl;
+			return 99;
+		#endif
+			cout << "Scaling sweep of float " << maxNumChains << " parallel FMA:\n"
+			        "   threads  performance   speedup  efficiency  added logical processor" << endl;
+			float singleThreadedPerformance = 0.f;
+			for(size_t n=1; n<=pinningList.size(); n++) {
+
+				// measure
+				numThreads = unsigned(n);
+				size_t sweepNumWorkgroups = 1;
+				vector<float> sweepPerformanceList;
+				PerfCounterValues counterValues;
+				PerfCounterValues counterSum = {};
+				chrono::time_point sweepStartTime = chrono::high_resolution_clock::now();
+				do {
+					float t = performTest(shaderComputation<float, maxNumChains>, sweepNumWorkgroups, counterValues);
+					processResult(t, sweepNumWorkgroups, sweepPerformanceList, counterValues, counterSum);
+					sweepNumWorkgroups = computeNumWorkgroups(sweepNumWorkgroups, t);
+				} while(chrono::duration<float>(chrono::high_resolution_clock::now() - sweepStartTime).count() < sweepMeasuringTime);
+				if(sweepPerformanceList.empty()) {
+					cout << "   " << setw(7) << n << "  measurement error" << endl;
+					continue;
+				}
+				sort(sweepPerformanceList.begin(), sweepPerformanceList.end());
+				float performance = sweepPerformanceList[sweepPerformanceList.size()/2];
+				if(n == 1)
+					singleThreadedPerformance = performance;
+
+				// print the point of the scaling curve
+				// with the description of the newly added logical processor
+				const LogicalProcessor& p =
+					*find_if(topology.begin(), topology.end(),
+						[](const LogicalProcessor& p) { return p.id == pinningList[numThreads-1]; });
+				float speedup = performance / singleThreadedPerformance;
+				cout << "   " << setw(7) << n << "  " << formatFloatSI(performance) << "FLOPS"
+				     << fixed << setprecision(2) << setw(10) << speedup
+				     << setw(11) << setprecision(0) << speedup / n * 100.f << "%" << defaultfloat
+				     << "  " << p.id << " (package " << p.package << ", node " << p.numaNode
+				     << ", core " << p.core << ", SMT " << p.smtIndex
+				     << (p.efficiencyCore ? ", efficiency core)" : ")") << endl;
+			}
+			return 0;
+		}
+
 		// run tests
 		cout << "Running tests using ";
 		if(numThreads == 1)  cout << "1 thread..." << endl;
 		else  cout << numThreads << " threads..." << endl;
-		constexpr const size_t arraySize = 10;
-		array<size_t,arraySize> numWorkgroups = { 1,1,1,1,1, 1,1,1,1,1 };
-		array<vector<float>,arraySize> performanceList;
-		cpuTimestampPeriod = getCpuTimestampPeriod();
+
+		// list of tests;
+		// each group contains FMAs with 1..maxNumChains chains and Mul+Add with 3 chains
+		// of one floating point type
+		constexpr const size_t groupSize = maxNumChains + 1;
+		struct TestGroup {
+			string name;
+			array<void(*)(unsigned, unsigned, unsigned), groupSize> testList;
+		};
+		vector<TestGroup> testGroupList;
+		testGroupList.push_back({ "Float (float32) performance", makeTestGroup<float>(make_index_sequence<maxNumChains>()) });
+		testGroupList.push_back({ "Double (float64) performance", makeTestGroup<double>(make_index_sequence<maxNumChains>()) });
+		if constexpr(float16Supported) {
+			string arithmetic;
+			auto testGroup = makeFloat16TestGroup(make_index_sequence<maxNumChains>(), arithmetic);
+			testGroupList.push_back({ "Half (float16) performance, arithmetic: " + arithmetic, testGroup });
+		}
+		testGroupList.push_back({ string("BFloat16 performance, arithmetic: ") + bfloat16Arithmetic,
+		                          makeTestGroup<bfloat16>(make_index_sequence<maxNumChains>()) });
+		vector<void(*)(unsigned, unsigned, unsigned)> testList;
+		for(const TestGroup& g : testGroupList)
+			testList.insert(testList.end(), g.testList.begin(), g.testList.end());
+		const size_t arraySize = testList.size();
+
+		vector<size_t> numWorkgroups(arraySize, 1);
+		vector<vector<float>> performanceList(arraySize);
+		vector<PerfCounterValues> counterSumList(arraySize, PerfCounterValues{});
 		chrono::time_point startTime = chrono::high_resolution_clock::now();
 		do {
 
 			// perform tests
-			array<float,arraySize> t;
-			t[0] = performTest(shaderFmaComputation1<float>, numWorkgroups[0]);
-			t[1] = performTest(shaderFmaComputation2<float>, numWorkgroups[1]);
-			t[2] = performTest(shaderFmaComputation3<float>, numWorkgroups[2]);
-			t[3] = performTest(shaderFmaComputation4<float>, numWorkgroups[3]);
-			t[4] = performTest(shaderMulAddComputation3<float>, numWorkgroups[4]);
-			t[5] = performTest(shaderFmaComputation1<double>, numWorkgroups[5]);
-			t[6] = performTest(shaderFmaComputation2<double>, numWorkgroups[6]);
-			t[7] = performTest(shaderFmaComputation3<double>, numWorkgroups[7]);
-			t[8] = performTest(shaderFmaComputation4<double>, numWorkgroups[8]);
-			t[9] = performTest(shaderMulAddComputation3<double>, numWorkgroups[9]);
+			vector<float> t(arraySize);
+			vector<PerfCounterValues> counterValues(arraySize);
+			for(size_t i=0; i<arraySize; i++)
+				t[i] = performTest(testList[i], numWorkgroups[i], counterValues[i]);
 			for(size_t i=0; i<arraySize; i++)
-				processResult(t[i], numWorkgroups[i], performanceList[i]);
+				processResult(t[i], numWorkgroups[i], performanceList[i], counterValues[i], counterSumList[i]);
 
-			// stop measurements after three seconds
+			// stop measurements after measuringTimePerTest for each test passed
 			double totalTime = chrono::duration<double>(chrono::high_resolution_clock::now() - startTime).count();
-			if(totalTime >= 3.)
+			if(totalTime >= measuringTimePerTest * arraySize)
 				break;
 
 			// compute new numWorkgroups
@@ -812,7 +731,7 @@ int main(int argc, char* argv[])
 
 		// print results
 		auto printResult =
-			[](const string_view text, bool supported, const vector<float>& performanceList) {
+			[&](const string_view text, bool supported, const vector<float>& performanceList) {
 				cout << text;
 				if(supported) {
 					if(performanceList.empty())
@@ -826,24 +745,86 @@ int main(int argc, char* argv[])
 						// Q1 is the value in 25% and Q3 in 75%
 						cout << "  (Q1: " << formatFloatSI(performanceList[performanceList.size()/4]) << "FLOPS,";
 						cout << " Q3: " << formatFloatSI(performanceList[performanceList.size()*3/4]) << "FLOPS)";
+
+						// print FLOPs per cycle and core,
+						// making the results comparable across different clock frequencies
+						if(coreFrequency != 0.f) {
+							float flopsPerCycle = performanceList[performanceList.size()/2] / (coreFrequency * numThreads);
+							cout << "  " << fixed << setprecision(2) << flopsPerCycle << defaultfloat << " FLOPs/cycle/core";
+						}
 						cout << endl;
 					}
 				}
 				else
 					cout << "not supported" << endl;
 			};
-		cout << "Float (float32) performance\n";
-		printResult("   non-parallel FMA:    ", true, performanceList[0]);
-		printResult("   2 parallel FMA:      ", true, performanceList[1]);
-		printResult("   3 parallel FMA:      ", true, performanceList[2]);
-		printResult("   4 parallel FMA:      ", true, performanceList[3]);
-		printResult("   3 parallel Mul+Add:  ", true, performanceList[4]);
-		cout << "Double (float64) performance\n";
-		printResult("   non-parallel FMA:    ", true, performanceList[5]);
-		printResult("   2 parallel FMA:      ", true, performanceList[6]);
-		printResult("   3 parallel FMA:      ", true, performanceList[7]);
-		printResult("   4 parallel FMA:      ", true, performanceList[8]);
-		printResult("   3 parallel Mul+Add:  ", true, performanceList[9]);
+		auto printCounters =
+			[&](const PerfCounterValues& v) {
+				if(!perfCountersEnabled)
+					return;
+
+				// print ratios of the counters;
+				// NaN values of unavailable counters are printed as n/a
+				auto print =
+					[](const char* text, double value) {
+						cout << text;
+						if(isnan(value))
+							cout << "n/a";
+						else
+							cout << value;
+					};
+				cout << fixed << setprecision(2);
+				print("      IPC: ", v[perfInstructions] / v[perfCycles]);
+				double fpSum = v[perfFpScalar] + v[perfFp128] + v[perfFp256] + v[perfFp512];
+				cout << ",  FP instructions by width (scalar/128/256/512-bit): ";
+				if(isnan(fpSum) || fpSum == 0.)
+					cout << "n/a";
+				else
+					cout << setprecision(0) << v[perfFpScalar] / fpSum * 100. << "/"
+					     << v[perfFp128] / fpSum * 100. << "/" << v[perfFp256] / fpSum * 100. << "/"
+					     << v[perfFp512] / fpSum * 100. << "%" << setprecision(2);
+				print(",  L1D misses/Kinstr.: ", v[perfL1dMisses] / v[perfInstructions] * 1000.);
+				print(",  LLC misses/Kinstr.: ", v[perfLlcMisses] / v[perfInstructions] * 1000.);
+				cout << defaultfloat << endl;
+			};
+		auto printSweep =
+			[&](size_t firstTest) {
+
+				// print performance of each number of chains
+				for(size_t i=0; i<maxNumChains; i++) {
+					string text = (i == 0) ? "non-parallel FMA:" : to_string(i+1) + " parallel FMA:";
+					text.resize(22, ' ');
+					printResult("   " + text, true, performanceList[firstTest+i]);
+					printCounters(counterSumList[firstTest+i]);
+				}
+				printResult("   3 parallel Mul+Add:   ", true, performanceList[firstTest+maxNumChains]);
+				printCounters(counterSumList[firstTest+maxNumChains]);
+
+				// the performance grows with the number of chains until FMA units are saturated;
+				// the number of chains needed for the saturation equals to FMA latency times
+				// the number of FMAs issued per clock (latency x throughput product),
+				// and the ratio of the saturated to the non-parallel performance estimates the same product
+				// measured in the units of the instructions the compiler generated (possibly vector instructions)
+				auto median = [](const vector<float>& l) { return l.empty() ? 0.f : l[l.size()/2]; };
+				float maxPerformance = 0.f;
+				for(size_t i=0; i<maxNumChains; i++)
+					maxPerformance = max(maxPerformance, median(performanceList[firstTest+i]));
+				float nonParallelPerformance = median(performanceList[firstTest]);
+				if(maxPerformance == 0.f || nonParallelPerformance == 0.f)
+					return;
+				size_t saturationNumChains = 1;
+				while(median(performanceList[firstTest+saturationNumChains-1]) < maxPerformance * saturationThreshold)
+					saturationNumChains++;
+				cout << "   FMA units saturated at " << saturationNumChains << " parallel FMAs"
+				        " (max/non-parallel performance ratio: " << int(maxPerformance / nonParallelPerformance + 0.5f) << ")" << endl;
+			};
+		for(size_t i=0; i<testGroupList.size(); i++) {
+			cout << testGroupList[i].name << "\n";
+			printSweep(i * groupSize);
+		}
+		if constexpr(!float16Supported)
+			cout << "Half (float16) performance\n"
+			        "   not supported by the compiler" << endl;
 
 	// catch exceptions
 	} catch(exception& e) {
@@ -884,3 +865,29 @@ static inline uint64_t getCpuTimestamp()
 	return tv.tv_nsec + tv.tv_sec*1000000000ull;
 #endif
 }
+
+
+static inline bool isCycleCounterSupported()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	return hasInvariantTimestampCounter();
+#elif defined(__aarch64__) && defined(__GNUC__)
+	return hasInvariantTimestampCounter();
+#else
+	return false;
+#endif
+}
+
+
+static inline uint64_t getCycleCounter()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	return __rdtsc();
+#elif defined(__aarch64__) && defined(__GNUC__)
+	uint64_t v;
+	asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+	return v;
+#else
+	return 0;
+#endif
+}
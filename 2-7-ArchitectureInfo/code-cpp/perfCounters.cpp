@@ -0,0 +1,161 @@
+#include <cmath>
+#include <iostream>
+#include "perfCounters.h"
+#if defined(__linux__)
+# include <cerrno>
+# include <cstring>
+# include <fstream>
+# include <string>
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+using namespace std;
+
+
+#if defined(__linux__)
+
+// configuration of the counters
+struct CounterConfig {
+	uint32_t type;
+	uint64_t config;
+	bool intelOnly;
+};
+static const array<CounterConfig, numPerfCounters> counterConfigList = {{
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, false },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, false },
+
+	// FP_ARITH_INST_RETIRED (event 0xc7) of Intel processors since Broadwell;
+	// umask selects scalar, packed 128-bit, 256-bit and 512-bit instructions, both single and double precision
+	{ PERF_TYPE_RAW, 0x03c7, true },
+	{ PERF_TYPE_RAW, 0x0cc7, true },
+	{ PERF_TYPE_RAW, 0x30c7, true },
+	{ PERF_TYPE_RAW, 0xc0c7, true },
+
+	{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+	                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), false },
+	{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+	                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), false },
+}};
+static bool intelCpu = false;
+
+
+static int openCounter(const CounterConfig& c)
+{
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = c.type;
+	attr.config = c.config;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;  // user space counting is permitted up to perf_event_paranoid level 2
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+	// pid 0 and cpu -1 count the calling thread on any cpu
+	return int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+
+bool initPerfCounters()
+{
+	// raw floating point events are known for Intel processors only
+	ifstream f("/proc/cpuinfo");
+	string line;
+	while(getline(f, line))
+		if(line.compare(0, 9, "vendor_id") == 0) {
+			intelCpu = line.find("GenuineIntel") != string::npos;
+			break;
+		}
+
+	// try to open cycle counter
+	int fd = openCounter(counterConfigList[perfCycles]);
+	if(fd == -1) {
+		int e = errno;
+		cout << "Performance counters are not available: " << strerror(e) << "." << endl;
+		ifstream p("/proc/sys/kernel/perf_event_paranoid");
+		int paranoid;
+		if(p >> paranoid)
+			cout << "   (perf_event_paranoid is " << paranoid << ", values higher than 2 do not allow\n"
+			        "   to count even the user space; running in a virtual machine might be\n"
+			        "   the reason as well)" << endl;
+		return false;
+	}
+	close(fd);
+	return true;
+}
+
+
+PerfCounters::PerfCounters(bool enabled)
+{
+	for(size_t i=0; i<numPerfCounters; i++)
+		_fdList[i] =
+			(enabled && (intelCpu || !counterConfigList[i].intelOnly))
+				? openCounter(counterConfigList[i])
+				: -1;
+}
+
+
+PerfCounters::~PerfCounters()
+{
+	for(int fd : _fdList)
+		if(fd != -1)
+			close(fd);
+}
+
+
+void PerfCounters::start()
+{
+	for(int fd : _fdList)
+		if(fd != -1) {
+			ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+}
+
+
+void PerfCounters::stop()
+{
+	for(int fd : _fdList)
+		if(fd != -1)
+			ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+}
+
+
+void PerfCounters::addTo(PerfCounterValues& values) const
+{
+	for(size_t i=0; i<numPerfCounters; i++) {
+
+		// read value, time enabled and time running
+		uint64_t data[3];
+		if(_fdList[i] == -1 || read(_fdList[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) {
+			values[i] = NAN;
+			continue;
+		}
+
+		// scale the value if the counter was multiplexed with other counters
+		values[i] += double(data[0]) * double(data[1]) / double(data[2]);
+	}
+}
+
+
+#else
+
+
+bool initPerfCounters()
+{
+	cout << "Performance counters are supported on Linux only." << endl;
+	return false;
+}
+
+
+PerfCounters::PerfCounters(bool)  { _fdList.fill(-1); }
+PerfCounters::~PerfCounters()  {}
+void PerfCounters::start()  {}
+void PerfCounters::stop()  {}
+void PerfCounters::addTo(PerfCounterValues& values) const  { values.fill(NAN); }
+
+
+#endif
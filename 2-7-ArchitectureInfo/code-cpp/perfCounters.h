@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+// Hardware performance counters of the processor.
+//
+// They are measured per thread using perf_event_open() on Linux.
+// On other systems, or when the counters are not permitted
+// (see /proc/sys/kernel/perf_event_paranoid), they are not available.
+enum PerfCounterIndex {
+	perfCycles = 0,
+	perfInstructions,
+	perfFpScalar,  // floating point arithmetic instructions retired, scalar
+	perfFp128,     // ... packed 128-bit
+	perfFp256,     // ... packed 256-bit
+	perfFp512,     // ... packed 512-bit
+	perfL1dMisses,
+	perfLlcMisses,
+	numPerfCounters
+};
+
+// Counter values; NaN is used for counters that are not available.
+using PerfCounterValues = std::array<double, numPerfCounters>;
+
+
+// Check availability of the counters.
+// It prints the reason and returns false if they are not available.
+bool initPerfCounters();
+
+
+// Counters of the calling thread.
+class PerfCounters {
+protected:
+	std::array<int, numPerfCounters> _fdList;
+public:
+	PerfCounters(bool enabled);  // counters are opened only if enabled is true
+	~PerfCounters();
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+	void start();  // resets and starts counting
+	void stop();
+	void addTo(PerfCounterValues& values) const;  // adds counted values to values
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+
+// CPU emulation of the FMA computations of performance-*.comp shaders.
+//
+// It is used by the CPU test of this project and by the hybrid CPU+GPU test of 2-7-ArchitectureInfo.
+
+
+// Perform one FMA on each of the chains selected by Chain indices.
+//
+// Each chain uses its own x and y, so the chains are independent of each other
+// and their FMAs can be executed in parallel by the processor.
+template<typename T, std::size_t numChains, std::size_t... Chain>
+static inline void fmaStep(std::array<T,numChains>& x, const std::array<T,numChains>& y, T z, std::index_sequence<Chain...>)
+{
+	((x[Chain] = x[Chain] * y[Chain] + z), ...);
+}
+
+
+// Perform one multiplication followed by one addition on each of the chains selected by Chain indices.
+//
+// Multiplications of all chains are issued before the additions,
+// so the processor still sees independent instructions next to each other.
+template<typename T, std::size_t numChains, std::size_t... Chain>
+static inline void mulAddStep(std::array<T,numChains>& x, const std::array<T,numChains>& y, T z, std::index_sequence<Chain...>)
+{
+	((x[Chain] *= y[Chain]), ...);
+	((x[Chain] += z), ...);
+}
+
+
+// Repeat the step on all the chains sizeof...(Step) times.
+//
+// Fold expression expands into fully unrolled code,
+// in the same way as the long sequences of FMAs in the shaders.
+template<bool fused, typename T, std::size_t numChains, std::size_t... Step>
+static inline void computationSteps(std::array<T,numChains>& x, const std::array<T,numChains>& y, T z, std::index_sequence<Step...>)
+{
+	if constexpr(fused)
+		((void(Step), fmaStep(x, y, z, std::make_index_sequence<numChains>())), ...);
+	else
+		((void(Step), mulAddStep(x, y, z, std::make_index_sequence<numChains>())), ...);
+}
+
+
+// Shader invocation performing 1000 FMAs (2000 floating instructions)
+// split into numChains independent chains.
+//
+// numChains gives the instruction level parallelism (ILP) available to the processor;
+// number of used registers: 2 * numChains + 1.
+// If fused is false, FMA is replaced by separate multiplication and addition.
+template<typename T, std::size_t numChains, bool fused = true>
+static void shaderComputation(
+	unsigned globalInvocationIdX, unsigned globalInvocationIdY, unsigned globalInvocationIdZ)
+{
+	static_assert(numChains >= 1 && numChains <= 1000, "Number of chains must be in the range 1..1000.");
+
+	// initial values for the computation
+	// (make x[0], y[0] and z in the range 0.0 to 0.16384,
+	// and the remaining x and y values less than 0.333;
+	// z is never zero, otherwise x would decay into denormals
+	// that are processed very slowly by many CPUs and would spoil the comparison of the chains;
+	// 16-bit types use the range 0.0 to 0.1024 like performance-half.comp,
+	// so z is not denormal in half precision)
+	constexpr const unsigned mask = (sizeof(T) == 2) ? 0x03ff : 0x3fff;
+	constexpr const double scale = (sizeof(T) == 2) ? 0.0001 : 0.00001;
+	std::array<T,numChains> x;
+	std::array<T,numChains> y;
+	x[0] = T(double(globalInvocationIdX & mask) * scale);
+	y[0] = T(double(globalInvocationIdY & mask) * scale);
+	T z = T(double((globalInvocationIdZ & mask) + 1) * scale);
+	for(std::size_t i=1; i<numChains; i++) {
+		x[i] = x[0] + T(0.01 * i);
+		y[i] = y[0] + T(0.165 - 0.01 * i);
+	}
+
+	// 1000 operations; when 1000 is not divisible by numChains,
+	// the remaining operations are performed on the first chains
+	computationSteps<fused>(x, y, z, std::make_index_sequence<1000 / numChains>());
+	if constexpr(1000 % numChains != 0) {
+		if constexpr(fused)
+			fmaStep(x, y, z, std::make_index_sequence<1000 % numChains>());
+		else
+			mulAddStep(x, y, z, std::make_index_sequence<1000 % numChains>());
+	}
+
+	// condition that will never be true in reality
+	// (this avoids optimizer to consider the results of previous computations as unused
+	// and to optimize the final shader code by their removal)
+	T sum = T(0.);
+	bool found = false;
+	for(std::size_t i=0; i<numChains; i++) {
+		found |= (x[i] == T(10));
+		sum += y[i];
+	}
+	if(found) {
+		// write to artificially generated address
+		// (the write will never happen in reality)
+		*reinterpret_cast<T*>(std::size_t(globalInvocationIdZ)) = sum;
+	}
+}
+
+
+static inline void workgroupInvocation(void (*func)(unsigned, unsigned, unsigned),
+	unsigned workgroupIdX, unsigned workgroupIdY, unsigned workgroupIdZ)
+{
+	// call 128 shader invocations
+	// each processing 2000 floating instructions
+	for(unsigned y=0; y<4; y++)
+		for(unsigned x=0; x<32; x++)
+			func(
+				workgroupIdX*32 + x,
+				workgroupIdY*4 + y,
+				workgroupIdZ
+			);
+}
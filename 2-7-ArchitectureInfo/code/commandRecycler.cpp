@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include "commandRecycler.h"
+
+using namespace std;
+
+
+const char* to_cstr(RecordingMode mode)
+{
+	switch(mode) {
+	case RecordingMode::eRerecord: return "rerecord";
+	case RecordingMode::ePoolReset: return "pool-reset";
+	case RecordingMode::eReuse: return "reuse";
+	default: return "unknown";
+	}
+}
+
+
+bool parseRecordingMode(const char* s, RecordingMode& mode)
+{
+	if(strcmp(s, "rerecord") == 0)
+		mode = RecordingMode::eRerecord;
+	else if(strcmp(s, "pool-reset") == 0)
+		mode = RecordingMode::ePoolReset;
+	else if(strcmp(s, "reuse") == 0)
+		mode = RecordingMode::eReuse;
+	else
+		return false;
+	return true;
+}
+
+
+CommandRecycler::CommandRecycler(uint32_t queueFamily, RecordingMode mode, size_t maxCacheSize)
+	: _mode(mode)
+	, _maxCacheSize(max(maxCacheSize, size_t(1)))
+{
+	// command pool
+	// (eResetCommandBuffer is not needed when the whole pool is reset;
+	// reused command buffers are long-lived, so the pool is not transient)
+	vk::CommandPoolCreateFlags flags;
+	switch(mode) {
+	case RecordingMode::eRerecord:  flags = vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer; break;
+	case RecordingMode::ePoolReset: flags = vk::CommandPoolCreateFlagBits::eTransient; break;
+	case RecordingMode::eReuse:
+	default:                        flags = vk::CommandPoolCreateFlagBits::eResetCommandBuffer; break;
+	}
+	_commandPool =
+		vk::createCommandPoolUnique(
+			vk::CommandPoolCreateInfo{
+				.flags = flags,
+				.queueFamilyIndex = queueFamily,
+			}
+		);
+
+	// command buffer of eRerecord and ePoolReset modes
+	if(mode != RecordingMode::eReuse)
+		_commandBuffer =
+			vk::allocateCommandBuffer(
+				vk::CommandBufferAllocateInfo{
+					.commandPool = _commandPool,
+					.level = vk::CommandBufferLevel::ePrimary,
+					.commandBufferCount = 1,
+				}
+			);
+}
+
+
+vk::CommandBuffer CommandRecycler::begin(vk::Pipeline pipeline, uint32_t workgroupCountX, uint32_t workgroupCountY,
+                                         uint32_t workgroupCountZ, bool& needsRecording)
+{
+	_beginTime = chrono::high_resolution_clock::now();
+
+	vk::CommandBuffer commandBuffer;
+	vk::CommandBufferUsageFlags usageFlags;
+	switch(_mode) {
+
+	case RecordingMode::eRerecord:
+		// vkBeginCommandBuffer() implicitly resets the command buffer
+		commandBuffer = _commandBuffer;
+		usageFlags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+		break;
+
+	case RecordingMode::ePoolReset:
+		// reset all command buffers of the pool at once
+		vk::resetCommandPool(_commandPool, {});
+		commandBuffer = _commandBuffer;
+		usageFlags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+		break;
+
+	case RecordingMode::eReuse:
+	default: {
+
+		// return recorded command buffer
+		for(const CacheEntry& e : _cache)
+			if(e.pipeline == pipeline && e.workgroupCountX == workgroupCountX &&
+			   e.workgroupCountY == workgroupCountY && e.workgroupCountZ == workgroupCountZ)
+			{
+				_numReused++;
+				needsRecording = false;
+				return e.commandBuffer;
+			}
+
+		// allocate new command buffer or re-record the evicted one
+		CacheEntry* e;
+		if(_cache.size() < _maxCacheSize) {
+			e = &_cache.emplace_back();
+			e->commandBuffer =
+				vk::allocateCommandBuffer(
+					vk::CommandBufferAllocateInfo{
+						.commandPool = _commandPool,
+						.level = vk::CommandBufferLevel::ePrimary,
+						.commandBufferCount = 1,
+					}
+				);
+		}
+		else {
+			e = &_cache[_nextEviction];
+			_nextEviction = (_nextEviction + 1) % _maxCacheSize;
+		}
+		e->pipeline = pipeline;
+		e->workgroupCountX = workgroupCountX;
+		e->workgroupCountY = workgroupCountY;
+		e->workgroupCountZ = workgroupCountZ;
+		commandBuffer = e->commandBuffer;
+		usageFlags = {};  // no eOneTimeSubmit as the command buffer is submitted repeatedly
+		break;
+	}
+	}
+
+	vk::beginCommandBuffer(
+		commandBuffer,
+		vk::CommandBufferBeginInfo{
+			.flags = usageFlags,
+			.pInheritanceInfo = nullptr,
+		}
+	);
+	needsRecording = true;
+	return commandBuffer;
+}
+
+
+void CommandRecycler::submitted()
+{
+	_cpuTimeList.push_back(chrono::duration<float>(chrono::high_resolution_clock::now() - _beginTime).count());
+}
+
+
+uint64_t CommandRecycler::roundNumWorkgroups(uint64_t numWorkgroups) const
+{
+	if(_mode != RecordingMode::eReuse)
+		return numWorkgroups;
+
+	uint64_t unit = 1;
+	while(numWorkgroups >= unit * 100)
+		unit *= 10;
+	return (numWorkgroups + unit/2) / unit * unit;
+}
+
+
+void CommandRecycler::printStatistics() const
+{
+	if(_cpuTimeList.empty())
+		return;
+
+	vector<float> l(_cpuTimeList);
+	sort(l.begin(), l.end());
+	float sum = 0.f;
+	for(float t : l)
+		sum += t;
+	cout << "CPU record+submit time (" << to_cstr(_mode) << " mode, " << l.size() << " submissions):\n"
+	     << fixed << setprecision(1)
+	     << "   average: " << sum / l.size() * 1e6f << "us, median: " << l[l.size()/2] * 1e6f
+	     << "us, min: " << l.front() * 1e6f << "us" << defaultfloat << endl;
+	if(_mode == RecordingMode::eReuse)
+		cout << "   reused command buffers: " << _numReused << " of " << l.size() << " submissions" << endl;
+}
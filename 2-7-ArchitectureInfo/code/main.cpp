@@ -1,13 +1,22 @@
 #include <algorithm>
 #include <array>
+#include <barrier>
+#include <cctype>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 #include "vkg.h"
+#include "commandRecycler.h"
+#include "shaderComputation.h"
 
 using namespace std;
 
@@ -18,6 +27,13 @@ constexpr const float totalMeasuringTime = 10.f;  // total time in seconds for w
 constexpr const float singleMeasurementTargetTime = 0.02f;  // single measurement time in seconds; the load will be continually adjusted to target this time
 constexpr const float minTimeOfValidMeasurement = 0.005f;  // minimal measurement time to consider it valid measurement
 constexpr const float maxNumWorkgroupsMultiplier = 10.f;  // limits number of workgroups in the next measurement to not be more than 10 times higher then in the current measurement
+constexpr const char* defaultTimeSeriesFileName = "timeseries.csv";  // file receiving per-sample performance in the long-run mode
+constexpr const size_t minNumLongRunSamples = 20;  // minimal number of samples to perform phase detection in the long-run mode
+constexpr const double changePointPenaltyFactor = 4.;  // penalty of each change point in multiples of noise variance times log(number of samples)
+constexpr const float phaseTolerance = 0.02f;  // relative difference of the phase throughput to the steady state to be considered boost or throttling
+constexpr const float hybridMeasuringTime = 3.f;  // time in seconds of the hybrid CPU+GPU test
+constexpr const float hybridSplitSmoothing = 0.5f;  // weight of the newly measured rates when the CPU+GPU split is updated
+constexpr const size_t hybridCpuNumChains = 8;  // independent FMA chains of each CPU invocation in the hybrid test
 
 
 // shader code as SPIR-V binary
@@ -99,6 +115,144 @@ static auto formatFloatSI(float v)
 }
 
 
+// Detect change points in the series of measured values.
+//
+// It uses binary segmentation: the segment is split at the point
+// that reduces the sum of squared errors the most, as long as the reduction
+// exceeds the penalty of a new change point and both parts are at least
+// minSegmentLength long. Each part is then processed recursively.
+// The penalty is derived from the noise variance, that is estimated
+// from the differences of neighbouring samples, making it robust
+// against the level shifts that we are searching for.
+// Returned vector contains sorted indices of the first sample
+// of each segment, so it always starts with zero.
+static vector<size_t> detectChangePoints(const vector<float>& values)
+{
+	size_t n = values.size();
+
+	// prefix sums allowing to compute the cost of any segment in constant time
+	vector<double> sum(n+1);
+	vector<double> sumSq(n+1);
+	sum[0] = 0.;
+	sumSq[0] = 0.;
+	for(size_t i=0; i<n; i++) {
+		sum[i+1] = sum[i] + values[i];
+		sumSq[i+1] = sumSq[i] + double(values[i]) * values[i];
+	}
+	auto cost =
+		[&](size_t begin, size_t end) -> double {
+			double s = sum[end] - sum[begin];
+			return (sumSq[end] - sumSq[begin]) - s * s / double(end - begin);
+		};
+
+	// estimate noise variance using median absolute difference of neighbouring samples;
+	// 1.4826 converts median absolute deviation to standard deviation of normal distribution
+	// and sqrt(2) compensates for the difference of two samples
+	vector<float> differences;
+	differences.reserve(n);
+	for(size_t i=1; i<n; i++)
+		differences.push_back(fabsf(values[i] - values[i-1]));
+	double sigma = 0.;
+	if(!differences.empty()) {
+		nth_element(differences.begin(), differences.begin() + differences.size()/2, differences.end());
+		sigma = 1.4826 * differences[differences.size()/2] / sqrt(2.);
+	}
+	double penalty = changePointPenaltyFactor * sigma * sigma * log(double(n));
+	size_t minSegmentLength = max(n / 50, size_t(5));
+
+	// binary segmentation
+	vector<size_t> changePoints = { 0 };
+	vector<pair<size_t,size_t>> segmentStack = { { 0, n } };
+	while(!segmentStack.empty()) {
+		auto [begin, end] = segmentStack.back();
+		segmentStack.pop_back();
+		double segmentCost = cost(begin, end);
+		double bestGain = penalty;
+		size_t bestSplit = 0;
+		for(size_t m=begin+minSegmentLength; m+minSegmentLength<=end; m++) {
+			double gain = segmentCost - cost(begin, m) - cost(m, end);
+			if(gain > bestGain) {
+				bestGain = gain;
+				bestSplit = m;
+			}
+		}
+		if(bestSplit != 0) {
+			changePoints.push_back(bestSplit);
+			segmentStack.emplace_back(begin, bestSplit);
+			segmentStack.emplace_back(bestSplit, end);
+		}
+	}
+	sort(changePoints.begin(), changePoints.end());
+	return changePoints;
+}
+
+
+// Emulate one workgroup of performance-float.comp on CPU.
+//
+// The computation is made by shaderComputation() of 2-7-ArchitectureInfo-cpp
+// that performs 1000 FMAs per invocation. It is repeated ten times,
+// so each invocation performs 10'000 FMAs, i.e. the same amount of work as on the device.
+static void cpuFloatWorkgroup(unsigned workgroupIdX, unsigned workgroupIdY, unsigned workgroupIdZ)
+{
+	for(unsigned i=0; i<10; i++)
+		workgroupInvocation(shaderComputation<float, hybridCpuNumChains>, workgroupIdX, workgroupIdY, workgroupIdZ);
+}
+
+
+// Persistent pool of CPU threads of the hybrid test.
+//
+// run() executes func(threadIndex) on all the threads, the calling thread being the thread 0,
+// and returns when all of them finished. The threads are kept between the runs,
+// so the cost of thread creation is not included in the measured CPU time.
+class CpuThreadPool {
+protected:
+	function<void(unsigned)> _func;
+	bool _quit = false;
+	barrier<> _startBarrier;
+	barrier<> _doneBarrier;
+	vector<thread> _threadList;
+
+	void threadMain(unsigned threadIndex)
+	{
+		while(true) {
+			_startBarrier.arrive_and_wait();
+			if(_quit)
+				return;
+			_func(threadIndex);
+			_doneBarrier.arrive_and_wait();
+		}
+	}
+
+public:
+
+	CpuThreadPool(unsigned numThreads)
+		: _startBarrier(numThreads)
+		, _doneBarrier(numThreads)
+	{
+		_threadList.reserve(numThreads - 1);
+		for(unsigned i=1; i<numThreads; i++)
+			_threadList.emplace_back(&CpuThreadPool::threadMain, this, i);
+	}
+
+	~CpuThreadPool()
+	{
+		_quit = true;
+		_startBarrier.arrive_and_wait();
+		for(thread& t : _threadList)
+			t.join();
+	}
+
+	void run(function<void(unsigned)> func)
+	{
+		_func = std::move(func);
+		_startBarrier.arrive_and_wait();
+		_func(0);
+		_doneBarrier.arrive_and_wait();
+	}
+
+};
+
+
 int main(int argc, char* argv[])
 {
 	// catch exceptions
@@ -109,6 +263,14 @@ int main(int argc, char* argv[])
 		bool printHelp = false;
 		size_t selectedDeviceIndex = 0;
 		char* deviceFilterString = nullptr;
+		bool printStatistics = false;
+		bool printCounters = false;
+		bool longRunMode = false;
+		bool hybridMode = false;
+		unsigned numCpuThreads = 0;
+		float measuringTime = totalMeasuringTime;
+		const char* timeSeriesFileName = defaultTimeSeriesFileName;
+		RecordingMode recordingMode = RecordingMode::eRerecord;
 		for(int i=1; i<argc; i++) {
 
 			// parse options starting with '-'
@@ -120,6 +282,71 @@ int main(int argc, char* argv[])
 					continue;
 				}
 
+				// pipeline statistics
+				if(strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--statistics") == 0) {
+					printStatistics = true;
+					continue;
+				}
+
+				// performance counters
+				if(strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--counters") == 0) {
+					printCounters = true;
+					continue;
+				}
+
+				// long-run mode
+				if(strcmp(argv[i], "-l") == 0 || strcmp(argv[i], "--long-run") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					char* endp = nullptr;
+					measuringTime = strtof(argv[i], &endp);
+					if(!(measuringTime > 0.f) || endp == argv[i] || (endp && *endp != 0))
+						printHelp = true;
+					longRunMode = true;
+					continue;
+				}
+
+				// hybrid CPU+GPU test
+				if(strcmp(argv[i], "-y") == 0 || strcmp(argv[i], "--hybrid") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					char* endp = nullptr;
+					numCpuThreads = strtoul(argv[i], &endp, 10);
+					if(endp == argv[i] || (endp && *endp != 0))
+						printHelp = true;
+					hybridMode = true;
+					continue;
+				}
+
+				// time series output file
+				if(strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--output") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					timeSeriesFileName = argv[i];
+					continue;
+				}
+
+				// command buffer recording mode
+				if(strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "--recording") == 0) {
+					if(i+1 >= argc) {
+						printHelp = true;
+						continue;
+					}
+					i++;
+					if(!parseRecordingMode(argv[i], recordingMode))
+						printHelp = true;
+					continue;
+				}
+
 				// parse device index
 				if(argv[i][1] >= '0' && argv[i][1] <= '9') {
 					char* endp = nullptr;
@@ -142,11 +369,44 @@ int main(int argc, char* argv[])
 		if(printHelp) {
 			cout << appName << " prints the performance of a Vulkan device\n"
 			        "\n"
-			        "Usage: " << appName << " [-<deviceIndex>] [deviceNameFilter]\n"
+			        "Usage: " << appName << " [-<deviceIndex>] [-s] [-c] [-l <seconds>] [-o <file>]\n"
+			        "          [-y <numThreads>] [-r <mode>] [deviceNameFilter]\n"
 			        "   -<deviceIndex> - for example -1 or -3, specifies the index\n"
 			        "      of the device used for the performance test; it might be\n"
 			        "      useful when more devices are present in the system;\n"
 			        "      devices are numbered starting from one\n"
+			        "   -s or --statistics - prints pipeline executable statistics,\n"
+			        "      such as register count, spills or occupancy, for each\n"
+			        "      measured pipeline; it requires device support\n"
+			        "      for VK_KHR_pipeline_executable_properties\n"
+			        "   -c or --counters - prints hardware performance counters\n"
+			        "      related to ALU utilization, memory throughput and cache\n"
+			        "      hit rates for each measured pipeline; it requires device\n"
+			        "      support for VK_KHR_performance_query\n"
+			        "   -l <seconds> or --long-run <seconds> - measures for the given\n"
+			        "      number of seconds instead of " << totalMeasuringTime << " seconds, streams\n"
+			        "      each sample to the time series file and detects boost,\n"
+			        "      steady and throttling phases; sustained performance\n"
+			        "      is reported instead of the peak one; running for minutes\n"
+			        "      is recommended to capture thermal behaviour of the device\n"
+			        "   -o <file> or --output <file> - time series file written\n"
+			        "      in the long-run mode, " << defaultTimeSeriesFileName << " by default;\n"
+			        "      it is CSV file with the time since the start in seconds\n"
+			        "      and FLOPS of half, float and double precision per line\n"
+			        "   -y <numThreads> or --hybrid <numThreads> - after the regular\n"
+			        "      tests, splits float32 workload between the device and\n"
+			        "      the given number of CPU threads and prints their combined\n"
+			        "      performance; the split adapts to the measured rates,\n"
+			        "      so both finish at the same time; zero uses all CPU cores\n"
+			        "   -r <mode> or --recording <mode> - the way the command buffer\n"
+			        "      is prepared for each measurement; CPU record+submit cost\n"
+			        "      is printed at the end; mode is one of:\n"
+			        "      rerecord - record the command buffer again (default),\n"
+			        "      pool-reset - reset the command pool by vkResetCommandPool\n"
+			        "         and record the command buffer again,\n"
+			        "      reuse - record a command buffer once per pipeline and dispatch\n"
+			        "         size and submit it again; the number of workgroups is\n"
+			        "         rounded to two significant digits to make the sizes repeat\n"
 			        "   deviceNameFilter - only devices matching the given string\n"
 			        "      will be considered; for example AMD, GeForce, Intel\n" << endl;
 			return 99;
@@ -180,7 +440,8 @@ int main(int argc, char* argv[])
 		//                         compute queue, timestamp support
 		// optional functionality: Vulkan 1.3, pipelineCreationCacheControl,
 		//                         VK_NV_shader_sm_builtins, VK_AMD_shader_core_properties,
-		//                         VK_AMD_shader_core_properties2, VK_ARM_shader_core_builtins
+		//                         VK_AMD_shader_core_properties2, VK_ARM_shader_core_builtins,
+		//                         VK_KHR_pipeline_executable_properties, VK_KHR_performance_query
 		vk::vector<vk::PhysicalDevice> deviceList = vk::enumeratePhysicalDevices();
 		vector<tuple<vk::PhysicalDevice, uint32_t, vk::PhysicalDeviceProperties,
 			vk::QueueFamilyProperties>> compatibleDevices;
@@ -344,6 +605,8 @@ int main(int argc, char* argv[])
 		bool amdInfoSupport = false;
 		bool amdInfo2Support = false;
 		bool armInfoSupport = false;
+		bool pipelineExecutablePropertiesSupport = false;
+		bool performanceQuerySupport = false;
 		vk::vector<vk::ExtensionProperties> extensionList =
 			vk::enumerateDeviceExtensionProperties(pd, nullptr);
 		for(const vk::ExtensionProperties& e : extensionList) {
@@ -355,6 +618,86 @@ int main(int argc, char* argv[])
 				amdInfo2Support = true;
 			else if(strcmp(e.extensionName, "VK_ARM_shader_core_builtins") == 0)
 				amdInfo2Support = true;
+			else if(strcmp(e.extensionName, "VK_KHR_pipeline_executable_properties") == 0)
+				pipelineExecutablePropertiesSupport = true;
+			else if(strcmp(e.extensionName, "VK_KHR_performance_query") == 0)
+				performanceQuerySupport = true;
+		}
+
+		// pipeline executable statistics support
+		// (statistics are captured only when requested on the command line)
+		bool pipelineStatisticsSupport =
+			[&]() -> bool
+			{
+				if(!printStatistics || !pipelineExecutablePropertiesSupport)
+					return false;
+				vk::PhysicalDevicePipelineExecutablePropertiesFeaturesKHR pipelineExecutableFeatures;
+				vk::PhysicalDeviceFeatures2 features10 = { .pNext = &pipelineExecutableFeatures };
+				vk::getPhysicalDeviceFeatures2(pd, features10);
+				return pipelineExecutableFeatures.pipelineExecutableInfo;
+			}();
+		if(printStatistics && !pipelineStatisticsSupport)
+			cout << "Pipeline executable statistics are not supported by the device." << endl;
+
+		// performance counters support
+		// (counters are collected only when requested on the command line)
+		bool performanceCountersSupport =
+			[&]() -> bool
+			{
+				if(!printCounters || !performanceQuerySupport)
+					return false;
+				vk::PhysicalDevicePerformanceQueryFeaturesKHR performanceQueryFeatures;
+				vk::PhysicalDeviceFeatures2 features10 = { .pNext = &performanceQueryFeatures };
+				vk::getPhysicalDeviceFeatures2(pd, features10);
+				return performanceQueryFeatures.performanceCounterQueryPools;
+			}();
+		if(printCounters && !performanceCountersSupport)
+			cout << "Performance counters are not supported by the device." << endl;
+
+		// select performance counters;
+		// counter names are vendor specific, so the counters are selected by keywords
+		// related to ALU utilization, memory throughput and cache hit rates
+		vk::vector<vk::PerformanceCounterKHR> counterList;
+		vk::vector<vk::PerformanceCounterDescriptionKHR> counterDescriptionList;
+		vector<uint32_t> selectedCounters;
+		uint32_t numCounterPasses = 0;
+		if(performanceCountersSupport) {
+			vk::enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(
+				pd, queueFamily, counterList, counterDescriptionList);
+			for(uint32_t i=0, c=uint32_t(counterList.size()); i<c; i++) {
+				string text = string(counterDescriptionList[i].name) + ' ' + counterDescriptionList[i].category;
+				for(char& ch : text)
+					ch = char(tolower((unsigned char)ch));
+				auto contains = [&text](const char* s) { return text.find(s) != string::npos; };
+				vk::PerformanceCounterUnitKHR unit = counterList[i].unit;
+				bool aluCounter = contains("alu") || contains("busy") || contains("utilization");
+				bool memoryCounter = unit == vk::PerformanceCounterUnitKHR::eBytesPerSecond ||
+					(unit == vk::PerformanceCounterUnitKHR::eBytes && (contains("memory") || contains("dram"))) ||
+					contains("bandwidth") || contains("throughput");
+				bool cacheCounter = contains("cache") && (contains("hit") || contains("miss"));
+				if(aluCounter || memoryCounter || cacheCounter)
+					selectedCounters.push_back(i);
+			}
+			if(selectedCounters.empty()) {
+				cout << "No ALU, memory or cache performance counters found among "
+				     << counterList.size() << " counters of the device." << endl;
+				performanceCountersSupport = false;
+			}
+			else {
+				// the hardware might not be able to sample all the counters at once,
+				// so the measured work is replayed in several passes
+				numCounterPasses =
+					vk::getPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(
+						pd,
+						vk::QueryPoolPerformanceCreateInfoKHR{
+							.queueFamilyIndex = queueFamily,
+							.counterIndexCount = uint32_t(selectedCounters.size()),
+							.pCounterIndices = selectedCounters.data(),
+						}
+					);
+				cout << "Performance counters:  " << selectedCounters.size() << " of " << counterList.size()
+				     << " selected, " << numCounterPasses << " pass(es) per measurement" << endl;
+			}
 		}
 
 		// hardware info
@@ -442,6 +785,26 @@ int main(int argc, char* argv[])
 			cout << "   not available" << endl;
 
 		// create device
+		vk::PhysicalDevicePerformanceQueryFeaturesKHR performanceQueryFeatures {
+			.performanceCounterQueryPools = true,
+		};
+		vk::PhysicalDevicePipelineExecutablePropertiesFeaturesKHR pipelineExecutableFeatures {
+			.pNext = (performanceCountersSupport) ? &performanceQueryFeatures : nullptr,
+			.pipelineExecutableInfo = true,
+		};
+		vk::PhysicalDeviceVulkan13Features features13 {
+			.pNext =
+				(pipelineStatisticsSupport)
+					? &pipelineExecutableFeatures
+					: pipelineExecutableFeatures.pNext,
+			.pipelineCreationCacheControl = pipelineCacheControlSupport,
+		};
+		array<const char*, 2> enabledExtensions;
+		uint32_t numExtensions = 0;
+		if(pipelineStatisticsSupport)
+			enabledExtensions[numExtensions++] = "VK_KHR_pipeline_executable_properties";
+		if(performanceCountersSupport)
+			enabledExtensions[numExtensions++] = "VK_KHR_performance_query";
 		vk::initDevice(
 			pd,  // physicalDevice
 			vk::DeviceCreateInfo{  // pCreateInfo
@@ -458,8 +821,8 @@ int main(int argc, char* argv[])
 					}.data(),
 				.enabledLayerCount = 0,  // no enabled layers
 				.ppEnabledLayerNames = nullptr,
-				.enabledExtensionCount = 0,  // no enabled extensions
-				.ppEnabledExtensionNames = nullptr,
+				.enabledExtensionCount = numExtensions,
+				.ppEnabledExtensionNames = enabledExtensions.data(),
 				.pEnabledFeatures =
 					&(const vk::PhysicalDeviceFeatures&)vk::PhysicalDeviceFeatures{
 						.shaderFloat64 = float64Support,
@@ -473,10 +836,8 @@ int main(int argc, char* argv[])
 				}
 				.setPNext(
 					vulkan13Support
-						? &(const vk::PhysicalDeviceVulkan13Features&)vk::PhysicalDeviceVulkan13Features{
-							  .pipelineCreationCacheControl = pipelineCacheControlSupport,
-						  }
-						: nullptr
+						? &features13
+						: features13.pNext
 				)
 			)
 		);
@@ -535,9 +896,12 @@ int main(int argc, char* argv[])
 
 				// prepare vk::ComputePipelineCreateInfo list
 				// (the list is dense; no null shader modules allowed)
-				vk::PipelineCreateFlags flags = (pipelineCacheControlSupport)
-					? vk::PipelineCreateFlagBits::eFailOnPipelineCompileRequired
+				vk::PipelineCreateFlags captureFlags = (pipelineStatisticsSupport)
+					? vk::PipelineCreateFlagBits::eCaptureStatisticsKHR
 					: vk::PipelineCreateFlags();
+				vk::PipelineCreateFlags flags = (pipelineCacheControlSupport)
+					? vk::PipelineCreateFlagBits::eFailOnPipelineCompileRequired | captureFlags
+					: captureFlags;
 				uint32_t numPipelines1 = 0;
 				size_t i;
 				for(i=0; i<shaderModuleList.size(); i++)
@@ -600,14 +964,14 @@ int main(int argc, char* argv[])
 				size_t numPipelines2 = 0;
 				for(i=0; i<numPipelines1; i++)
 					if(!pipelineList1[i]) {
-						createInfos[numPipelines2].flags = {};
+						createInfos[numPipelines2].flags = captureFlags;
 						numPipelines2++;
 					} else
 						break;
 				for(; i<numPipelines1; i++)
 					if(!pipelineList1[i]) {
 						createInfos[numPipelines2] = createInfos[i];
-						createInfos[numPipelines2].flags = {};
+						createInfos[numPipelines2].flags = captureFlags;
 						numPipelines2++;
 					}
 
@@ -665,6 +1029,25 @@ int main(int argc, char* argv[])
 				}
 			);
 
+		// performance counter pool
+		vk::UniqueQueryPool counterPool;
+		if(performanceCountersSupport)
+			counterPool =
+				vk::createQueryPoolUnique(
+					vk::QueryPoolCreateInfo{
+						.pNext =
+							&(const vk::QueryPoolPerformanceCreateInfoKHR&)vk::QueryPoolPerformanceCreateInfoKHR{
+								.queueFamilyIndex = queueFamily,
+								.counterIndexCount = uint32_t(selectedCounters.size()),
+								.pCounterIndices = selectedCounters.data(),
+							},
+						.flags = {},
+						.queryType = vk::QueryType::ePerformanceQueryKHR,
+						.queryCount = 1,
+						.pipelineStatistics = {},
+					}
+				);
+
 		// command pool
 		vk::UniqueCommandPool commandPool =
 			vk::createCommandPoolUnique(
@@ -685,6 +1068,9 @@ int main(int argc, char* argv[])
 				}
 			);
 
+		// command pool and command buffers of the tests
+		CommandRecycler commandRecycler(queueFamily, recordingMode);
+
 		// fence
 		vk::UniqueFence computingFinishedFence =
 			vk::createFenceUnique(
@@ -693,37 +1079,10 @@ int main(int argc, char* argv[])
 				}
 			);
 
-		auto performTest =
-			[&](vk::Pipeline pipeline, size_t numWorkgroups) -> float {
-
-				// begin command buffer
-				vk::beginCommandBuffer(
-					commandBuffer,
-					vk::CommandBufferBeginInfo{
-						.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
-						.pInheritanceInfo = nullptr,
-					}
-				);
-
-				// reset timestamp pool
-				vk::cmdResetQueryPool(
-					commandBuffer,
-					timestampPool,
-					0,  // firstQuery
-					2);  // queryCount
-
-				// bind pipeline
-				vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
-
-				// write timestamp 0
-				vk::cmdWriteTimestamp(
-					commandBuffer,
-					vk::PipelineStageFlagBits::eTopOfPipe,
-					timestampPool,
-					0);  // query
-
-				// dispatch computation
-				// (avoid any dimension to go over 10000)
+		// split numWorkgroups into dispatch dimensions
+		// (avoid any dimension to go over 10000)
+		auto splitWorkgroups =
+			[](size_t numWorkgroups) -> array<uint32_t, 3> {
 				uint32_t workgroupCountX;
 				uint32_t workgroupCountY;
 				uint32_t workgroupCountZ;
@@ -740,23 +1099,23 @@ int main(int argc, char* argv[])
 					workgroupCountY = 1 + ((numWorkgroups - 1) / 10000);
 					workgroupCountX = numWorkgroups / workgroupCountY;
 				}
-				vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
-
-				// write timestamp 1
-				vk::cmdWriteTimestamp(
-					commandBuffer,
-					vk::PipelineStageFlagBits::eBottomOfPipe,
-					timestampPool,
-					1);  // query
-
-				// end command buffer
-				vk::endCommandBuffer(commandBuffer);
+				return { workgroupCountX, workgroupCountY, workgroupCountZ };
+			};
 
+		// record dispatch of numWorkgroups into the command buffer
+		auto recordDispatch =
+			[&](vk::CommandBuffer commandBuffer, size_t numWorkgroups) {
+				array<uint32_t, 3> workgroupCount = splitWorkgroups(numWorkgroups);
+				vk::cmdDispatch(commandBuffer, workgroupCount[0], workgroupCount[1], workgroupCount[2]);
+			};
 
-				// submit work
+		// submit the command buffer
+		auto submitWork =
+			[&](vk::CommandBuffer commandBuffer, const void* pNext) {
 				vk::queueSubmit(
 					queue,
 					vk::SubmitInfo{
+						.pNext = pNext,
 						.waitSemaphoreCount = 0,
 						.pWaitSemaphores = nullptr,
 						.pWaitDstStageMask = nullptr,
@@ -767,8 +1126,11 @@ int main(int argc, char* argv[])
 					},
 					computingFinishedFence
 				);
+			};
 
-				// wait for the work
+		// wait for the submitted work
+		auto waitForWork =
+			[&]() {
 				vk::Result r =
 					vk::waitForFence_noThrow(
 						computingFinishedFence,
@@ -788,8 +1150,63 @@ int main(int argc, char* argv[])
 
 				// reset fence
 				vk::resetFence(computingFinishedFence);
+			};
+
+		// submit the command buffer and wait for its completion
+		auto submitAndWait =
+			[&](vk::CommandBuffer commandBuffer, const void* pNext) {
+				submitWork(commandBuffer, pNext);
+				waitForWork();
+			};
+
+		// record the test into the command buffer and return the command buffer
+		// (depending on recordingMode, the command buffer might be already recorded from an earlier test)
+		auto recordTest =
+			[&](vk::Pipeline pipeline, size_t numWorkgroups) -> vk::CommandBuffer {
+
+				// get command buffer
+				array<uint32_t, 3> workgroupCount = splitWorkgroups(numWorkgroups);
+				bool needsRecording;
+				vk::CommandBuffer commandBuffer =
+					commandRecycler.begin(pipeline, workgroupCount[0], workgroupCount[1], workgroupCount[2], needsRecording);
+				if(!needsRecording)
+					return commandBuffer;
+
+				// reset timestamp pool
+				vk::cmdResetQueryPool(
+					commandBuffer,
+					timestampPool,
+					0,  // firstQuery
+					2);  // queryCount
 
-				// read timestamps
+				// bind pipeline
+				vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+
+				// write timestamp 0
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eTopOfPipe,
+					timestampPool,
+					0);  // query
+
+				// dispatch computation
+				vk::cmdDispatch(commandBuffer, workgroupCount[0], workgroupCount[1], workgroupCount[2]);
+
+				// write timestamp 1
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eBottomOfPipe,
+					timestampPool,
+					1);  // query
+
+				// end command buffer
+				vk::endCommandBuffer(commandBuffer);
+				return commandBuffer;
+			};
+
+		// read the time of the executed test
+		auto readTestTime =
+			[&]() -> float {
 				array<uint64_t, 2> timestamps;
 				vk::getQueryPoolResults(
 					timestampPool,  // queryPool
@@ -803,22 +1220,91 @@ int main(int argc, char* argv[])
 
 				// return time as float in seconds
 				return float((timestamps[1] - timestamps[0]) & timestampValidBitMask) * timestampPeriod / 1e9;
+			};
 
+		auto performTest =
+			[&](vk::Pipeline pipeline, size_t numWorkgroups) -> float {
+				vk::CommandBuffer testCommandBuffer = recordTest(pipeline, numWorkgroups);
+				submitWork(testCommandBuffer, nullptr);
+				commandRecycler.submitted();
+				waitForWork();
+				return readTestTime();
 			};
 
+		auto collectCounters =
+			[&](vk::Pipeline pipeline, size_t numWorkgroups) -> vector<vk::PerformanceCounterResultKHR> {
+
+				// reset counter pool
+				// (performance query must not be reset in the command buffer that begins it)
+				vk::beginCommandBuffer(
+					commandBuffer,
+					vk::CommandBufferBeginInfo{
+						.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+						.pInheritanceInfo = nullptr,
+					}
+				);
+				vk::cmdResetQueryPool(commandBuffer, counterPool, 0, 1);
+				vk::endCommandBuffer(commandBuffer);
+				submitAndWait(commandBuffer, nullptr);
+
+				// record the measured work;
+				// the query begins by the first command and ends by the last command
+				// to satisfy the counters of command buffer scope
+				vk::beginCommandBuffer(
+					commandBuffer,
+					vk::CommandBufferBeginInfo{
+						.flags = {},
+						.pInheritanceInfo = nullptr,
+					}
+				);
+				vk::cmdBeginQuery(commandBuffer, counterPool, 0, {});
+				vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+				recordDispatch(commandBuffer, numWorkgroups);
+				vk::cmdEndQuery(commandBuffer, counterPool, 0);
+				vk::endCommandBuffer(commandBuffer);
+
+				// replay the work once for each counter pass
+				for(uint32_t i=0; i<numCounterPasses; i++)
+					submitAndWait(
+						commandBuffer,
+						&(const vk::PerformanceQuerySubmitInfoKHR&)vk::PerformanceQuerySubmitInfoKHR{
+							.counterPassIndex = i,
+						}
+					);
+
+				// read counters
+				// (64-bit flag is not allowed as the counters use their own storage types)
+				vector<vk::PerformanceCounterResultKHR> counterResults(selectedCounters.size());
+				vk::getQueryPoolResults(
+					counterPool,  // queryPool
+					0,  // firstQuery
+					1,  // queryCount
+					counterResults.size() * sizeof(vk::PerformanceCounterResultKHR),  // dataSize
+					counterResults.data(),  // pData
+					counterResults.size() * sizeof(vk::PerformanceCounterResultKHR),  // stride
+					vk::QueryResultFlagBits::eWait  // flags
+				);
+				return counterResults;
+
+			};
+
+		// append the performance of valid measurement to performanceList
+		// and return it; invalid measurements return zero
 		auto processResult =
-			[](float time, size_t numWorkgroups, vector<float>& performanceList) {
+			[](float time, size_t numWorkgroups, vector<float>& performanceList) -> float {
 				if(time >= minTimeOfValidMeasurement) {
 					uint64_t numInstructions = uint64_t(20000) * 128 * numWorkgroups;
 					float performance = float(numInstructions) / time;
 					performanceList.push_back(performance);
+					return performance;
 				}
+				return 0.f;
 			};
 
 		// compute number of workgroups in the next iteration
 		// to eventually reach singleMeasurementTargetTime
 		auto computeNumWorkgroups =
-			[](size_t lastNumWorkgroups, float lastTime) -> size_t
+			[&commandRecycler](size_t lastNumWorkgroups, float lastTime) -> size_t
 			{
 				if(lastTime < (singleMeasurementTargetTime / maxNumWorkgroupsMultiplier)) {
 					// multiply numWorkgroups by maxNumWorkgroupsMultiplier
@@ -828,6 +1314,7 @@ int main(int argc, char* argv[])
 					// multiply numWorkgroups by ratio
 					float ratio = singleMeasurementTargetTime / lastTime;
 					size_t newNumWorkgroups = size_t(lastNumWorkgroups * ratio);
+					newNumWorkgroups = commandRecycler.roundNumWorkgroups(newNumWorkgroups);
 					return (newNumWorkgroups >= 1) ? newNumWorkgroups : 1;
 				}
 			};
@@ -842,24 +1329,55 @@ int main(int argc, char* argv[])
 		vector<float> halfPerformanceList;
 		vector<float> floatPerformanceList;
 		vector<float> doublePerformanceList;
+
+		// time series of the long-run mode;
+		// index 0 is used for half, 1 for float and 2 for double
+		array<vector<float>, 3> sampleTimeList;
+		array<vector<float>, 3> samplePerformanceList;
+		ofstream timeSeriesFile;
+		if(longRunMode) {
+			timeSeriesFile.open(timeSeriesFileName);
+			if(!timeSeriesFile)
+				throw runtime_error(string("Failed to open file ") + timeSeriesFileName + ".");
+			timeSeriesFile << "time,half,float,double\n";
+			cout << "Long-run mode: measuring for " << measuringTime << " seconds "
+			        "and writing samples to " << timeSeriesFileName << "." << endl;
+		}
+
 		chrono::time_point startTime = chrono::high_resolution_clock::now();
 		do {
 
 			// perform tests
+			array<float, 3> performance = { 0.f, 0.f, 0.f };
 			if(float16Support) {
 				halfTime = performTest(pipelineList[0], halfNumWorkgroups);
-				processResult(halfTime, halfNumWorkgroups, halfPerformanceList);
+				performance[0] = processResult(halfTime, halfNumWorkgroups, halfPerformanceList);
 			}
 			floatTime = performTest(pipelineList[1], floatNumWorkgroups);
-			processResult(floatTime, floatNumWorkgroups, floatPerformanceList);
+			performance[1] = processResult(floatTime, floatNumWorkgroups, floatPerformanceList);
 			if(float64Support) {
 				doubleTime = performTest(pipelineList[2], doubleNumWorkgroups);
-				processResult(doubleTime, doubleNumWorkgroups, doublePerformanceList);
+				performance[2] = processResult(doubleTime, doubleNumWorkgroups, doublePerformanceList);
 			}
-
-			// stop measurements after totalMeasuringTime passed
 			float totalTime = chrono::duration<float>(chrono::high_resolution_clock::now() - startTime).count();
-			if(totalTime >= totalMeasuringTime)
+
+			// stream the samples in the long-run mode;
+			// unsupported precisions and invalid measurements are written as empty fields
+			if(longRunMode) {
+				timeSeriesFile << totalTime;
+				for(size_t i=0; i<3; i++) {
+					timeSeriesFile << ',';
+					if(performance[i] != 0.f) {
+						timeSeriesFile << performance[i];
+						sampleTimeList[i].push_back(totalTime);
+						samplePerformanceList[i].push_back(performance[i]);
+					}
+				}
+				timeSeriesFile << endl;  // flush, so the samples are not lost when the run is interrupted
+			}
+
+			// stop measurements after measuringTime passed
+			if(totalTime >= measuringTime)
 				break;
 
 			// compute new numWorkgroups
@@ -871,6 +1389,126 @@ int main(int argc, char* argv[])
 
 		} while(true);
 
+		// collect performance counters
+		// using the workload of the last measurement
+		array<vector<vk::PerformanceCounterResultKHR>, 3> counterResultsList;
+		if(performanceCountersSupport) {
+			vk::Result r =
+				vk::acquireProfilingLockKHR_noThrow(
+					vk::AcquireProfilingLockInfoKHR{
+						.flags = {},
+						.timeout = uint64_t(1.5e9),  // 1.5 seconds
+					}
+				);
+			if(r == vk::Result::eSuccess) {
+				if(float16Support)
+					counterResultsList[0] = collectCounters(pipelineList[0], halfNumWorkgroups);
+				counterResultsList[1] = collectCounters(pipelineList[1], floatNumWorkgroups);
+				if(float64Support)
+					counterResultsList[2] = collectCounters(pipelineList[2], doubleNumWorkgroups);
+				vk::releaseProfilingLockKHR();
+			}
+			else {
+				cout << "Failed to acquire profiling lock. Performance counters will not be printed." << endl;
+				performanceCountersSupport = false;
+			}
+		}
+
+		// hybrid CPU+GPU test;
+		// the grid of hybridNumWorkgroups is split between the device and CPU threads,
+		// the device processes the first gpuNumWorkgroups and CPU threads the remaining ones
+		// that are distributed among the threads in round-robin fashion
+		// (gpuNumWorkgroups is the number of workgroups actually dispatched,
+		// that might be lower than requested because of splitWorkgroups())
+		vector<float> hybridPerformanceList;
+		vector<float> hybridGpuPerformanceList;
+		vector<float> hybridCpuPerformanceList;
+		float gpuShare = 1.f;
+		if(hybridMode) {
+
+			if(numCpuThreads == 0)
+				numCpuThreads = max(thread::hardware_concurrency(), 1u);
+			size_t hybridNumWorkgroups = max(floatNumWorkgroups, size_t(numCpuThreads) * 2);
+			cout << "Running hybrid test using the device and " << numCpuThreads
+			     << ((numCpuThreads == 1) ? " CPU thread..." : " CPU threads...") << endl;
+
+			// the first iteration gives just one workgroup to each CPU thread
+			// to measure CPU rate without long stall of the device
+			size_t cpuNumWorkgroups = numCpuThreads;
+			float gpuRate = 0.f;  // workgroups per second
+			float cpuRate = 0.f;  // workgroups per second
+			CpuThreadPool cpuThreadPool(numCpuThreads);
+			chrono::time_point hybridStartTime = chrono::high_resolution_clock::now();
+			do {
+
+				// run the device part
+				// (in reuse mode, the dispatch size is rounded, so that the recorded command buffers
+				// are reused instead of evicting the cache entries of the regular tests)
+				size_t requestedNumWorkgroups =
+					min(size_t(commandRecycler.roundNumWorkgroups(hybridNumWorkgroups - cpuNumWorkgroups)), hybridNumWorkgroups - 1);
+				vk::CommandBuffer testCommandBuffer = recordTest(pipelineList[1], requestedNumWorkgroups);
+				array<uint32_t, 3> workgroupCount = splitWorkgroups(requestedNumWorkgroups);
+				size_t gpuNumWorkgroups = size_t(workgroupCount[0]) * workgroupCount[1] * workgroupCount[2];
+				cpuNumWorkgroups = hybridNumWorkgroups - gpuNumWorkgroups;
+				chrono::time_point t1 = chrono::high_resolution_clock::now();
+				submitWork(testCommandBuffer, nullptr);
+				commandRecycler.submitted();
+
+				// run the CPU part
+				// (workgroup ids continue after the device part in row-major order
+				// of the grid that is 10000 workgroups wide)
+				cpuThreadPool.run(
+					[&](unsigned id) {
+						for(size_t i=gpuNumWorkgroups+id; i<hybridNumWorkgroups; i+=numCpuThreads)
+							cpuFloatWorkgroup(unsigned(i % 10000), unsigned((i / 10000) % 10000), unsigned(i / (10000 * 10000)));
+					});
+				chrono::time_point t2 = chrono::high_resolution_clock::now();
+
+				// wait for the device
+				waitForWork();
+				chrono::time_point t3 = chrono::high_resolution_clock::now();
+				float gpuTime = readTestTime();
+				float cpuTime = chrono::duration<float>(t2 - t1).count();
+				float totalTime = chrono::duration<float>(t3 - t1).count();
+
+				// record the performance
+				constexpr const uint64_t numInstructionsPerWorkgroup = uint64_t(20000) * 128;
+				if(totalTime >= minTimeOfValidMeasurement)
+					hybridPerformanceList.push_back(float(numInstructionsPerWorkgroup * hybridNumWorkgroups) / totalTime);
+				if(gpuTime >= minTimeOfValidMeasurement)
+					hybridGpuPerformanceList.push_back(float(numInstructionsPerWorkgroup * gpuNumWorkgroups) / gpuTime);
+				if(cpuTime >= minTimeOfValidMeasurement)
+					hybridCpuPerformanceList.push_back(float(numInstructionsPerWorkgroup * cpuNumWorkgroups) / cpuTime);
+
+				// stop measurements after hybridMeasuringTime passed
+				if(chrono::duration<float>(t3 - hybridStartTime).count() >= hybridMeasuringTime)
+					break;
+
+				// update rates using exponential smoothing
+				float newGpuRate = float(gpuNumWorkgroups) / max(gpuTime, 1e-6f);
+				float newCpuRate = float(cpuNumWorkgroups) / max(cpuTime, 1e-6f);
+				if(gpuRate == 0.f) {
+					gpuRate = newGpuRate;
+					cpuRate = newCpuRate;
+				}
+				else {
+					gpuRate += hybridSplitSmoothing * (newGpuRate - gpuRate);
+					cpuRate += hybridSplitSmoothing * (newCpuRate - cpuRate);
+				}
+
+				// split the grid in the ratio of the rates, so both parts finish at the same time;
+				// each CPU thread gets at least one workgroup and the device keeps at least one workgroup as well
+				gpuShare = gpuRate / (gpuRate + cpuRate);
+				cpuNumWorkgroups = size_t(float(hybridNumWorkgroups) * (1.f - gpuShare) + 0.5f);
+				cpuNumWorkgroups = clamp(cpuNumWorkgroups, size_t(numCpuThreads), hybridNumWorkgroups - 1);
+
+			} while(true);
+
+			sort(hybridPerformanceList.begin(), hybridPerformanceList.end());
+			sort(hybridGpuPerformanceList.begin(), hybridGpuPerformanceList.end());
+			sort(hybridCpuPerformanceList.begin(), hybridCpuPerformanceList.end());
+		}
+
 		// sort the results
 		sort(halfPerformanceList.begin(), halfPerformanceList.end());
 		sort(floatPerformanceList.begin(), floatPerformanceList.end());
@@ -899,9 +1537,174 @@ int main(int argc, char* argv[])
 				else
 					cout << "not supported" << endl;
 			};
+		auto printPipelineStatistics =
+			[](vk::Pipeline pipeline) {
+
+				// executables of the pipeline
+				// (compute pipeline usually contains just one executable)
+				vk::vector<vk::PipelineExecutablePropertiesKHR> executableList =
+					vk::getPipelineExecutablePropertiesKHR(
+						vk::PipelineInfoKHR{
+							.pipeline = pipeline,
+						}
+					);
+				for(uint32_t i=0, c=uint32_t(executableList.size()); i<c; i++) {
+
+					// print executable name
+					vk::PipelineExecutablePropertiesKHR& e = executableList[i];
+					cout << "   " << e.name << " (subgroup size: " << e.subgroupSize << "):" << endl;
+
+					// print statistics;
+					// their names and meaning are driver specific, but usually
+					// they include register count, spill count and occupancy
+					vk::vector<vk::PipelineExecutableStatisticKHR> statisticList =
+						vk::getPipelineExecutableStatisticsKHR(
+							vk::PipelineExecutableInfoKHR{
+								.pipeline = pipeline,
+								.executableIndex = i,
+							}
+						);
+					for(const vk::PipelineExecutableStatisticKHR& s : statisticList) {
+						cout << "      " << s.name << ":  ";
+						switch(s.format) {
+						case vk::PipelineExecutableStatisticFormatKHR::eBool32:  cout << (s.value.b32 ? "true" : "false"); break;
+						case vk::PipelineExecutableStatisticFormatKHR::eInt64:   cout << s.value.i64; break;
+						case vk::PipelineExecutableStatisticFormatKHR::eUint64:  cout << s.value.u64; break;
+						case vk::PipelineExecutableStatisticFormatKHR::eFloat64: cout << s.value.f64; break;
+						default: cout << "unknown format";
+						}
+						cout << endl;
+					}
+
+				}
+			};
+		auto printPerformanceCounters =
+			[&](const vector<vk::PerformanceCounterResultKHR>& counterResults) {
+				cout << "   Performance counters:" << endl;
+				for(size_t i=0, c=counterResults.size(); i<c; i++) {
+
+					// convert value to double
+					const vk::PerformanceCounterKHR& counter = counterList[selectedCounters[i]];
+					const vk::PerformanceCounterResultKHR& result = counterResults[i];
+					double value;
+					switch(counter.storage) {
+					case vk::PerformanceCounterStorageKHR::eInt32:   value = result.int32; break;
+					case vk::PerformanceCounterStorageKHR::eInt64:   value = double(result.int64); break;
+					case vk::PerformanceCounterStorageKHR::eUint32:  value = result.uint32; break;
+					case vk::PerformanceCounterStorageKHR::eUint64:  value = double(result.uint64); break;
+					case vk::PerformanceCounterStorageKHR::eFloat32: value = result.float32; break;
+					case vk::PerformanceCounterStorageKHR::eFloat64: value = result.float64; break;
+					default: value = 0.;
+					}
+
+					// print value with its unit
+					cout << "      " << counterDescriptionList[selectedCounters[i]].name << ":  ";
+					switch(counter.unit) {
+					case vk::PerformanceCounterUnitKHR::ePercentage:     cout << value << " %"; break;
+					case vk::PerformanceCounterUnitKHR::eNanoseconds:    cout << formatFloatSI(float(value * 1e-9)) << "s"; break;
+					case vk::PerformanceCounterUnitKHR::eBytes:          cout << formatFloatSI(float(value)) << "B"; break;
+					case vk::PerformanceCounterUnitKHR::eBytesPerSecond: cout << formatFloatSI(float(value)) << "B/s"; break;
+					case vk::PerformanceCounterUnitKHR::eHertz:          cout << formatFloatSI(float(value)) << "Hz"; break;
+					case vk::PerformanceCounterUnitKHR::eCycles:         cout << value << " cycles"; break;
+					default: cout << value;
+					}
+					cout << endl;
+
+				}
+			};
 		printResult("Half (float16) performance:    ", float16Support, halfPerformanceList);
+		if(pipelineStatisticsSupport && float16Support)
+			printPipelineStatistics(pipelineList[0]);
+		if(performanceCountersSupport && float16Support)
+			printPerformanceCounters(counterResultsList[0]);
 		printResult("Float (float32) performance:   ", true, floatPerformanceList);
+		if(pipelineStatisticsSupport)
+			printPipelineStatistics(pipelineList[1]);
+		if(performanceCountersSupport)
+			printPerformanceCounters(counterResultsList[1]);
 		printResult("Double (float64) performance:  ", float64Support, doublePerformanceList);
+		if(pipelineStatisticsSupport && float64Support)
+			printPipelineStatistics(pipelineList[2]);
+		if(performanceCountersSupport && float64Support)
+			printPerformanceCounters(counterResultsList[2]);
+
+		// print CPU cost of command buffer recording and submission
+		commandRecycler.printStatistics();
+
+		// print hybrid CPU+GPU results
+		if(hybridMode) {
+			printResult("Hybrid CPU+GPU float32 performance:  ", true, hybridPerformanceList);
+			printResult("   device part:  ", true, hybridGpuPerformanceList);
+			printResult("   CPU part:     ", true, hybridCpuPerformanceList);
+			cout << "   Final split:  " << int(gpuShare * 100.f + 0.5f) << "% device, "
+			     << int((1.f - gpuShare) * 100.f + 0.5f) << "% CPU" << endl;
+		}
+
+		// print phases of the long-run mode
+		auto printLongRunAnalysis =
+			[](const string_view text, const vector<float>& timeList, const vector<float>& performanceList) {
+				cout << text;
+				if(performanceList.size() < minNumLongRunSamples) {
+					cout << "not enough samples" << endl;
+					return;
+				}
+				cout << endl;
+
+				// split samples into segments and compute their median performance
+				struct Phase {
+					float startTime;
+					float endTime;
+					float performance;
+				};
+				vector<size_t> changePoints = detectChangePoints(performanceList);
+				vector<Phase> phaseList;
+				for(size_t i=0, c=changePoints.size(); i<c; i++) {
+					size_t begin = changePoints[i];
+					size_t end = (i+1 < c) ? changePoints[i+1] : performanceList.size();
+					vector<float> segment(performanceList.begin() + begin, performanceList.begin() + end);
+					nth_element(segment.begin(), segment.begin() + segment.size()/2, segment.end());
+					phaseList.push_back({
+						.startTime = (begin == 0) ? 0.f : timeList[begin-1],
+						.endTime = timeList[end-1],
+						.performance = segment[segment.size()/2],
+					});
+				}
+
+				// the longest phase is considered the steady state;
+				// faster phases before it are boost phases and slower phases after it are throttling
+				size_t steadyIndex = 0;
+				for(size_t i=1; i<phaseList.size(); i++)
+					if(phaseList[i].endTime - phaseList[i].startTime >
+					   phaseList[steadyIndex].endTime - phaseList[steadyIndex].startTime)
+						steadyIndex = i;
+				float steadyPerformance = phaseList[steadyIndex].performance;
+				float peakPerformance = 0.f;
+				for(size_t i=0; i<phaseList.size(); i++) {
+					const Phase& p = phaseList[i];
+					const char* phaseName = "steady";
+					if(i < steadyIndex && p.performance > steadyPerformance * (1.f + phaseTolerance))
+						phaseName = "boost";
+					else if(i > steadyIndex && p.performance < steadyPerformance * (1.f - phaseTolerance))
+						phaseName = "throttling";
+					peakPerformance = max(peakPerformance, p.performance);
+					cout << "   " << p.startTime << "s - " << p.endTime << "s:  "
+					     << formatFloatSI(p.performance) << "FLOPS  (" << phaseName << ")" << endl;
+				}
+
+				// sustained performance is the performance of the last phase,
+				// i.e. the performance that the device is able to hold
+				cout << "   Sustained: " << formatFloatSI(phaseList.back().performance) << "FLOPS"
+				        "  (peak: " << formatFloatSI(peakPerformance) << "FLOPS,"
+				        " sustained/peak: " << int(phaseList.back().performance / peakPerformance * 100.f + 0.5f) << "%)" << endl;
+			};
+		if(longRunMode) {
+			cout << "Long-run phases:" << endl;
+			if(float16Support)
+				printLongRunAnalysis("Half (float16):", sampleTimeList[0], samplePerformanceList[0]);
+			printLongRunAnalysis("Float (float32):", sampleTimeList[1], samplePerformanceList[1]);
+			if(float64Support)
+				printLongRunAnalysis("Double (float64):", sampleTimeList[2], samplePerformanceList[2]);
+		}
 
 	// catch exceptions
 	} catch(vk::Error& e) {
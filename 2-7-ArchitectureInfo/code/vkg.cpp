@@ -405,6 +405,8 @@ void vk::initInstance(Instance instance) noexcept
 	funcs.vkCmdBeginQuery                            = getInstanceProcAddr<PFN_vkCmdBeginQuery                            >("vkCmdBeginQuery");
 	funcs.vkCmdEndQuery                              = getInstanceProcAddr<PFN_vkCmdEndQuery                              >("vkCmdEndQuery");
 	funcs.vkCmdCopyQueryPoolResults                  = getInstanceProcAddr<PFN_vkCmdCopyQueryPoolResults                  >("vkCmdCopyQueryPoolResults");
+	funcs.vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = getInstanceProcAddr<PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR>("vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+	funcs.vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = getInstanceProcAddr<PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR>("vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
 	//funcs.vkGetPhysicalDeviceCalibrateableTimeDomainsEXT = getInstanceProcAddr<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT>("vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
 }
 
@@ -529,6 +531,10 @@ void vk::initDevice(PhysicalDevice physicalDevice, Device device) noexcept
 	funcs.vkCreateQueryPool        = getDeviceProcAddr<PFN_vkCreateQueryPool    >("vkCreateQueryPool");
 	funcs.vkDestroyQueryPool       = getDeviceProcAddr<PFN_vkDestroyQueryPool   >("vkDestroyQueryPool");
 	funcs.vkGetQueryPoolResults    = getDeviceProcAddr<PFN_vkGetQueryPoolResults>("vkGetQueryPoolResults");
+	funcs.vkGetPipelineExecutablePropertiesKHR = getDeviceProcAddr<PFN_vkGetPipelineExecutablePropertiesKHR>("vkGetPipelineExecutablePropertiesKHR");
+	funcs.vkGetPipelineExecutableStatisticsKHR = getDeviceProcAddr<PFN_vkGetPipelineExecutableStatisticsKHR>("vkGetPipelineExecutableStatisticsKHR");
+	funcs.vkAcquireProfilingLockKHR = getDeviceProcAddr<PFN_vkAcquireProfilingLockKHR>("vkAcquireProfilingLockKHR");
+	funcs.vkReleaseProfilingLockKHR = getDeviceProcAddr<PFN_vkReleaseProfilingLockKHR>("vkReleaseProfilingLockKHR");
 }
 
 
@@ -971,6 +977,167 @@ Result vk::enumerateDeviceExtensionProperties_noThrow(PhysicalDevice pd, const c
 }
 
 
+vk::vector<PipelineExecutablePropertiesKHR> vk::getPipelineExecutablePropertiesKHR_throw(const PipelineInfoKHR& pipelineInfo)
+{
+	vk::vector<PipelineExecutablePropertiesKHR> v;
+	uint32_t n;
+	Result r;
+	do {
+		// get num executables
+		r = funcs.vkGetPipelineExecutablePropertiesKHR(detail::_device.handle(), &pipelineInfo, &n, nullptr);
+		checkForSuccessValue(r, "vkGetPipelineExecutablePropertiesKHR");
+
+		// get executable properties
+		v.alloc(n);
+		r = funcs.vkGetPipelineExecutablePropertiesKHR(detail::_device.handle(), &pipelineInfo, &n, v.data());
+		checkSuccess(r, "vkGetPipelineExecutablePropertiesKHR");
+
+	} while(r == vk::Result::eIncomplete);
+
+	// number of returned items might got lower before the last get/enumerate call
+	if(n != v.size())
+		v.resize(n);
+
+	return v;
+}
+
+
+Result vk::getPipelineExecutablePropertiesKHR_noThrow(const PipelineInfoKHR& pipelineInfo, vk::vector<PipelineExecutablePropertiesKHR>& v) noexcept
+{
+	uint32_t n;
+	Result r;
+	do {
+		// get num executables
+		r = funcs.vkGetPipelineExecutablePropertiesKHR(detail::_device.handle(), &pipelineInfo, &n, nullptr);
+		if(r != Result::eSuccess)
+			return r;
+
+		// get executable properties
+		if(!v.alloc_noThrow(n))
+			return Result::eErrorOutOfHostMemory;
+		r = funcs.vkGetPipelineExecutablePropertiesKHR(detail::_device.handle(), &pipelineInfo, &n, v.data());
+		if(int32_t(r) < 0)
+			return r;
+
+	} while(r == vk::Result::eIncomplete);
+
+	// number of returned items might got lower before the last get/enumerate call
+	if(n != v.size())
+		if(!v.resize_noThrow(n))
+			return Result::eErrorOutOfHostMemory;
+
+	return Result::eSuccess;
+}
+
+
+vk::vector<PipelineExecutableStatisticKHR> vk::getPipelineExecutableStatisticsKHR_throw(const PipelineExecutableInfoKHR& executableInfo)
+{
+	vk::vector<PipelineExecutableStatisticKHR> v;
+	uint32_t n;
+	Result r;
+	do {
+		// get num statistics
+		r = funcs.vkGetPipelineExecutableStatisticsKHR(detail::_device.handle(), &executableInfo, &n, nullptr);
+		checkForSuccessValue(r, "vkGetPipelineExecutableStatisticsKHR");
+
+		// get statistics
+		v.alloc(n);
+		r = funcs.vkGetPipelineExecutableStatisticsKHR(detail::_device.handle(), &executableInfo, &n, v.data());
+		checkSuccess(r, "vkGetPipelineExecutableStatisticsKHR");
+
+	} while(r == vk::Result::eIncomplete);
+
+	// number of returned items might got lower before the last get/enumerate call
+	if(n != v.size())
+		v.resize(n);
+
+	return v;
+}
+
+
+Result vk::getPipelineExecutableStatisticsKHR_noThrow(const PipelineExecutableInfoKHR& executableInfo, vk::vector<PipelineExecutableStatisticKHR>& v) noexcept
+{
+	uint32_t n;
+	Result r;
+	do {
+		// get num statistics
+		r = funcs.vkGetPipelineExecutableStatisticsKHR(detail::_device.handle(), &executableInfo, &n, nullptr);
+		if(r != Result::eSuccess)
+			return r;
+
+		// get statistics
+		if(!v.alloc_noThrow(n))
+			return Result::eErrorOutOfHostMemory;
+		r = funcs.vkGetPipelineExecutableStatisticsKHR(detail::_device.handle(), &executableInfo, &n, v.data());
+		if(int32_t(r) < 0)
+			return r;
+
+	} while(r == vk::Result::eIncomplete);
+
+	// number of returned items might got lower before the last get/enumerate call
+	if(n != v.size())
+		if(!v.resize_noThrow(n))
+			return Result::eErrorOutOfHostMemory;
+
+	return Result::eSuccess;
+}
+
+
+void vk::enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR_throw(PhysicalDevice pd, uint32_t queueFamilyIndex,
+	vk::vector<PerformanceCounterKHR>& counters, vk::vector<PerformanceCounterDescriptionKHR>& counterDescriptions)
+{
+	uint32_t n;
+	Result r;
+	do {
+		// get num counters
+		r = funcs.vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(pd.handle(), queueFamilyIndex, &n, nullptr, nullptr);
+		checkForSuccessValue(r, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+
+		// enumerate counters
+		counters.alloc(n);
+		counterDescriptions.alloc(n);
+		r = funcs.vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(pd.handle(), queueFamilyIndex, &n, counters.data(), counterDescriptions.data());
+		checkSuccess(r, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+
+	} while(r == vk::Result::eIncomplete);
+
+	// number of returned items might got lower before the last get/enumerate call
+	if(n != counters.size()) {
+		counters.resize(n);
+		counterDescriptions.resize(n);
+	}
+}
+
+
+Result vk::enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR_noThrow(PhysicalDevice pd, uint32_t queueFamilyIndex,
+	vk::vector<PerformanceCounterKHR>& counters, vk::vector<PerformanceCounterDescriptionKHR>& counterDescriptions) noexcept
+{
+	uint32_t n;
+	Result r;
+	do {
+		// get num counters
+		r = funcs.vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(pd.handle(), queueFamilyIndex, &n, nullptr, nullptr);
+		if(r != Result::eSuccess)
+			return r;
+
+		// enumerate counters
+		if(!counters.alloc_noThrow(n) || !counterDescriptions.alloc_noThrow(n))
+			return Result::eErrorOutOfHostMemory;
+		r = funcs.vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(pd.handle(), queueFamilyIndex, &n, counters.data(), counterDescriptions.data());
+		if(int32_t(r) < 0)
+			return r;
+
+	} while(r == vk::Result::eIncomplete);
+
+	// number of returned items might got lower before the last get/enumerate call
+	if(n != counters.size())
+		if(!counters.resize_noThrow(n) || !counterDescriptions.resize_noThrow(n))
+			return Result::eErrorOutOfHostMemory;
+
+	return Result::eSuccess;
+}
+
+
 vk::vector<QueueFamilyProperties> vk::getPhysicalDeviceQueueFamilyProperties_throw(PhysicalDevice pd)
 {
 	vk::vector<QueueFamilyProperties> v;
@@ -11660,6 +11660,12 @@ using PFN_vkGetDeviceGroupPresentCapabilitiesKHR = Result (VKAPI_PTR *)(Device::
 using PFN_vkGetDeviceGroupSurfacePresentModesKHR = Result (VKAPI_PTR *)(Device::HandleType deviceHandle, SurfaceKHR::HandleType surfaceHandle, DeviceGroupPresentModeFlagsKHR* pModes);
 using PFN_vkGetPhysicalDevicePresentRectanglesKHR = Result (VKAPI_PTR *)(PhysicalDevice::HandleType physicalDeviceHandle, SurfaceKHR::HandleType surfaceHandle, uint32_t* pRectCount, Rect2D* pRects);
 using PFN_vkAcquireNextImage2KHR = Result (VKAPI_PTR *)(Device::HandleType deviceHandle, const AcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex);
+using PFN_vkGetPipelineExecutablePropertiesKHR = Result (VKAPI_PTR *)(Device::HandleType deviceHandle, const PipelineInfoKHR* pPipelineInfo, uint32_t* pExecutableCount, PipelineExecutablePropertiesKHR* pProperties);
+using PFN_vkGetPipelineExecutableStatisticsKHR = Result (VKAPI_PTR *)(Device::HandleType deviceHandle, const PipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pStatisticCount, PipelineExecutableStatisticKHR* pStatistics);
+using PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = Result (VKAPI_PTR *)(PhysicalDevice::HandleType physicalDeviceHandle, uint32_t queueFamilyIndex, uint32_t* pCounterCount, PerformanceCounterKHR* pCounters, PerformanceCounterDescriptionKHR* pCounterDescriptions);
+using PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = void (VKAPI_PTR *)(PhysicalDevice::HandleType physicalDeviceHandle, const QueryPoolPerformanceCreateInfoKHR* pPerformanceQueryCreateInfo, uint32_t* pNumPasses);
+using PFN_vkAcquireProfilingLockKHR = Result (VKAPI_PTR *)(Device::HandleType deviceHandle, const AcquireProfilingLockInfoKHR* pInfo);
+using PFN_vkReleaseProfilingLockKHR = void (VKAPI_PTR *)(Device::HandleType deviceHandle);
 
 
 struct Funcs {
@@ -11825,6 +11831,12 @@ struct Funcs {
 	PFN_vkCmdBeginQuery             vkCmdBeginQuery = nullptr;
 	PFN_vkCmdEndQuery               vkCmdEndQuery = nullptr;
 	PFN_vkCmdCopyQueryPoolResults   vkCmdCopyQueryPoolResults = nullptr;
+	PFN_vkGetPipelineExecutablePropertiesKHR vkGetPipelineExecutablePropertiesKHR = nullptr;
+	PFN_vkGetPipelineExecutableStatisticsKHR vkGetPipelineExecutableStatisticsKHR = nullptr;
+	PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = nullptr;
+	PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = nullptr;
+	PFN_vkAcquireProfilingLockKHR vkAcquireProfilingLockKHR = nullptr;
+	PFN_vkReleaseProfilingLockKHR vkReleaseProfilingLockKHR = nullptr;
 };
 extern Funcs funcs;
 
@@ -12988,6 +13000,11 @@ inline vector<QueueFamilyProperties2> getPhysicalDeviceQueueFamilyProperties2_th
 inline Result getPhysicalDeviceQueueFamilyProperties2_noThrow(vector<QueueFamilyProperties2>& queueFamilyProperties) noexcept  { return getPhysicalDeviceQueueFamilyProperties2_noThrow(physicalDevice(), queueFamilyProperties); }
 inline vector<QueueFamilyProperties2> getPhysicalDeviceQueueFamilyProperties2()  { return getPhysicalDeviceQueueFamilyProperties2_throw(physicalDevice()); }
 
+void enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR_throw(PhysicalDevice pd, uint32_t queueFamilyIndex, vector<PerformanceCounterKHR>& counters, vector<PerformanceCounterDescriptionKHR>& counterDescriptions);
+Result enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR_noThrow(PhysicalDevice pd, uint32_t queueFamilyIndex, vector<PerformanceCounterKHR>& counters, vector<PerformanceCounterDescriptionKHR>& counterDescriptions) noexcept;
+inline void enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(PhysicalDevice pd, uint32_t queueFamilyIndex, vector<PerformanceCounterKHR>& counters, vector<PerformanceCounterDescriptionKHR>& counterDescriptions)  { enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR_throw(pd, queueFamilyIndex, counters, counterDescriptions); }
+inline uint32_t getPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(PhysicalDevice pd, const QueryPoolPerformanceCreateInfoKHR& performanceQueryCreateInfo) noexcept  { uint32_t n; funcs.vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(pd.handle(), &performanceQueryCreateInfo, &n); return n; }
+
 namespace detail {
 	struct GetPhysicalDeviceQueueFamilyProperties2_struct {
 		uint8_t* pStruct;
@@ -13201,6 +13218,10 @@ inline void destroy(QueryPool queryPool) noexcept  { funcs.vkDestroyQueryPool(de
 inline void getQueryPoolResults_throw(QueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, DeviceSize stride, QueryResultFlags flags)  { Result r = funcs.vkGetQueryPoolResults(detail::_device.handle(), queryPool.handle(), firstQuery, queryCount, dataSize, pData, stride, flags); checkForSuccessValue(r, "vkGetQueryPoolResults"); }
 inline Result getQueryPoolResults_noThrow(QueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, DeviceSize stride, QueryResultFlags flags) noexcept  { return funcs.vkGetQueryPoolResults(detail::_device.handle(), queryPool.handle(), firstQuery, queryCount, dataSize, pData, stride, flags); }
 inline void getQueryPoolResults(QueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, DeviceSize stride, QueryResultFlags flags)  { return getQueryPoolResults_throw(queryPool, firstQuery, queryCount, dataSize, pData, stride, flags); }
+inline void acquireProfilingLockKHR_throw(const AcquireProfilingLockInfoKHR& info)  { Result r = funcs.vkAcquireProfilingLockKHR(detail::_device.handle(), &info); checkForSuccessValue(r, "vkAcquireProfilingLockKHR"); }
+inline Result acquireProfilingLockKHR_noThrow(const AcquireProfilingLockInfoKHR& info) noexcept  { return funcs.vkAcquireProfilingLockKHR(detail::_device.handle(), &info); }
+inline void acquireProfilingLockKHR(const AcquireProfilingLockInfoKHR& info)  { acquireProfilingLockKHR_throw(info); }
+inline void releaseProfilingLockKHR() noexcept  { funcs.vkReleaseProfilingLockKHR(detail::_device.handle()); }
 
 inline Fence createFence_throw(const FenceCreateInfo& createInfo)  { Fence::HandleType h; Result r = funcs.vkCreateFence(detail::_device.handle(), &createInfo, nullptr, &h); detail::processResult(r, h, "vkCreateFence"); return h; }
 inline Result createFence_noThrow(const FenceCreateInfo& createInfo, Fence& fence) noexcept  { return funcs.vkCreateFence(detail::_device.handle(), &createInfo, nullptr, reinterpret_cast<Fence::HandleType*>(&fence)); }
@@ -13298,6 +13319,13 @@ inline void createComputePipelinesUnique(PipelineCache pipelineCache, uint32_t c
 inline void destroyPipeline(Pipeline pipeline) noexcept  { funcs.vkDestroyPipeline(detail::_device.handle(), pipeline.handle(), nullptr); }
 inline void destroy(Pipeline pipeline) noexcept  { funcs.vkDestroyPipeline(detail::_device.handle(), pipeline.handle(), nullptr); }
 
+vector<PipelineExecutablePropertiesKHR> getPipelineExecutablePropertiesKHR_throw(const PipelineInfoKHR& pipelineInfo);
+Result getPipelineExecutablePropertiesKHR_noThrow(const PipelineInfoKHR& pipelineInfo, vector<PipelineExecutablePropertiesKHR>& properties) noexcept;
+inline vector<PipelineExecutablePropertiesKHR> getPipelineExecutablePropertiesKHR(const PipelineInfoKHR& pipelineInfo)  { return getPipelineExecutablePropertiesKHR_throw(pipelineInfo); }
+vector<PipelineExecutableStatisticKHR> getPipelineExecutableStatisticsKHR_throw(const PipelineExecutableInfoKHR& executableInfo);
+Result getPipelineExecutableStatisticsKHR_noThrow(const PipelineExecutableInfoKHR& executableInfo, vector<PipelineExecutableStatisticKHR>& statistics) noexcept;
+inline vector<PipelineExecutableStatisticKHR> getPipelineExecutableStatisticsKHR(const PipelineExecutableInfoKHR& executableInfo)  { return getPipelineExecutableStatisticsKHR_throw(executableInfo); }
+
 inline void cmdPushConstants(CommandBuffer commandBuffer, PipelineLayout layout, ShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) noexcept  { funcs.vkCmdPushConstants(commandBuffer.handle(), layout, stageFlags, offset, size, pValues); }
 inline void cmdBeginRenderPass(CommandBuffer commandBuffer, const RenderPassBeginInfo& pRenderPassBegin, SubpassContents contents) noexcept  { funcs.vkCmdBeginRenderPass(commandBuffer.handle(), &pRenderPassBegin, contents); }
 inline void cmdNextSubpass(CommandBuffer commandBuffer, SubpassContents contents) noexcept  { funcs.vkCmdNextSubpass(commandBuffer.handle(), contents); }
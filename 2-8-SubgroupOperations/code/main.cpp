@@ -0,0 +1,810 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "vkg.h"
+
+using namespace std;
+
+
+// constants
+constexpr const char* appName = "2-8-SubgroupOperations";
+constexpr const float totalMeasuringTime = 10.f;  // total time in seconds for which measurements are made and median time of the measurements is taken at the end
+constexpr const float singleMeasurementTargetTime = 0.01f;  // single measurement time in seconds; the load will be continually adjusted to target this time
+constexpr const float minTimeOfValidMeasurement = 0.002f;  // minimal measurement time to consider it valid measurement
+constexpr const float maxNumWorkgroupsMultiplier = 10.f;  // limits number of workgroups in the next measurement to not be more than 10 times higher then in the current measurement
+constexpr const uint32_t workgroupSize = 128;  // must match local_size_x in subgroup.comp
+constexpr const uint32_t operationsPerInvocation = 1000;  // must match the number of operations in subgroup.comp
+
+
+// shader code as SPIR-V binary
+static const uint32_t subgroupSpirv[] = {
+#include "subgroup.comp.spv"
+};
+
+
+// list of measured operations
+// (the index into the array is passed to the shader as specialization constant)
+constexpr const array<const char*, 6> operationNames = {
+	"subgroupAdd:        ",
+	"subgroupMin:        ",
+	"subgroupMax:        ",
+	"subgroupShuffle:    ",
+	"subgroupBallot:     ",
+	"subgroupBroadcast:  ",
+};
+
+
+// Convert float value to c-string.
+//
+// It prints float followed by SI suffix, such as K, M, G, m, u, n, etc.
+// for kilo, mega, giga, milli, micro, nano,
+// It uses precision of three digits, taking form of one of three variants:
+// 1.23, 12.3, or 123, followed by space and SI suffix.
+// To make it always the same length, third variant appends a space before the number:
+// "1.23 K", "12.3 M", or " 123 G"
+// Supported range is from "100 a" to "999 E". Bigger values are converted to "+inf   ".
+// Lower values including negative numbers are converted to "   0  ".
+static auto formatFloatSI(float v)
+{
+	// return type with implicit conversion to const char*
+	struct SmallString {
+		array<char,7> buffer;
+		operator const char*() const { return buffer.data(); }
+	};
+	SmallString s;
+
+	// compute significand and exponent
+	int exponent = floorf(log10f(v));
+	float divisor = expf(float(exponent - 2) * logf(10));  // this computes exp10f(exponent - 2)
+	int significand = int(v / divisor + 0.5f);  // value is >=100 and <1000, actually it might be
+		// a little out this range because of small floating computation imprecisions; +0.5 makes proper
+		// rounding and avoids underflow to 99, but might cause overflow to 1000 (or even 1001?)
+
+	// convert significand to numbers
+	char n[4];
+	n[3] = significand % 10;
+	significand /= 10;
+	n[2] = significand % 10;
+	significand /= 10;
+	n[1] = significand % 10;
+	int thousandNumber = significand / 10;  // thousandNumber is 0 or 1; value 1 is present in some extreme cases
+	n[0] = thousandNumber;
+	exponent += thousandNumber;  // increment exponent if n contains >=1000
+
+	// make exponent ready to index into SI prefix table
+	constexpr const array<char,13> siPrefix = {
+		'a', 'f', 'p', 'n', 'u', 'm', ' ', 'K', 'M', 'G', 'T', 'P', 'E'
+	};
+	exponent += 18;  // make zero exponent point on the ' ' in siPrefixes
+	if(exponent < 0) {
+		s.buffer = { ' ', ' ', ' ', '0', ' ', ' ', 0 };
+		return s;
+	}
+	if(exponent >= 39) {
+		s.buffer = { '+', 'i', 'n', 'f', ' ', ' ', 0 };
+		return s;
+	}
+
+	// create final string
+	s.buffer[6] = 0;
+	s.buffer[5] = siPrefix[exponent / 3];
+	s.buffer[4] = ' ';
+	int dotPos = (exponent % 3) + 1;
+	if(dotPos == 3)
+		s.buffer[0] = ' ';
+	else
+		s.buffer[dotPos] = '.';
+	s.buffer[3] = '0' + n[3 - thousandNumber];
+	s.buffer[dotPos==2 ? 1 : 2] = '0' + n[2 - thousandNumber];
+	s.buffer[dotPos==3 ? 1 : 0] = '0' + n[1 - thousandNumber];
+	return s;
+}
+
+
+int main(int argc, char* argv[])
+{
+	// catch exceptions
+	// (vk functions throw if they fail)
+	try {
+
+		// parse command-line arguments
+		bool printHelp = false;
+		size_t selectedDeviceIndex = 0;
+		char* deviceFilterString = nullptr;
+		for(int i=1; i<argc; i++) {
+
+			// parse options starting with '-'
+			if(argv[i][0] == '-') {
+
+				// print help
+				if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+					printHelp = true;
+					continue;
+				}
+
+				// parse device index
+				if(argv[i][1] >= '0' && argv[i][1] <= '9') {
+					char* endp = nullptr;
+					selectedDeviceIndex = strtoull(&argv[i][1], &endp, 10);
+					if(selectedDeviceIndex == 0 || endp == &argv[i][1] || (endp && *endp != 0))
+						printHelp = true;
+					continue;
+				}
+
+				printHelp = true;
+				continue;
+			}
+
+			// parse device filter string
+			deviceFilterString = argv[i];
+
+		}
+
+		// print help
+		if(printHelp) {
+			cout << appName << " prints the throughput of subgroup operations of a Vulkan device\n"
+			        "\n"
+			        "Usage: " << appName << " [-<deviceIndex>] [deviceNameFilter]\n"
+			        "   -<deviceIndex> - for example -1 or -3, specifies the index\n"
+			        "      of the device used for the performance test; it might be\n"
+			        "      useful when more devices are present in the system;\n"
+			        "      devices are numbered starting from one\n"
+			        "   deviceNameFilter - only devices matching the given string\n"
+			        "      will be considered; for example AMD, GeForce, Intel\n" << endl;
+			return 99;
+		}
+
+		// load Vulkan library
+		vk::loadLib();
+
+		// Vulkan instance
+		vk::initInstance(
+			vk::InstanceCreateInfo{
+				.flags = {},
+				.pApplicationInfo =
+					&(const vk::ApplicationInfo&)vk::ApplicationInfo{
+						.pApplicationName = appName,
+						.applicationVersion = 0,
+						.pEngineName = nullptr,
+						.engineVersion = 0,
+						.apiVersion = vk::ApiVersion13,  // highest api version used by the application
+					},
+				.enabledLayerCount = 0,
+				.ppEnabledLayerNames = nullptr,
+				.enabledExtensionCount = 0,
+				.ppEnabledExtensionNames = nullptr,
+			}
+		);
+
+		// get compatible and incompatible devices
+		//
+		// required functionality: Vulkan 1.2, shaderInt64, bufferDeviceAddress,
+		//                         compute queue, timestamp support,
+		//                         basic, arithmetic, ballot and shuffle subgroup operations in compute shaders
+		// optional functionality: Vulkan 1.3 or VK_EXT_subgroup_size_control
+		vk::vector<vk::PhysicalDevice> deviceList = vk::enumeratePhysicalDevices();
+		vector<tuple<vk::PhysicalDevice, uint32_t, vk::PhysicalDeviceProperties,
+			vk::QueueFamilyProperties>> compatibleDevices;
+		vector<vk::PhysicalDeviceProperties> incompatibleDevices;
+		for(vk::PhysicalDevice pd : deviceList) {
+
+			// device version 1.2+
+			// (we need it for bufferDeviceAddress and subgroup properties)
+			vk::PhysicalDeviceProperties props = vk::getPhysicalDeviceProperties(pd);
+			if(props.apiVersion < vk::ApiVersion12) {
+				incompatibleDevices.emplace_back(props);
+				continue;
+			}
+
+			// shaderInt64 and bufferDeviceAddress are required
+			vk::PhysicalDeviceVulkan12Features features12;
+			vk::PhysicalDeviceFeatures2 features10 {
+				.pNext = &features12
+			};
+			vk::getPhysicalDeviceFeatures2(pd, features10);
+			if(features10.features.shaderInt64 == false || features12.bufferDeviceAddress == false) {
+				incompatibleDevices.emplace_back(props);
+				continue;
+			}
+
+			// subgroup operations in compute shaders are required
+			vk::PhysicalDeviceSubgroupProperties subgroupProps;
+			vk::PhysicalDeviceProperties2 props2 { .pNext = &subgroupProps };
+			vk::getPhysicalDeviceProperties2(pd, props2);
+			constexpr const vk::SubgroupFeatureFlags requiredOperations =
+				vk::SubgroupFeatureFlagBits::eBasic | vk::SubgroupFeatureFlagBits::eArithmetic |
+				vk::SubgroupFeatureFlagBits::eBallot | vk::SubgroupFeatureFlagBits::eShuffle;
+			if(!(subgroupProps.supportedStages & vk::ShaderStageFlagBits::eCompute) ||
+			   (subgroupProps.supportedOperations & requiredOperations) != requiredOperations)
+			{
+				incompatibleDevices.emplace_back(props);
+				continue;
+			}
+
+			// append compatible queue families
+			vk::vector<vk::QueueFamilyProperties> queueFamilyPropList = vk::getPhysicalDeviceQueueFamilyProperties(pd);
+			bool found = false;
+			for(uint32_t i=0, c=uint32_t(queueFamilyPropList.size()); i<c; i++) {
+
+				// test for compute operations support and for timestamp support
+				vk::QueueFamilyProperties& qfp = queueFamilyPropList[i];
+				if(qfp.queueFlags & vk::QueueFlagBits::eCompute) {
+					if(qfp.timestampValidBits != 0) {
+						found = true;
+						compatibleDevices.emplace_back(pd, i, props, qfp);
+					}
+				}
+
+			}
+
+			// append incompatible devices
+			if(!found)
+				incompatibleDevices.emplace_back(props);
+
+		}
+
+		// print device list
+		cout << "List of devices:" << endl;
+		for(size_t i=0, c=compatibleDevices.size(); i<c; i++) {
+			auto& t = compatibleDevices[i];
+			cout << "   " << i+1 << ": " << get<2>(t).deviceName << " (compute queue family: "
+			     << get<1>(t) << ", type: " << to_cstr(get<2>(t).deviceType) << ")" << endl;
+		}
+		for(size_t i=0, c=incompatibleDevices.size(); i<c; i++) {
+			auto& props = incompatibleDevices[i];
+			cout << "   incompatible: " << props.deviceName
+			     << " (type: " << to_cstr(props.deviceType) << ")" << endl;
+		}
+
+		// handle empty compatibleDevices list
+		if(compatibleDevices.empty()) {
+			cout << "No compatible devices." << endl;
+			return 0;
+		}
+
+		// select the device
+		decltype(compatibleDevices)::iterator selectedDevice;
+		if(deviceFilterString)
+		{
+			// select the device by name and index:
+			// (1) filter devices by name and
+			// (2) on the resulting list, choose the device on the index selectedDeviceIndex-1
+			size_t counter = 1;
+			for(size_t i=0, c=compatibleDevices.size(); i<c; i++) {
+				if(strstr(get<2>(compatibleDevices[i]).deviceName, deviceFilterString)) {
+					if(counter == selectedDeviceIndex || selectedDeviceIndex == 0) {
+						selectedDevice = compatibleDevices.begin() + i;
+						goto deviceFound;
+					}
+					counter++;
+				}
+			}
+
+			// if no device was selected, print error and exit
+			if(counter == 1)
+				cout << "No device selected. Invalid filter string: " << deviceFilterString << "." << endl;
+			else
+				cout << "Invalid device index.\n"
+				     << "Index value: " << selectedDeviceIndex << ", filter string: "
+				     << deviceFilterString << "." << endl;
+			return 99;
+
+		deviceFound:;
+		}
+		else if(selectedDeviceIndex > 0)
+		{
+			// select the device by index
+			if(selectedDeviceIndex > compatibleDevices.size()) {
+				cout << "Invalid device index." << endl;
+				return 99;
+			}
+			selectedDevice = compatibleDevices.begin() + selectedDeviceIndex - 1;
+		}
+		else
+		{
+			// choose the device automatically
+			// using score heuristic
+			selectedDevice = compatibleDevices.begin();
+			constexpr const array deviceTypeScore = {
+				10,  // vk::PhysicalDeviceType::eOther         - lowest score
+				40,  // vk::PhysicalDeviceType::eIntegratedGpu - high score
+				50,  // vk::PhysicalDeviceType::eDiscreteGpu   - highest score
+				30,  // vk::PhysicalDeviceType::eVirtualGpu    - normal score
+				20,  // vk::PhysicalDeviceType::eCpu           - low score
+				10,  // unknown vk::PhysicalDeviceType
+			};
+			int score = deviceTypeScore[clamp(int(get<2>(*selectedDevice).deviceType), 0, int(deviceTypeScore.size())-1)];
+			for(auto it=compatibleDevices.begin()+1; it!=compatibleDevices.end(); it++) {
+				int newScore = deviceTypeScore[clamp(int(get<2>(*it).deviceType), 0, int(deviceTypeScore.size())-1)];
+				if(newScore > score) {
+					selectedDevice = it;
+					score = newScore;
+				}
+			}
+		}
+
+		// device to use
+		cout << "Using device:\n"
+		        "   " << get<2>(*selectedDevice).deviceName << endl;
+		vk::PhysicalDevice pd = get<0>(*selectedDevice);
+		uint32_t queueFamily = get<1>(*selectedDevice);
+		uint32_t timestampValidBits = get<3>(*selectedDevice).timestampValidBits;
+		uint64_t timestampValidBitMask = (timestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << timestampValidBits) - 1;
+		float timestampPeriod = get<2>(*selectedDevice).limits.timestampPeriod;
+		bool vulkan13Support = get<2>(*selectedDevice).apiVersion >= vk::ApiVersion13;
+
+		// release resources
+		compatibleDevices.clear();
+		incompatibleDevices.clear();
+
+		// subgroup size control support
+		// (it is core functionality since Vulkan 1.3, otherwise provided by VK_EXT_subgroup_size_control)
+		bool subgroupSizeControlExtensionSupport = false;
+		if(!vulkan13Support) {
+			vk::vector<vk::ExtensionProperties> extensionList =
+				vk::enumerateDeviceExtensionProperties(pd, nullptr);
+			for(const vk::ExtensionProperties& e : extensionList)
+				if(strcmp(e.extensionName, "VK_EXT_subgroup_size_control") == 0)
+					subgroupSizeControlExtensionSupport = true;
+		}
+		bool subgroupSizeControlSupport =
+			[&]() -> bool
+			{
+				if(!vulkan13Support && !subgroupSizeControlExtensionSupport)
+					return false;
+				vk::PhysicalDeviceSubgroupSizeControlFeatures subgroupSizeControlFeatures;
+				vk::PhysicalDeviceFeatures2 features10 = { .pNext = &subgroupSizeControlFeatures };
+				vk::getPhysicalDeviceFeatures2(pd, features10);
+				return subgroupSizeControlFeatures.subgroupSizeControl &&
+				       subgroupSizeControlFeatures.computeFullSubgroups;
+			}();
+
+		// subgroup info
+		vk::PhysicalDeviceSubgroupSizeControlProperties subgroupSizeControlProps;
+		vk::PhysicalDeviceSubgroupProperties subgroupProps {
+			.pNext = (subgroupSizeControlSupport) ? &subgroupSizeControlProps : nullptr,
+		};
+		vk::PhysicalDeviceProperties2 props10 { .pNext = &subgroupProps };
+		vk::getPhysicalDeviceProperties2(pd, props10);
+		cout << "Subgroup info:" << endl;
+		cout << "   Subgroup size:  " << subgroupProps.subgroupSize << endl;
+		cout << "   Supported operations: ";
+		constexpr const array<tuple<vk::SubgroupFeatureFlagBits, const char*>, 8> operationList = {
+			tuple{ vk::SubgroupFeatureFlagBits::eBasic,           " basic" },
+			tuple{ vk::SubgroupFeatureFlagBits::eVote,            " vote" },
+			tuple{ vk::SubgroupFeatureFlagBits::eArithmetic,      " arithmetic" },
+			tuple{ vk::SubgroupFeatureFlagBits::eBallot,          " ballot" },
+			tuple{ vk::SubgroupFeatureFlagBits::eShuffle,         " shuffle" },
+			tuple{ vk::SubgroupFeatureFlagBits::eShuffleRelative, " shuffle_relative" },
+			tuple{ vk::SubgroupFeatureFlagBits::eClustered,       " clustered" },
+			tuple{ vk::SubgroupFeatureFlagBits::eQuad,            " quad" },
+		};
+		for(auto [bit, name] : operationList)
+			if(subgroupProps.supportedOperations & bit)
+				cout << name;
+		cout << endl;
+		cout << "   Quad operations in all stages:  " << (subgroupProps.quadOperationsInAllStages ? "yes" : "no") << endl;
+		cout << "   Subgroup size control:  ";
+		if(!subgroupSizeControlSupport)
+			cout << "not supported" << endl;
+		else {
+			cout << (vulkan13Support ? "supported (Vulkan 1.3)" : "supported (VK_EXT_subgroup_size_control)") << endl;
+			cout << "   Min subgroup size:  " << subgroupSizeControlProps.minSubgroupSize << endl;
+			cout << "   Max subgroup size:  " << subgroupSizeControlProps.maxSubgroupSize << endl;
+			cout << "   Max compute workgroup subgroups:  " << subgroupSizeControlProps.maxComputeWorkgroupSubgroups << endl;
+			cout << "   Required subgroup size in compute shaders:  "
+			     << ((subgroupSizeControlProps.requiredSubgroupSizeStages & vk::ShaderStageFlagBits::eCompute) ? "supported" : "not supported") << endl;
+		}
+
+		// create device
+		vk::PhysicalDeviceSubgroupSizeControlFeatures subgroupSizeControlFeatures {
+			.subgroupSizeControl = true,
+			.computeFullSubgroups = true,
+		};
+		vk::PhysicalDeviceVulkan13Features features13 {
+			.subgroupSizeControl = true,
+			.computeFullSubgroups = true,
+		};
+		vk::initDevice(
+			pd,  // physicalDevice
+			vk::DeviceCreateInfo{  // pCreateInfo
+				.flags = {},
+				.queueCreateInfoCount = 1,
+				.pQueueCreateInfos =
+					array{
+						vk::DeviceQueueCreateInfo{
+							.flags = {},
+							.queueFamilyIndex = queueFamily,
+							.queueCount = 1,
+							.pQueuePriorities = &(const float&)1.f,
+						}
+					}.data(),
+				.enabledLayerCount = 0,  // no enabled layers
+				.ppEnabledLayerNames = nullptr,
+				.enabledExtensionCount = (subgroupSizeControlSupport && !vulkan13Support) ? 1u : 0u,
+				.ppEnabledExtensionNames =
+					array<const char*, 1>{
+						"VK_EXT_subgroup_size_control",
+					}.data(),
+				.pEnabledFeatures =
+					&(const vk::PhysicalDeviceFeatures&)vk::PhysicalDeviceFeatures{
+						.shaderInt64 = true,
+					},
+			}
+			.setPNext(
+				&(const vk::PhysicalDeviceVulkan12Features&)vk::PhysicalDeviceVulkan12Features{
+					.bufferDeviceAddress = true,
+				}
+				.setPNext(
+					(!subgroupSizeControlSupport)
+						? nullptr
+						: (vulkan13Support)
+							? static_cast<const void*>(&features13)
+							: static_cast<const void*>(&subgroupSizeControlFeatures)
+				)
+			)
+		);
+
+		// get queue
+		vk::Queue queue = vk::getDeviceQueue(queueFamily, 0);
+
+		// shader module
+		vk::UniqueShaderModule shaderModule =
+			vk::createShaderModuleUnique(
+				vk::ShaderModuleCreateInfo{
+					.flags = {},
+					.codeSize = sizeof(subgroupSpirv),
+					.pCode = subgroupSpirv,
+				}
+			);
+
+		// pipeline layout
+		vk::UniquePipelineLayout pipelineLayout =
+			vk::createPipelineLayoutUnique(
+				vk::PipelineLayoutCreateInfo{
+					.flags = {},
+					.setLayoutCount = 0,
+					.pSetLayouts = nullptr,
+					.pushConstantRangeCount = 0,
+					.pPushConstantRanges = nullptr,
+				}
+			);
+
+		// list of subgroup sizes to test;
+		// zero means default subgroup size chosen by the driver,
+		// other values are required subgroup sizes (powers of two from minSubgroupSize to maxSubgroupSize)
+		vector<uint32_t> subgroupSizeList = { 0 };
+		if(subgroupSizeControlSupport &&
+		   (subgroupSizeControlProps.requiredSubgroupSizeStages & vk::ShaderStageFlagBits::eCompute))
+		{
+			for(uint32_t s=subgroupSizeControlProps.minSubgroupSize; s<=subgroupSizeControlProps.maxSubgroupSize; s*=2) {
+
+				// workgroup must be composed of full subgroups
+				// and the number of subgroups must not exceed maxComputeWorkgroupSubgroups
+				if(s > workgroupSize || workgroupSize / s > subgroupSizeControlProps.maxComputeWorkgroupSubgroups)
+					continue;
+				subgroupSizeList.push_back(s);
+
+			}
+		}
+
+		// test list;
+		// each test has its own pipeline for each combination of operation and subgroup size
+		struct Test {
+			uint32_t operation;
+			uint32_t subgroupSize;
+			vk::UniquePipeline pipeline;
+			size_t numWorkgroups = 1;
+			float lastTime;
+			vector<float> performanceList;
+		};
+		vector<Test> testList;
+		testList.reserve(subgroupSizeList.size() * operationNames.size());
+
+		// create pipelines
+		cout << "Creating pipelines..." << flush;
+		chrono::time_point creationStart = chrono::high_resolution_clock::now();
+		for(uint32_t subgroupSize : subgroupSizeList)
+			for(uint32_t operation=0; operation<operationNames.size(); operation++) {
+
+				vk::PipelineShaderStageRequiredSubgroupSizeCreateInfo requiredSubgroupSizeInfo{
+					.requiredSubgroupSize = subgroupSize,
+				};
+				testList.emplace_back(
+					operation,
+					subgroupSize,
+					vk::createComputePipelineUnique(
+						nullptr,
+						vk::ComputePipelineCreateInfo{
+							.flags = {},
+							.stage =
+								vk::PipelineShaderStageCreateInfo{
+									.pNext = (subgroupSize != 0) ? &requiredSubgroupSizeInfo : nullptr,
+									.flags = (subgroupSize != 0)
+										? vk::PipelineShaderStageCreateFlagBits::eRequireFullSubgroups
+										: vk::PipelineShaderStageCreateFlags(),
+									.stage = vk::ShaderStageFlagBits::eCompute,
+									.module = shaderModule,
+									.pName = "main",
+									.pSpecializationInfo =
+										&(const vk::SpecializationInfo&)vk::SpecializationInfo{
+											.mapEntryCount = 1,
+											.pMapEntries =
+												&(const vk::SpecializationMapEntry&)vk::SpecializationMapEntry{
+													.constantID = 0,
+													.offset = 0,
+													.size = sizeof(uint32_t),
+												},
+											.dataSize = sizeof(uint32_t),
+											.pData = &operation,
+										},
+								},
+							.layout = pipelineLayout,
+							.basePipelineHandle = nullptr,
+							.basePipelineIndex = -1,
+						}
+					)
+				);
+
+			}
+		chrono::time_point creationEnd = chrono::high_resolution_clock::now();
+		cout << " done.\n   " << testList.size() << " pipelines were created in "
+		     << chrono::duration<float>(creationEnd - creationStart).count() * 1e3 << "ms." << endl;
+
+		// timestamp pool
+		vk::UniqueQueryPool timestampPool =
+			vk::createQueryPoolUnique(
+				vk::QueryPoolCreateInfo{
+					.flags = {},
+					.queryType = vk::QueryType::eTimestamp,
+					.queryCount = 2,
+					.pipelineStatistics = {},
+				}
+			);
+
+		// command pool
+		vk::UniqueCommandPool commandPool =
+			vk::createCommandPoolUnique(
+				vk::CommandPoolCreateInfo{
+					.flags = vk::CommandPoolCreateFlagBits::eTransient |
+					         vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+					.queueFamilyIndex = queueFamily,
+				}
+			);
+
+		// allocate command buffer
+		vk::CommandBuffer commandBuffer =
+			vk::allocateCommandBuffer(
+				vk::CommandBufferAllocateInfo{
+					.commandPool = commandPool,
+					.level = vk::CommandBufferLevel::ePrimary,
+					.commandBufferCount = 1,
+				}
+			);
+
+		// fence
+		vk::UniqueFence computingFinishedFence =
+			vk::createFenceUnique(
+				vk::FenceCreateInfo{
+					.flags = {}
+				}
+			);
+
+		auto performTest =
+			[&](vk::Pipeline pipeline, size_t numWorkgroups) -> float {
+
+				// begin command buffer
+				vk::beginCommandBuffer(
+					commandBuffer,
+					vk::CommandBufferBeginInfo{
+						.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+						.pInheritanceInfo = nullptr,
+					}
+				);
+
+				// reset timestamp pool
+				vk::cmdResetQueryPool(
+					commandBuffer,
+					timestampPool,
+					0,  // firstQuery
+					2);  // queryCount
+
+				// bind pipeline
+				vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+
+				// write timestamp 0
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eTopOfPipe,
+					timestampPool,
+					0);  // query
+
+				// dispatch computation
+				// (avoid any dimension to go over 10000)
+				uint32_t workgroupCountX;
+				uint32_t workgroupCountY;
+				uint32_t workgroupCountZ;
+				if(numWorkgroups > 10000 * 10000) {
+					workgroupCountZ = 1 + ((numWorkgroups - 1) / (10000 * 10000));
+					uint64_t remainder = numWorkgroups / workgroupCountZ;
+					workgroupCountY = 1 + ((remainder - 1) / 10000);
+					workgroupCountX = remainder / workgroupCountY;
+				}
+				else {
+					if(numWorkgroups == 0)
+						numWorkgroups = 1;
+					workgroupCountZ = 1;
+					workgroupCountY = 1 + ((numWorkgroups - 1) / 10000);
+					workgroupCountX = numWorkgroups / workgroupCountY;
+				}
+				vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
+
+				// write timestamp 1
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eBottomOfPipe,
+					timestampPool,
+					1);  // query
+
+				// end command buffer
+				vk::endCommandBuffer(commandBuffer);
+
+
+				// submit work
+				vk::queueSubmit(
+					queue,
+					vk::SubmitInfo{
+						.waitSemaphoreCount = 0,
+						.pWaitSemaphores = nullptr,
+						.pWaitDstStageMask = nullptr,
+						.commandBufferCount = 1,
+						.pCommandBuffers = &commandBuffer,
+						.signalSemaphoreCount = 0,
+						.pSignalSemaphores = nullptr,
+					},
+					computingFinishedFence
+				);
+
+				// wait for the work
+				vk::Result r =
+					vk::waitForFence_noThrow(
+						computingFinishedFence,
+						uint64_t(1.5e9)  // timeout (1.5 seconds)
+					);
+				if(r == vk::Result::eTimeout) {
+					cout << "Vulkan device timeout. Task is probably hanging." << endl;
+					// use std::quick_exit() to terminate the application
+					// (Do not throw, do not return, do not call std::exit().
+					// The device is still busy and it uses number of handles such as
+					// computingFinishedFence and device handle itself.
+					// Destruction of the handles in use or the unallowed access to them
+					// is forbidden by Vulkan specification.
+					quick_exit(-1);
+				} else
+					vk::checkForSuccessValue(r, "vkWaitForFences");
+
+				// reset fence
+				vk::resetFence(computingFinishedFence);
+
+				// read timestamps
+				array<uint64_t, 2> timestamps;
+				vk::getQueryPoolResults(
+					timestampPool,  // queryPool
+					0,  // firstQuery
+					2,  // queryCount
+					2 * sizeof(uint64_t),  // dataSize
+					timestamps.data(),  // pData
+					sizeof(uint64_t),  // stride
+					vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait  // flags
+				);
+
+				// return time as float in seconds
+				return float((timestamps[1] - timestamps[0]) & timestampValidBitMask) * timestampPeriod / 1e9;
+
+			};
+
+		// record the performance in operations per second;
+		// each shader invocation performs operationsPerInvocation subgroup operations
+		auto processResult =
+			[](float time, size_t numWorkgroups, vector<float>& performanceList) {
+				if(time >= minTimeOfValidMeasurement) {
+					uint64_t numOperations = uint64_t(operationsPerInvocation) * workgroupSize * numWorkgroups;
+					float performance = float(numOperations) / time;
+					performanceList.push_back(performance);
+				}
+			};
+
+		// compute number of workgroups in the next iteration
+		// to eventually reach singleMeasurementTargetTime
+		auto computeNumWorkgroups =
+			[](size_t lastNumWorkgroups, float lastTime) -> size_t
+			{
+				if(lastTime < (singleMeasurementTargetTime / maxNumWorkgroupsMultiplier)) {
+					// multiply numWorkgroups by maxNumWorkgroupsMultiplier
+					return lastNumWorkgroups * maxNumWorkgroupsMultiplier;
+				}
+				else {
+					// multiply numWorkgroups by ratio
+					float ratio = singleMeasurementTargetTime / lastTime;
+					size_t newNumWorkgroups = size_t(lastNumWorkgroups * ratio);
+					return (newNumWorkgroups >= 1) ? newNumWorkgroups : 1;
+				}
+			};
+
+		cout << "Running tests..." << endl;
+		chrono::time_point startTime = chrono::high_resolution_clock::now();
+		do {
+
+			// perform tests
+			for(Test& t : testList) {
+				t.lastTime = performTest(t.pipeline, t.numWorkgroups);
+				processResult(t.lastTime, t.numWorkgroups, t.performanceList);
+			}
+
+			// stop measurements after totalMeasuringTime passed
+			float totalTime = chrono::duration<float>(chrono::high_resolution_clock::now() - startTime).count();
+			if(totalTime >= totalMeasuringTime)
+				break;
+
+			// compute new numWorkgroups
+			for(Test& t : testList)
+				t.numWorkgroups = computeNumWorkgroups(t.numWorkgroups, t.lastTime);
+
+		} while(true);
+
+		// sort the results
+		for(Test& t : testList)
+			sort(t.performanceList.begin(), t.performanceList.end());
+
+		// print results
+		auto printResult =
+			[](const string_view text, const vector<float>& performanceList) {
+				cout << text;
+				if(performanceList.empty())
+					cout << "measurement error" << endl;
+				else {
+
+					// print median
+					cout << formatFloatSI(performanceList[performanceList.size()/2]) << "OPS";
+
+					// print dispersion using IQR (Interquartile Range);
+					// Q1 is the value in 25% and Q3 in 75%
+					cout << "  (Q1: " << formatFloatSI(performanceList[performanceList.size()/4]) << "OPS,"
+					        " Q3: " << formatFloatSI(performanceList[(performanceList.size()*3)/4]) << "OPS,"
+					        " num measurements: " << performanceList.size() << ")";
+					cout << endl;
+				}
+			};
+		cout << "Subgroup operation throughput\n"
+		        "(operations per second summed over all shader invocations):" << endl;
+		uint32_t lastSubgroupSize = ~uint32_t(0);
+		for(const Test& t : testList) {
+			if(t.subgroupSize != lastSubgroupSize) {
+				lastSubgroupSize = t.subgroupSize;
+				if(t.subgroupSize == 0)
+					cout << "Default subgroup size (" << subgroupProps.subgroupSize << "):" << endl;
+				else
+					cout << "Required subgroup size " << t.subgroupSize << ":" << endl;
+			}
+			printResult(string("   ") + operationNames[t.operation], t.performanceList);
+		}
+
+	// catch exceptions
+	} catch(vk::Error& e) {
+		cout << e.what() << endl;
+	} catch(exception& e) {
+		cout << "Failed because of exception: " << e.what() << endl;
+	} catch(...) {
+		cout << "Failed because of unspecified exception." << endl;
+	}
+
+	vk::cleanUp();
+	return 0;
+}
@@ -0,0 +1,759 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "vkg.h"
+
+using namespace std;
+
+
+// constants
+constexpr const char* appName = "2-9-SharedMemory";
+constexpr const float totalMeasuringTime = 10.f;  // total time in seconds for which measurements are made and median time of the measurements is taken at the end
+constexpr const float singleMeasurementTargetTime = 0.01f;  // single measurement time in seconds; the load will be continually adjusted to target this time
+constexpr const float minTimeOfValidMeasurement = 0.002f;  // minimal measurement time to consider it valid measurement
+constexpr const float maxNumWorkgroupsMultiplier = 10.f;  // limits number of workgroups in the next measurement to not be more than 10 times higher then in the current measurement
+constexpr const uint32_t loadsPerIteration = 100;  // must match the number of loads in one iteration in shared-memory.comp
+constexpr const uint32_t bandwidthNumIterations = 100;  // number of iterations used by bandwidth tests
+constexpr const uint32_t latencyWorkgroupSize = 32;  // workgroup size used by latency tests
+
+
+// shader code as SPIR-V binary
+static const uint32_t sharedMemorySpirv[] = {
+#include "shared-memory.comp.spv"
+};
+
+
+// list of measured access patterns
+// (stride is passed to the shader as specialization constant; zero means broadcast;
+// stride 33 demonstrates the effect of padding on the stride of 32)
+constexpr const array<tuple<uint32_t, const char*>, 8> accessPatternList = {
+	tuple{  1u, "conflict-free:  " },
+	tuple{  2u, "stride 2:       " },
+	tuple{  4u, "stride 4:       " },
+	tuple{  8u, "stride 8:       " },
+	tuple{ 16u, "stride 16:      " },
+	tuple{ 32u, "stride 32:      " },
+	tuple{ 33u, "stride 33:      " },
+	tuple{  0u, "broadcast:      " },
+};
+
+
+// Convert float value to c-string.
+//
+// It prints float followed by SI suffix, such as K, M, G, m, u, n, etc.
+// for kilo, mega, giga, milli, micro, nano,
+// It uses precision of three digits, taking form of one of three variants:
+// 1.23, 12.3, or 123, followed by space and SI suffix.
+// To make it always the same length, third variant appends a space before the number:
+// "1.23 K", "12.3 M", or " 123 G"
+// Supported range is from "100 a" to "999 E". Bigger values are converted to "+inf   ".
+// Lower values including negative numbers are converted to "   0  ".
+static auto formatFloatSI(float v)
+{
+	// return type with implicit conversion to const char*
+	struct SmallString {
+		array<char,7> buffer;
+		operator const char*() const { return buffer.data(); }
+	};
+	SmallString s;
+
+	// compute significand and exponent
+	int exponent = floorf(log10f(v));
+	float divisor = expf(float(exponent - 2) * logf(10));  // this computes exp10f(exponent - 2)
+	int significand = int(v / divisor + 0.5f);  // value is >=100 and <1000, actually it might be
+		// a little out this range because of small floating computation imprecisions; +0.5 makes proper
+		// rounding and avoids underflow to 99, but might cause overflow to 1000 (or even 1001?)
+
+	// convert significand to numbers
+	char n[4];
+	n[3] = significand % 10;
+	significand /= 10;
+	n[2] = significand % 10;
+	significand /= 10;
+	n[1] = significand % 10;
+	int thousandNumber = significand / 10;  // thousandNumber is 0 or 1; value 1 is present in some extreme cases
+	n[0] = thousandNumber;
+	exponent += thousandNumber;  // increment exponent if n contains >=1000
+
+	// make exponent ready to index into SI prefix table
+	constexpr const array<char,13> siPrefix = {
+		'a', 'f', 'p', 'n', 'u', 'm', ' ', 'K', 'M', 'G', 'T', 'P', 'E'
+	};
+	exponent += 18;  // make zero exponent point on the ' ' in siPrefixes
+	if(exponent < 0) {
+		s.buffer = { ' ', ' ', ' ', '0', ' ', ' ', 0 };
+		return s;
+	}
+	if(exponent >= 39) {
+		s.buffer = { '+', 'i', 'n', 'f', ' ', ' ', 0 };
+		return s;
+	}
+
+	// create final string
+	s.buffer[6] = 0;
+	s.buffer[5] = siPrefix[exponent / 3];
+	s.buffer[4] = ' ';
+	int dotPos = (exponent % 3) + 1;
+	if(dotPos == 3)
+		s.buffer[0] = ' ';
+	else
+		s.buffer[dotPos] = '.';
+	s.buffer[3] = '0' + n[3 - thousandNumber];
+	s.buffer[dotPos==2 ? 1 : 2] = '0' + n[2 - thousandNumber];
+	s.buffer[dotPos==3 ? 1 : 0] = '0' + n[1 - thousandNumber];
+	return s;
+}
+
+
+int main(int argc, char* argv[])
+{
+	// catch exceptions
+	// (vk functions throw if they fail)
+	try {
+
+		// parse command-line arguments
+		bool printHelp = false;
+		size_t selectedDeviceIndex = 0;
+		char* deviceFilterString = nullptr;
+		for(int i=1; i<argc; i++) {
+
+			// parse options starting with '-'
+			if(argv[i][0] == '-') {
+
+				// print help
+				if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+					printHelp = true;
+					continue;
+				}
+
+				// parse device index
+				if(argv[i][1] >= '0' && argv[i][1] <= '9') {
+					char* endp = nullptr;
+					selectedDeviceIndex = strtoull(&argv[i][1], &endp, 10);
+					if(selectedDeviceIndex == 0 || endp == &argv[i][1] || (endp && *endp != 0))
+						printHelp = true;
+					continue;
+				}
+
+				printHelp = true;
+				continue;
+			}
+
+			// parse device filter string
+			deviceFilterString = argv[i];
+
+		}
+
+		// print help
+		if(printHelp) {
+			cout << appName << " prints the bandwidth and latency of shared memory of a Vulkan device\n"
+			        "\n"
+			        "Usage: " << appName << " [-<deviceIndex>] [deviceNameFilter]\n"
+			        "   -<deviceIndex> - for example -1 or -3, specifies the index\n"
+			        "      of the device used for the performance test; it might be\n"
+			        "      useful when more devices are present in the system;\n"
+			        "      devices are numbered starting from one\n"
+			        "   deviceNameFilter - only devices matching the given string\n"
+			        "      will be considered; for example AMD, GeForce, Intel\n" << endl;
+			return 99;
+		}
+
+		// load Vulkan library
+		vk::loadLib();
+
+		// Vulkan instance
+		vk::initInstance(
+			vk::InstanceCreateInfo{
+				.flags = {},
+				.pApplicationInfo =
+					&(const vk::ApplicationInfo&)vk::ApplicationInfo{
+						.pApplicationName = appName,
+						.applicationVersion = 0,
+						.pEngineName = nullptr,
+						.engineVersion = 0,
+						.apiVersion = vk::ApiVersion12,  // highest api version used by the application
+					},
+				.enabledLayerCount = 0,
+				.ppEnabledLayerNames = nullptr,
+				.enabledExtensionCount = 0,
+				.ppEnabledExtensionNames = nullptr,
+			}
+		);
+
+		// get compatible and incompatible devices
+		//
+		// required functionality: Vulkan 1.2, shaderInt64, bufferDeviceAddress,
+		//                         compute queue, timestamp support
+		vk::vector<vk::PhysicalDevice> deviceList = vk::enumeratePhysicalDevices();
+		vector<tuple<vk::PhysicalDevice, uint32_t, vk::PhysicalDeviceProperties,
+			vk::QueueFamilyProperties>> compatibleDevices;
+		vector<vk::PhysicalDeviceProperties> incompatibleDevices;
+		for(vk::PhysicalDevice pd : deviceList) {
+
+			// device version 1.2+
+			// (we need it for bufferDeviceAddress)
+			vk::PhysicalDeviceProperties props = vk::getPhysicalDeviceProperties(pd);
+			if(props.apiVersion < vk::ApiVersion12) {
+				incompatibleDevices.emplace_back(props);
+				continue;
+			}
+
+			// shaderInt64 and bufferDeviceAddress are required
+			vk::PhysicalDeviceVulkan12Features features12;
+			vk::PhysicalDeviceFeatures2 features10 {
+				.pNext = &features12
+			};
+			vk::getPhysicalDeviceFeatures2(pd, features10);
+			if(features10.features.shaderInt64 == false || features12.bufferDeviceAddress == false) {
+				incompatibleDevices.emplace_back(props);
+				continue;
+			}
+
+			// append compatible queue families
+			vk::vector<vk::QueueFamilyProperties> queueFamilyPropList = vk::getPhysicalDeviceQueueFamilyProperties(pd);
+			bool found = false;
+			for(uint32_t i=0, c=uint32_t(queueFamilyPropList.size()); i<c; i++) {
+
+				// test for compute operations support and for timestamp support
+				vk::QueueFamilyProperties& qfp = queueFamilyPropList[i];
+				if(qfp.queueFlags & vk::QueueFlagBits::eCompute) {
+					if(qfp.timestampValidBits != 0) {
+						found = true;
+						compatibleDevices.emplace_back(pd, i, props, qfp);
+					}
+				}
+
+			}
+
+			// append incompatible devices
+			if(!found)
+				incompatibleDevices.emplace_back(props);
+
+		}
+
+		// print device list
+		cout << "List of devices:" << endl;
+		for(size_t i=0, c=compatibleDevices.size(); i<c; i++) {
+			auto& t = compatibleDevices[i];
+			cout << "   " << i+1 << ": " << get<2>(t).deviceName << " (compute queue family: "
+			     << get<1>(t) << ", type: " << to_cstr(get<2>(t).deviceType) << ")" << endl;
+		}
+		for(size_t i=0, c=incompatibleDevices.size(); i<c; i++) {
+			auto& props = incompatibleDevices[i];
+			cout << "   incompatible: " << props.deviceName
+			     << " (type: " << to_cstr(props.deviceType) << ")" << endl;
+		}
+
+		// handle empty compatibleDevices list
+		if(compatibleDevices.empty()) {
+			cout << "No compatible devices." << endl;
+			return 0;
+		}
+
+		// select the device
+		decltype(compatibleDevices)::iterator selectedDevice;
+		if(deviceFilterString)
+		{
+			// select the device by name and index:
+			// (1) filter devices by name and
+			// (2) on the resulting list, choose the device on the index selectedDeviceIndex-1
+			size_t counter = 1;
+			for(size_t i=0, c=compatibleDevices.size(); i<c; i++) {
+				if(strstr(get<2>(compatibleDevices[i]).deviceName, deviceFilterString)) {
+					if(counter == selectedDeviceIndex || selectedDeviceIndex == 0) {
+						selectedDevice = compatibleDevices.begin() + i;
+						goto deviceFound;
+					}
+					counter++;
+				}
+			}
+
+			// if no device was selected, print error and exit
+			if(counter == 1)
+				cout << "No device selected. Invalid filter string: " << deviceFilterString << "." << endl;
+			else
+				cout << "Invalid device index.\n"
+				     << "Index value: " << selectedDeviceIndex << ", filter string: "
+				     << deviceFilterString << "." << endl;
+			return 99;
+
+		deviceFound:;
+		}
+		else if(selectedDeviceIndex > 0)
+		{
+			// select the device by index
+			if(selectedDeviceIndex > compatibleDevices.size()) {
+				cout << "Invalid device index." << endl;
+				return 99;
+			}
+			selectedDevice = compatibleDevices.begin() + selectedDeviceIndex - 1;
+		}
+		else
+		{
+			// choose the device automatically
+			// using score heuristic
+			selectedDevice = compatibleDevices.begin();
+			constexpr const array deviceTypeScore = {
+				10,  // vk::PhysicalDeviceType::eOther         - lowest score
+				40,  // vk::PhysicalDeviceType::eIntegratedGpu - high score
+				50,  // vk::PhysicalDeviceType::eDiscreteGpu   - highest score
+				30,  // vk::PhysicalDeviceType::eVirtualGpu    - normal score
+				20,  // vk::PhysicalDeviceType::eCpu           - low score
+				10,  // unknown vk::PhysicalDeviceType
+			};
+			int score = deviceTypeScore[clamp(int(get<2>(*selectedDevice).deviceType), 0, int(deviceTypeScore.size())-1)];
+			for(auto it=compatibleDevices.begin()+1; it!=compatibleDevices.end(); it++) {
+				int newScore = deviceTypeScore[clamp(int(get<2>(*it).deviceType), 0, int(deviceTypeScore.size())-1)];
+				if(newScore > score) {
+					selectedDevice = it;
+					score = newScore;
+				}
+			}
+		}
+
+		// device to use
+		cout << "Using device:\n"
+		        "   " << get<2>(*selectedDevice).deviceName << endl;
+		vk::PhysicalDevice pd = get<0>(*selectedDevice);
+		uint32_t queueFamily = get<1>(*selectedDevice);
+		uint32_t timestampValidBits = get<3>(*selectedDevice).timestampValidBits;
+		uint64_t timestampValidBitMask = (timestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << timestampValidBits) - 1;
+		float timestampPeriod = get<2>(*selectedDevice).limits.timestampPeriod;
+		vk::PhysicalDeviceLimits limits = get<2>(*selectedDevice).limits;
+
+		// release resources
+		compatibleDevices.clear();
+		incompatibleDevices.clear();
+
+
+		// shared memory info
+		cout << "Shared memory info:" << endl;
+		cout << "   Max compute shared memory size:  " << limits.maxComputeSharedMemorySize << " bytes" << endl;
+		cout << "   Max compute workgroup invocations:  " << limits.maxComputeWorkGroupInvocations << endl;
+
+		// create device
+		vk::initDevice(
+			pd,  // physicalDevice
+			vk::DeviceCreateInfo{  // pCreateInfo
+				.flags = {},
+				.queueCreateInfoCount = 1,
+				.pQueueCreateInfos =
+					array{
+						vk::DeviceQueueCreateInfo{
+							.flags = {},
+							.queueFamilyIndex = queueFamily,
+							.queueCount = 1,
+							.pQueuePriorities = &(const float&)1.f,
+						}
+					}.data(),
+				.enabledLayerCount = 0,  // no enabled layers
+				.ppEnabledLayerNames = nullptr,
+				.enabledExtensionCount = 0,  // no enabled extensions
+				.ppEnabledExtensionNames = nullptr,
+				.pEnabledFeatures =
+					&(const vk::PhysicalDeviceFeatures&)vk::PhysicalDeviceFeatures{
+						.shaderInt64 = true,
+					},
+			}
+			.setPNext(
+				&(const vk::PhysicalDeviceVulkan12Features&)vk::PhysicalDeviceVulkan12Features{
+					.bufferDeviceAddress = true,
+				}
+			)
+		);
+
+		// get queue
+		vk::Queue queue = vk::getDeviceQueue(queueFamily, 0);
+
+		// shader module
+		vk::UniqueShaderModule shaderModule =
+			vk::createShaderModuleUnique(
+				vk::ShaderModuleCreateInfo{
+					.flags = {},
+					.codeSize = sizeof(sharedMemorySpirv),
+					.pCode = sharedMemorySpirv,
+				}
+			);
+
+		// pipeline layout
+		// (push constants hold the number of iterations and the zero used for shared memory initialization)
+		vk::UniquePipelineLayout pipelineLayout =
+			vk::createPipelineLayoutUnique(
+				vk::PipelineLayoutCreateInfo{
+					.flags = {},
+					.setLayoutCount = 0,
+					.pSetLayouts = nullptr,
+					.pushConstantRangeCount = 1,
+					.pPushConstantRanges =
+						&(const vk::PushConstantRange&)vk::PushConstantRange{
+							.stageFlags = vk::ShaderStageFlagBits::eCompute,
+							.offset = 0,
+							.size = 2 * sizeof(uint32_t),
+						},
+				}
+			);
+
+		// list of workgroup sizes to test
+		// (powers of two from 32 up to the device limits)
+		vector<uint32_t> workgroupSizeList;
+		for(uint32_t s=32; s<=1024; s*=2)
+			if(s <= limits.maxComputeWorkGroupSize[0] && s <= limits.maxComputeWorkGroupInvocations)
+				workgroupSizeList.push_back(s);
+
+		// test list;
+		// bandwidth tests are performed for each combination of workgroup size and access pattern
+		// and their load is adjusted by the number of workgroups;
+		// latency tests use single workgroup for each access pattern
+		// and their load is adjusted by the number of iterations
+		struct Test {
+			uint32_t workgroupSize;
+			size_t accessPatternIndex;
+			bool latencyTest;
+			vk::UniquePipeline pipeline;
+			size_t numWorkgroups = 1;
+			size_t numIterations = 1;
+			float lastTime;
+			vector<float> resultList;
+		};
+		vector<Test> testList;
+		testList.reserve((workgroupSizeList.size() + 1) * accessPatternList.size());
+
+		// create pipelines
+		auto createPipeline =
+			[&](uint32_t workgroupSize, uint32_t stride) -> vk::UniquePipeline
+			{
+				struct SpecializationData {
+					uint32_t workgroupSize;
+					uint32_t stride;
+				} specializationData = { workgroupSize, stride };
+				array<vk::SpecializationMapEntry, 2> mapEntries = {
+					vk::SpecializationMapEntry{
+						.constantID = 0,
+						.offset = offsetof(SpecializationData, workgroupSize),
+						.size = sizeof(uint32_t),
+					},
+					vk::SpecializationMapEntry{
+						.constantID = 1,
+						.offset = offsetof(SpecializationData, stride),
+						.size = sizeof(uint32_t),
+					},
+				};
+				return
+					vk::createComputePipelineUnique(
+						nullptr,
+						vk::ComputePipelineCreateInfo{
+							.flags = {},
+							.stage =
+								vk::PipelineShaderStageCreateInfo{
+									.flags = {},
+									.stage = vk::ShaderStageFlagBits::eCompute,
+									.module = shaderModule,
+									.pName = "main",
+									.pSpecializationInfo =
+										&(const vk::SpecializationInfo&)vk::SpecializationInfo{
+											.mapEntryCount = uint32_t(mapEntries.size()),
+											.pMapEntries = mapEntries.data(),
+											.dataSize = sizeof(SpecializationData),
+											.pData = &specializationData,
+										},
+								},
+							.layout = pipelineLayout,
+							.basePipelineHandle = nullptr,
+							.basePipelineIndex = -1,
+						}
+					);
+			};
+		cout << "Creating pipelines..." << flush;
+		chrono::time_point creationStart = chrono::high_resolution_clock::now();
+		for(uint32_t workgroupSize : workgroupSizeList)
+			for(size_t i=0; i<accessPatternList.size(); i++)
+				testList.emplace_back(workgroupSize, i, false, createPipeline(workgroupSize, get<0>(accessPatternList[i])));
+		for(size_t i=0; i<accessPatternList.size(); i++)
+			testList.emplace_back(latencyWorkgroupSize, i, true, createPipeline(latencyWorkgroupSize, get<0>(accessPatternList[i])));
+		chrono::time_point creationEnd = chrono::high_resolution_clock::now();
+		cout << " done.\n   " << testList.size() << " pipelines were created in "
+		     << chrono::duration<float>(creationEnd - creationStart).count() * 1e3 << "ms." << endl;
+
+		// timestamp pool
+		vk::UniqueQueryPool timestampPool =
+			vk::createQueryPoolUnique(
+				vk::QueryPoolCreateInfo{
+					.flags = {},
+					.queryType = vk::QueryType::eTimestamp,
+					.queryCount = 2,
+					.pipelineStatistics = {},
+				}
+			);
+
+		// command pool
+		vk::UniqueCommandPool commandPool =
+			vk::createCommandPoolUnique(
+				vk::CommandPoolCreateInfo{
+					.flags = vk::CommandPoolCreateFlagBits::eTransient |
+					         vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+					.queueFamilyIndex = queueFamily,
+				}
+			);
+
+		// allocate command buffer
+		vk::CommandBuffer commandBuffer =
+			vk::allocateCommandBuffer(
+				vk::CommandBufferAllocateInfo{
+					.commandPool = commandPool,
+					.level = vk::CommandBufferLevel::ePrimary,
+					.commandBufferCount = 1,
+				}
+			);
+
+		// fence
+		vk::UniqueFence computingFinishedFence =
+			vk::createFenceUnique(
+				vk::FenceCreateInfo{
+					.flags = {}
+				}
+			);
+
+		auto performTest =
+			[&](vk::Pipeline pipeline, size_t numWorkgroups, uint32_t numIterations) -> float {
+
+				// begin command buffer
+				vk::beginCommandBuffer(
+					commandBuffer,
+					vk::CommandBufferBeginInfo{
+						.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+						.pInheritanceInfo = nullptr,
+					}
+				);
+
+				// reset timestamp pool
+				vk::cmdResetQueryPool(
+					commandBuffer,
+					timestampPool,
+					0,  // firstQuery
+					2);  // queryCount
+
+				// bind pipeline
+				vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eCompute, pipeline);
+
+				// set push constants
+				array<uint32_t, 2> pushConstants = { numIterations, 0 };
+				vk::cmdPushConstants(
+					commandBuffer,
+					pipelineLayout,
+					vk::ShaderStageFlagBits::eCompute,
+					0,  // offset
+					sizeof(pushConstants),  // size
+					pushConstants.data()  // pValues
+				);
+
+				// write timestamp 0
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eTopOfPipe,
+					timestampPool,
+					0);  // query
+
+				// dispatch computation
+				// (avoid any dimension to go over 10000)
+				uint32_t workgroupCountX;
+				uint32_t workgroupCountY;
+				uint32_t workgroupCountZ;
+				if(numWorkgroups > 10000 * 10000) {
+					workgroupCountZ = 1 + ((numWorkgroups - 1) / (10000 * 10000));
+					uint64_t remainder = numWorkgroups / workgroupCountZ;
+					workgroupCountY = 1 + ((remainder - 1) / 10000);
+					workgroupCountX = remainder / workgroupCountY;
+				}
+				else {
+					if(numWorkgroups == 0)
+						numWorkgroups = 1;
+					workgroupCountZ = 1;
+					workgroupCountY = 1 + ((numWorkgroups - 1) / 10000);
+					workgroupCountX = numWorkgroups / workgroupCountY;
+				}
+				vk::cmdDispatch(commandBuffer, workgroupCountX, workgroupCountY, workgroupCountZ);
+
+				// write timestamp 1
+				vk::cmdWriteTimestamp(
+					commandBuffer,
+					vk::PipelineStageFlagBits::eBottomOfPipe,
+					timestampPool,
+					1);  // query
+
+				// end command buffer
+				vk::endCommandBuffer(commandBuffer);
+
+
+				// submit work
+				vk::queueSubmit(
+					queue,
+					vk::SubmitInfo{
+						.waitSemaphoreCount = 0,
+						.pWaitSemaphores = nullptr,
+						.pWaitDstStageMask = nullptr,
+						.commandBufferCount = 1,
+						.pCommandBuffers = &commandBuffer,
+						.signalSemaphoreCount = 0,
+						.pSignalSemaphores = nullptr,
+					},
+					computingFinishedFence
+				);
+
+				// wait for the work
+				vk::Result r =
+					vk::waitForFence_noThrow(
+						computingFinishedFence,
+						uint64_t(1.5e9)  // timeout (1.5 seconds)
+					);
+				if(r == vk::Result::eTimeout) {
+					cout << "Vulkan device timeout. Task is probably hanging." << endl;
+					// use std::quick_exit() to terminate the application
+					// (Do not throw, do not return, do not call std::exit().
+					// The device is still busy and it uses number of handles such as
+					// computingFinishedFence and device handle itself.
+					// Destruction of the handles in use or the unallowed access to them
+					// is forbidden by Vulkan specification.
+					quick_exit(-1);
+				} else
+					vk::checkForSuccessValue(r, "vkWaitForFences");
+
+				// reset fence
+				vk::resetFence(computingFinishedFence);
+
+				// read timestamps
+				array<uint64_t, 2> timestamps;
+				vk::getQueryPoolResults(
+					timestampPool,  // queryPool
+					0,  // firstQuery
+					2,  // queryCount
+					2 * sizeof(uint64_t),  // dataSize
+					timestamps.data(),  // pData
+					sizeof(uint64_t),  // stride
+					vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait  // flags
+				);
+
+				// return time as float in seconds
+				return float((timestamps[1] - timestamps[0]) & timestampValidBitMask) * timestampPeriod / 1e9;
+
+			};
+
+		// record the result;
+		// bandwidth tests record bytes per second summed over all invocations,
+		// latency tests record time of a single load
+		auto processResult =
+			[](const Test& t, float time, vector<float>& resultList) {
+				if(time >= minTimeOfValidMeasurement) {
+					if(t.latencyTest)
+						resultList.push_back(time / (double(t.numIterations) * loadsPerIteration));
+					else {
+						uint64_t numLoads = uint64_t(bandwidthNumIterations) * loadsPerIteration * t.workgroupSize * t.numWorkgroups;
+						resultList.push_back(float(numLoads * sizeof(uint32_t)) / time);
+					}
+				}
+			};
+
+		// compute the load of the next iteration
+		// (number of workgroups or number of iterations)
+		// to eventually reach singleMeasurementTargetTime
+		auto computeLoad =
+			[](size_t lastLoad, float lastTime, size_t maxLoad) -> size_t
+			{
+				if(lastTime < (singleMeasurementTargetTime / maxNumWorkgroupsMultiplier)) {
+					// multiply load by maxNumWorkgroupsMultiplier
+					return min(size_t(lastLoad * maxNumWorkgroupsMultiplier), maxLoad);
+				}
+				else {
+					// multiply load by ratio
+					float ratio = singleMeasurementTargetTime / lastTime;
+					size_t newLoad = size_t(lastLoad * ratio);
+					return clamp(newLoad, size_t(1), maxLoad);
+				}
+			};
+
+		cout << "Running tests..." << endl;
+		chrono::time_point startTime = chrono::high_resolution_clock::now();
+		do {
+
+			// perform tests
+			for(Test& t : testList) {
+				if(t.latencyTest)
+					t.lastTime = performTest(t.pipeline, 1, uint32_t(t.numIterations));
+				else
+					t.lastTime = performTest(t.pipeline, t.numWorkgroups, bandwidthNumIterations);
+				processResult(t, t.lastTime, t.resultList);
+			}
+
+			// stop measurements after totalMeasuringTime passed
+			float totalTime = chrono::duration<float>(chrono::high_resolution_clock::now() - startTime).count();
+			if(totalTime >= totalMeasuringTime)
+				break;
+
+			// compute new load
+			for(Test& t : testList)
+				if(t.latencyTest)
+					t.numIterations = computeLoad(t.numIterations, t.lastTime, 0xffffffff);
+				else
+					t.numWorkgroups = computeLoad(t.numWorkgroups, t.lastTime, ~size_t(0));
+
+		} while(true);
+
+		// sort the results
+		for(Test& t : testList)
+			sort(t.resultList.begin(), t.resultList.end());
+
+		// print results
+		auto printResult =
+			[](const string_view text, const vector<float>& resultList, const char* unit) {
+				cout << text;
+				if(resultList.empty())
+					cout << "measurement error" << endl;
+				else {
+
+					// print median
+					cout << formatFloatSI(resultList[resultList.size()/2]) << unit;
+
+					// print dispersion using IQR (Interquartile Range);
+					// Q1 is the value in 25% and Q3 in 75%
+					cout << "  (Q1: " << formatFloatSI(resultList[resultList.size()/4]) << unit << ","
+					        " Q3: " << formatFloatSI(resultList[(resultList.size()*3)/4]) << unit << ","
+					        " num measurements: " << resultList.size() << ")";
+					cout << endl;
+				}
+			};
+		cout << "Shared memory bandwidth\n"
+		        "(bytes per second summed over all shader invocations):" << endl;
+		uint32_t lastWorkgroupSize = 0;
+		for(const Test& t : testList) {
+			if(t.latencyTest)
+				continue;
+			if(t.workgroupSize != lastWorkgroupSize) {
+				lastWorkgroupSize = t.workgroupSize;
+				cout << "Workgroup size " << t.workgroupSize << ":" << endl;
+			}
+			printResult(string("   ") + get<1>(accessPatternList[t.accessPatternIndex]), t.resultList, "B/s");
+		}
+		cout << "Shared memory latency\n"
+		        "(time of one dependent load, single workgroup of " << latencyWorkgroupSize << " invocations):" << endl;
+		for(const Test& t : testList)
+			if(t.latencyTest)
+				printResult(string("   ") + get<1>(accessPatternList[t.accessPatternIndex]), t.resultList, "s");
+
+	// catch exceptions
+	} catch(vk::Error& e) {
+		cout << e.what() << endl;
+	} catch(exception& e) {
+		cout << "Failed because of exception: " << e.what() << endl;
+	} catch(...) {
+		cout << "Failed because of unspecified exception." << endl;
+	}
+
+	vk::cleanUp();
+	return 0;
+}
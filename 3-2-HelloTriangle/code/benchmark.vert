@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2022-2026 PCJohn (Jan Pečiva, peciva@fit.vut.cz)
+//
+// SPDX-License-Identifier: MIT-0
+
+#version 450
+
+layout(location = 0) in vec2 inPosition;    // vertex position inside the mesh tile, in range 0..1
+layout(location = 1) in vec2 inTileOffset;  // per-instance position of the tile inside the window, in range 0..1
+
+layout(push_constant) uniform PushConstants {
+	vec2 tileSize;  // size of the mesh tile in normalized device coordinates
+	vec2 freeSize;  // window size minus tile size in normalized device coordinates
+};
+
+out gl_PerVertex {
+	vec4 gl_Position;
+};
+
+layout(location = 0) out vec3 outColor;
+
+
+void main()
+{
+	gl_Position = vec4(vec2(-1.0) + inTileOffset * freeSize + inPosition * tileSize, 0.0, 1.0);
+
+	// different color for each instance
+	uint h = uint(gl_InstanceIndex) * 2654435761u;
+	outColor = vec3((h >> 8) & 255u, (h >> 16) & 255u, (h >> 24) & 255u) / 255.0;
+}
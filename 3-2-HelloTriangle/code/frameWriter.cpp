@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: 2022-2026 PCJohn (Jan Pečiva, peciva@fit.vut.cz)
+//
+// SPDX-License-Identifier: MIT-0
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include "frameWriter.h"
+
+using namespace std;
+
+
+FrameWriter::FrameWriter(const string& fileName, FileFormat format, bool bgra, unsigned numSlots)
+	: _format(format)
+	, _bgra(bgra)
+	, _slotBusy(numSlots, false)
+{
+	// open file
+	// (write errors are reported by exceptions in the writer thread)
+	_file.open(fileName, ios::out | ios::binary | ios::trunc);
+	if(!_file)
+		throw runtime_error("Cannot open file \"" + fileName + "\" for writing.");
+	_file.exceptions(ios::failbit | ios::badbit);
+
+	// writer thread
+	_thread = thread(&FrameWriter::writerMain, this);
+}
+
+
+FrameWriter::~FrameWriter()
+{
+	{
+		lock_guard lock(_mutex);
+		_quit = true;
+	}
+	_workCondition.notify_all();
+	if(_thread.joinable())
+		_thread.join();
+}
+
+
+void FrameWriter::write(unsigned slot, const void* data, uint32_t width, uint32_t height)
+{
+	{
+		lock_guard lock(_mutex);
+		if(_exception)
+			rethrow_exception(_exception);
+		_slotBusy[slot] = true;
+		_jobList.push_back(Job{ slot, static_cast<const uint8_t*>(data), width, height });
+	}
+	_workCondition.notify_one();
+}
+
+
+bool FrameWriter::waitForSlot(unsigned slot)
+{
+	unique_lock lock(_mutex);
+	bool stalled = _slotBusy[slot];
+	_doneCondition.wait(lock, [this, slot]() { return !_slotBusy[slot]; });
+	if(_exception)
+		rethrow_exception(_exception);
+	return stalled;
+}
+
+
+void FrameWriter::finish()
+{
+	unique_lock lock(_mutex);
+	_doneCondition.wait(lock, [this]() { return _jobList.empty(); });
+	if(_exception)
+		rethrow_exception(_exception);
+}
+
+
+void FrameWriter::writeFrame(const Job& job)
+{
+	size_t numPixels = size_t(job.width) * job.height;
+
+	// PPM header
+	if(_format == FileFormat::ePpm) {
+		string header = "P6\n" + to_string(job.width) + " " + to_string(job.height) + "\n255\n";
+		_file.write(header.data(), header.size());
+		_numBytesWritten += header.size();
+	}
+
+	// raw RGBA data are written directly from the slot
+	if(_format == FileFormat::eRaw && !_bgra) {
+		_file.write(reinterpret_cast<const char*>(job.data), numPixels * 4);
+		_numBytesWritten += numPixels * 4;
+		_numFramesWritten++;
+		return;
+	}
+
+	// convert to RGB (PPM) or to RGBA (raw)
+	size_t bytesPerPixel = (_format == FileFormat::ePpm) ? 3 : 4;
+	_frameBuffer.resize(numPixels * bytesPerPixel);
+	const uint8_t* src = job.data;
+	uint8_t* dst = _frameBuffer.data();
+	size_t r = _bgra ? 2 : 0;
+	size_t b = _bgra ? 0 : 2;
+	for(size_t i=0; i<numPixels; i++, src+=4, dst+=bytesPerPixel) {
+		dst[0] = src[r];
+		dst[1] = src[1];
+		dst[2] = src[b];
+		if(bytesPerPixel == 4)
+			dst[3] = src[3];
+	}
+	_file.write(reinterpret_cast<const char*>(_frameBuffer.data()), _frameBuffer.size());
+	_numBytesWritten += _frameBuffer.size();
+	_numFramesWritten++;
+}
+
+
+void FrameWriter::writerMain()
+{
+	while(true) {
+
+		// wait for work
+		// (on quit, all queued frames are written before the thread ends)
+		Job job;
+		{
+			unique_lock lock(_mutex);
+			_workCondition.wait(lock, [this]() { return _quit || !_jobList.empty(); });
+			if(_jobList.empty())
+				return;
+			job = _jobList.front();
+		}
+
+		// write frame
+		// (on error, the exception is handed over to the caller of the next function and the writer stops)
+		try {
+			writeFrame(job);
+		} catch(...) {
+			{
+				lock_guard lock(_mutex);
+				_exception = current_exception();
+				_jobList.clear();
+				_slotBusy.assign(_slotBusy.size(), false);
+			}
+			_doneCondition.notify_all();
+			return;
+		}
+
+		// free the slot
+		{
+			lock_guard lock(_mutex);
+			_jobList.pop_front();
+			_slotBusy[job.slot] = false;
+		}
+		_doneCondition.notify_all();
+	}
+}
+
+
+FrameWriter::FileFormat FrameWriter::fileFormatFromName(const string& fileName)
+{
+	// .ppm extension selects PPM format, anything else raw format
+	if(fileName.size() < 4)
+		return FileFormat::eRaw;
+	string ext = fileName.substr(fileName.size() - 4);
+	transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return char(tolower(c)); });
+	return (ext == ".ppm") ? FileFormat::ePpm : FileFormat::eRaw;
+}
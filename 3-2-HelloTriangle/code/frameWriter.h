@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2022-2026 PCJohn (Jan Pečiva, peciva@fit.vut.cz)
+//
+// SPDX-License-Identifier: MIT-0
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// Background writer of the frame sequence.
+//
+// Frames are passed by write() as pointers into the slots of the readback ring
+// and they are written to the file by the writer thread, so the rendering
+// never waits for the disk. The slot is busy until its frame is written
+// and the caller must not overwrite its data before waitForSlot() returns.
+//
+// Raw format is the sequence of RGBA frames of 4 bytes per pixel without any header.
+// PPM format is the sequence of binary PPM images (P6), that can be read,
+// for example, by ffmpeg -f image2pipe.
+class FrameWriter {
+public:
+	enum class FileFormat { eRaw, ePpm };
+
+protected:
+	struct Job {
+		unsigned slot;
+		const uint8_t* data;
+		uint32_t width;
+		uint32_t height;
+	};
+	std::ofstream _file;
+	FileFormat _format;
+	bool _bgra;  // source data are in BGRA byte order
+	std::vector<uint8_t> _frameBuffer;  // converted frame
+
+	std::thread _thread;
+	std::mutex _mutex;
+	std::condition_variable _workCondition;
+	std::condition_variable _doneCondition;
+	std::deque<Job> _jobList;
+	std::vector<bool> _slotBusy;
+	std::exception_ptr _exception;
+	bool _quit = false;
+	std::atomic<uint64_t> _numFramesWritten = 0;
+	std::atomic<uint64_t> _numBytesWritten = 0;
+
+	void writeFrame(const Job& job);
+	void writerMain();
+
+public:
+
+	FrameWriter(const std::string& fileName, FileFormat format, bool bgra, unsigned numSlots);
+	~FrameWriter();  // writes all queued frames before return
+
+	// queue the frame for writing; data must stay valid until the slot is free again
+	void write(unsigned slot, const void* data, uint32_t width, uint32_t height);
+
+	// wait until the slot is free; returns true if the caller had to wait for the writer
+	bool waitForSlot(unsigned slot);
+
+	// wait until all queued frames are written
+	void finish();
+
+	uint64_t numFramesWritten() const  { return _numFramesWritten; }
+	uint64_t numBytesWritten() const  { return _numBytesWritten; }
+
+	static FileFormat fileFormatFromName(const std::string& fileName);
+
+};
@@ -3,9 +3,16 @@
 // SPDX-License-Identifier: MIT-0
 
 #include "VulkanWindow.h"
+#include "frameWriter.h"
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <random>
 #include "vkg.hpp"
 
 using namespace std;
@@ -13,6 +20,21 @@ using namespace std;
 
 // constants
 constexpr const char* appName = "HelloTriangle";
+constexpr const size_t frameStatisticsInterval = 100;  // number of frames over which the rolling average of frame statistics is computed and printed
+constexpr const size_t frameTimeHistorySize = 10000;  // number of the most recent frames kept for the GPU frame time statistics printed on exit
+constexpr const size_t asyncComputeModeInterval = 100;  // number of frames after which async compute is switched between overlapped and not overlapped mode
+constexpr const uint32_t computeWorkgroupCountX = 100;  // size of async compute dispatch
+constexpr const uint32_t computeWorkgroupCountY = 100;
+constexpr const uint64_t computeNumInstructions = uint64_t(20000) * 128 * computeWorkgroupCountX * computeWorkgroupCountY;  // FMA counts as two instructions
+constexpr const size_t geometryBenchmarkInterval = 100;  // number of frames rendered with each triangle size in geometry benchmark
+constexpr const uint32_t benchmarkGridSize = 16;  // benchmark mesh tile is the grid of benchmarkGridSize x benchmarkGridSize quads
+constexpr const uint32_t benchmarkTrianglesPerInstance = 2 * benchmarkGridSize * benchmarkGridSize;
+constexpr const uint32_t benchmarkVerticesPerInstance = (benchmarkGridSize + 1) * (benchmarkGridSize + 1);
+constexpr const uint32_t benchmarkMaxInstances = 4096;  // up to 2M triangles per frame
+constexpr const uint64_t benchmarkPixelBudget = uint64_t(128) << 20;  // limit of rasterized pixels per frame (it reduces instance count of big triangles)
+constexpr const uint32_t benchmarkNumIndirectDraws = 16;  // number of draws in each cmdDrawIndexedIndirect batch
+constexpr const array<float, 6> benchmarkTriangleAreas = { 1.f, 4.f, 16.f, 64.f, 256.f, 1024.f };  // triangle sizes in pixels
+constexpr const unsigned readbackRingSize = 4;  // number of frames in readback ring (the writer thread may lag behind the rendering by this number of frames)
 
 
 // shader code in SPIR-V binary
@@ -22,6 +44,33 @@ static const uint32_t vsSpirv[] = {
 static const uint32_t fsSpirv[] = {
 #include "shader.frag.spv"
 };
+static const uint32_t computeSpirv[] = {
+#include "performance.comp.spv"
+};
+static const uint32_t benchmarkVsSpirv[] = {
+#include "benchmark.vert.spv"
+};
+
+
+// size of the geometry benchmark mesh tile in pixels
+// (each quad of the grid is made of two right triangles of the given area)
+static float benchmarkTileSize(size_t level)
+{
+	return float(benchmarkGridSize) * sqrt(2.f * benchmarkTriangleAreas[level]);
+}
+
+
+// index of the memory type with requiredFlags allowed by memoryRequirements
+// (~uint32_t(0) is returned if there is no such memory type)
+static uint32_t findMemoryType(const vk::MemoryRequirements& memoryRequirements, vk::MemoryPropertyFlags requiredFlags)
+{
+	vk::PhysicalDeviceMemoryProperties memoryProperties = vk::getPhysicalDeviceMemoryProperties();
+	for(uint32_t i=0; i<memoryProperties.memoryTypeCount; i++)
+		if((memoryRequirements.memoryTypeBits & (1 << i)) &&
+		   (memoryProperties.memoryTypes[i].propertyFlags & requiredFlags) == requiredFlags)
+			return i;
+	return ~uint32_t(0);
+}
 
 
 // global application data
@@ -34,6 +83,21 @@ public:
 	void init();
 	void resize(VulkanWindow& window, uint32_t& widthToBeSet, uint32_t& heightToBeSet);
 	void frame(VulkanWindow& window);
+	void readFrameStatistics();
+	void printFrameStatistics();
+	void recordComputeWork(vk::CommandBuffer cb);
+	void readComputeStatistics();
+	void printComputeStatistics();
+	void createDeviceLocalBuffer(vk::UniqueBuffer& buffer, vk::UniqueDeviceMemory& memory,
+		vk::BufferUsageFlags usage, const void* data, size_t size);
+	void printBenchmarkResult(size_t level, float frameTime);
+	void printBenchmarkStatistics();
+	void handOverReadback();
+	void printOffscreenStatistics();
+	void finishOffscreen();
+
+	// usage was printed because of unknown argument and the application should exit
+	bool helpPrinted = false;
 
 	// Vulkan device, instance and library release object
 	// (they need to be released as the last one)
@@ -66,12 +130,144 @@ public:
 	vk::UniquePipelineLayout pipelineLayout;
 	vk::UniquePipeline pipeline;
 
+	// GPU frame statistics
+	// (they are collected only when requested on the command line)
+	bool frameStatisticsRequested = false;
+	bool pipelineStatisticsSupported = false;
+	bool timestampSupported = false;
+	bool frameQueriesPending = false;
+	uint64_t timestampValidBitMask;
+	float timestampPeriod;
+	vk::UniqueQueryPool pipelineStatisticsPool;
+	vk::UniqueQueryPool timestampPool;
+	deque<float> gpuFrameTimeList;  // GPU times of the last frameTimeHistorySize frames
+	array<uint64_t, 3> pipelineStatisticsSum = {};  // vertex invocations, clipping primitives, fragment invocations
+	size_t numStatisticsFrames = 0;
+
+	// async compute
+	// (FMA workload is dispatched each frame when requested on the command line;
+	// it alternates between running on the graphics queue before the rendering (no overlap)
+	// and running on the separate compute queue concurrently with the rendering (overlap))
+	bool asyncComputeRequested = false;
+	bool computeOverlapSupported = false;  // separate compute queue is available
+	uint32_t computeQueueFamily;
+	uint32_t computeQueueIndex;
+	vk::Queue computeQueue;
+	vk::UniqueCommandPool computeCommandPool;
+	vk::CommandBuffer computeCommandBuffer;
+	vk::UniqueShaderModule computeModule;
+	vk::UniquePipelineLayout computePipelineLayout;
+	vk::UniquePipeline computePipeline;
+	vk::UniqueSemaphore computeFinishedSemaphore;  // hands compute results over to the next frame rendering
+	vk::UniqueFence computeFinishedFence;
+	vk::UniqueQueryPool computeTimestampPool;
+	uint64_t computeTimestampValidBitMask;
+	bool computeSemaphorePending = false;
+	bool computeFencePending = false;
+	bool computeQueriesPending = false;
+	bool computeOverlap = false;  // mode of the current frame
+	bool previousComputeOverlap = false;  // mode of the previous frame, e.g. of pending queries
+	size_t numComputeFrames = 0;
+	struct ComputeModeStatistics {
+		vector<float> frameTimeList;    // GPU frame time on the graphics queue
+		vector<float> computeTimeList;  // GPU time of the compute dispatch
+		float cpuTime = 0.f;            // sum of CPU frame intervals
+		size_t numCpuFrames = 0;
+	};
+	array<ComputeModeStatistics, 2> computeStatistics;  // index 0 - no overlap, index 1 - overlap
+	chrono::high_resolution_clock::time_point lastFrameTime;
+
+	// geometry benchmark
+	// (instanced mesh tiles made of many small triangles are drawn instead of the single triangle
+	// when requested on the command line; triangle size changes after each geometryBenchmarkInterval frames)
+	bool geometryBenchmarkRequested = false;
+	bool indirectDrawRequested = false;
+	bool multiDrawIndirectSupported = false;
+	vk::UniqueShaderModule benchmarkVsModule;
+	vk::UniquePipelineLayout benchmarkPipelineLayout;
+	vk::UniquePipeline benchmarkPipeline;
+	vk::UniqueBuffer vertexBuffer;
+	vk::UniqueDeviceMemory vertexMemory;
+	vk::UniqueBuffer instanceBuffer;
+	vk::UniqueDeviceMemory instanceMemory;
+	vk::UniqueBuffer indexBuffer;
+	vk::UniqueDeviceMemory indexMemory;
+	vk::UniqueBuffer indirectBuffer;
+	vk::UniqueDeviceMemory indirectMemory;
+	array<uint32_t, benchmarkTriangleAreas.size()> benchmarkNumInstances;
+	size_t numBenchmarkFrames = 0;
+	size_t benchmarkLevel = 0;  // index to benchmarkTriangleAreas of the current frame (of the previous frame while reading its queries)
+	array<vector<float>, benchmarkTriangleAreas.size()> benchmarkFrameTimeList;
+
+	// offscreen rendering
+	// (when requested on the command line, frames are rendered into the offscreen image instead of the swapchain,
+	// copied into the persistently mapped readback ring and written to the file by the writer thread)
+	bool offscreenRequested = false;
+	string offscreenFileName;
+	vk::DeviceSize nonCoherentAtomSize;
+	vk::UniqueRenderPass offscreenRenderPass;
+	vk::UniqueImage offscreenImage;
+	vk::UniqueDeviceMemory offscreenImageMemory;
+	vk::UniqueImageView offscreenImageView;
+	vk::UniqueFramebuffer offscreenFramebuffer;
+	vk::Extent2D offscreenExtent;
+	vk::UniqueBuffer readbackBuffer;
+	vk::UniqueDeviceMemory readbackMemory;
+	uint8_t* readbackData = nullptr;  // persistently mapped readbackMemory
+	bool readbackCoherent;
+	vk::DeviceSize readbackSlotSize;
+	unique_ptr<FrameWriter> frameWriter;  // it reads readbackData, so it must be destroyed before readbackMemory
+	bool readbackPending = false;  // readback of the previous frame was not handed over to the writer yet
+	size_t numOffscreenFrames = 0;
+	uint64_t numReadbackBytes = 0;
+	size_t numWriterStalls = 0;  // number of frames that waited for the writer thread to free the slot
+	float writerStallTime = 0.f;
+	chrono::high_resolution_clock::time_point offscreenStartTime;
+
 };
 
 
 /// Construct application object
 App::App(int argc, char** argv)
 {
+	// parse command-line arguments
+	for(int i=1; i<argc; i++) {
+		if(strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--statistics") == 0)
+			frameStatisticsRequested = true;
+		else if(strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--async-compute") == 0)
+			asyncComputeRequested = true;
+		else if(strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "--geometry-benchmark") == 0)
+			geometryBenchmarkRequested = true;
+		else if(strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--indirect") == 0) {
+			geometryBenchmarkRequested = true;
+			indirectDrawRequested = true;
+		}
+		else if((strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--offscreen") == 0) && i+1 < argc) {
+			offscreenRequested = true;
+			offscreenFileName = argv[++i];
+		}
+		else {
+			cout << "Unknown argument: " << argv[i] << "\n"
+			        "Usage: " << appName << " [-s] [-c] [-g] [-i] [-o file]\n"
+			        "   -s or --statistics - collects GPU frame time and pipeline statistics\n"
+			        "      and prints them periodically and on exit\n"
+			        "   -c or --async-compute - dispatches FMA workload each frame, alternately\n"
+			        "      on the graphics queue and on the separate compute queue concurrently\n"
+			        "      with the rendering, and prints frame time and compute throughput\n"
+			        "      of both modes on exit\n"
+			        "   -g or --geometry-benchmark - draws millions of triangles of different sizes\n"
+			        "      from device-local vertex and index buffers using instancing, and prints\n"
+			        "      triangles/s, vertices/s and pixels/s for each triangle size\n"
+			        "   -i or --indirect - geometry benchmark draws by cmdDrawIndexedIndirect\n"
+			        "      batches instead of a single instanced draw (implies -g)\n"
+			        "   -o or --offscreen <file> - renders into offscreen image instead of the window\n"
+			        "      and streams the frames into the file from the background thread; file with\n"
+			        "      .ppm extension receives PPM image sequence, any other file raw RGBA frames;\n"
+			        "      sustained frames/s and readback bandwidth are printed periodically and on exit" << endl;
+			helpPrinted = true;
+			return;
+		}
+	}
 }
 
 
@@ -108,7 +304,7 @@ void App::init()
 					.applicationVersion = 0,
 					.pEngineName = nullptr,
 					.engineVersion = 0,
-					.apiVersion = vk::ApiVersion10,  // highest api version used by the application
+					.apiVersion = vk::ApiVersion12,  // highest api version used by the application
 				},
 			.enabledLayerCount = 0,
 			.ppEnabledLayerNames = nullptr,
@@ -124,7 +320,8 @@ void App::init()
 	// get compatible and incompatible devices
 	//
 	// required functionality: VK_KHR_swapchain, queue presentation support, graphics queue
-	// optional functionality: < none >
+	// optional functionality: pipelineStatisticsQuery, timestamp support,
+	//                         Vulkan 1.2, shaderInt64, bufferDeviceAddress and compute queue for async compute
 	vk::vector<vk::PhysicalDevice> deviceList = vk::enumeratePhysicalDevices();
 	vector<tuple<vk::PhysicalDevice, uint32_t, uint32_t, vk::PhysicalDeviceProperties>> compatibleDevices;
 	vector<tuple<string,string>> incompatibleDevices;
@@ -230,41 +427,178 @@ void App::init()
 	vk::PhysicalDevice physicalDevice = get<0>(*bestDevice);
 	graphicsQueueFamily = get<1>(*bestDevice);
 	presentationQueueFamily = get<2>(*bestDevice);
+	nonCoherentAtomSize = get<3>(*bestDevice).limits.nonCoherentAtomSize;
+
+	// geometry benchmark support
+	// (GPU time of the frames is measured by timestamps on the graphics queue;
+	// async compute would distort the measured times, so the two modes are exclusive)
+	if(geometryBenchmarkRequested) {
+		if(asyncComputeRequested) {
+			cout << "Geometry benchmark cannot be combined with async compute. Async compute disabled." << endl;
+			asyncComputeRequested = false;
+		}
+		uint32_t timestampValidBits =
+			vk::getPhysicalDeviceQueueFamilyProperties(physicalDevice)[graphicsQueueFamily].timestampValidBits;
+		if(timestampValidBits != 0) {
+			timestampSupported = true;
+			timestampValidBitMask = (timestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << timestampValidBits) - 1;
+			timestampPeriod = get<3>(*bestDevice).limits.timestampPeriod;
+		}
+		else {
+			cout << "Geometry benchmark requires timestamps on the graphics queue." << endl;
+			geometryBenchmarkRequested = false;
+			indirectDrawRequested = false;
+		}
+	}
+	if(indirectDrawRequested) {
+
+		// non-zero firstInstance is required by the batches; multiDrawIndirect is optional
+		vk::PhysicalDeviceFeatures features = vk::getPhysicalDeviceFeatures(physicalDevice);
+		if(!features.drawIndirectFirstInstance) {
+			cout << "Indirect draws require drawIndirectFirstInstance feature. Direct draws will be used." << endl;
+			indirectDrawRequested = false;
+		}
+		else {
+			multiDrawIndirectSupported = features.multiDrawIndirect;
+			if(!multiDrawIndirectSupported)
+				cout << "multiDrawIndirect is not supported. Each indirect draw will be recorded by separate command." << endl;
+		}
+	}
+
+	// async compute support
+	if(asyncComputeRequested) {
+
+		// Vulkan 1.2, shaderInt64 and bufferDeviceAddress are required by the FMA shader
+		vk::PhysicalDeviceVulkan12Features features12{};
+		vk::PhysicalDeviceFeatures2 features10{ .pNext = &features12 };
+		if(get<3>(*bestDevice).apiVersion >= vk::ApiVersion12)
+			vk::getPhysicalDeviceFeatures2(physicalDevice, features10);
+		if(!features10.features.shaderInt64 || !features12.bufferDeviceAddress) {
+			cout << "Async compute requires Vulkan 1.2, shaderInt64 and bufferDeviceAddress." << endl;
+			asyncComputeRequested = false;
+		}
+	}
+	if(asyncComputeRequested) {
+
+		// compute queue: prefer compute family without graphics,
+		// otherwise use the second queue of the graphics family
+		vk::vector<vk::QueueFamilyProperties> queueFamilyList = vk::getPhysicalDeviceQueueFamilyProperties(physicalDevice);
+		for(uint32_t i=0, c=uint32_t(queueFamilyList.size()); i<c; i++)
+			if((queueFamilyList[i].queueFlags & vk::QueueFlagBits::eCompute) &&
+			   !(queueFamilyList[i].queueFlags & vk::QueueFlagBits::eGraphics))
+			{
+				computeQueueFamily = i;
+				computeQueueIndex = (i == presentationQueueFamily) ? 1 : 0;
+				computeOverlapSupported = computeQueueIndex < queueFamilyList[i].queueCount;
+				if(computeOverlapSupported)
+					break;
+			}
+		if(!computeOverlapSupported && queueFamilyList[graphicsQueueFamily].queueCount >= 2) {
+			computeQueueFamily = graphicsQueueFamily;
+			computeQueueIndex = 1;
+			computeOverlapSupported = true;
+		}
+		if(!computeOverlapSupported) {
+			computeQueueFamily = graphicsQueueFamily;
+			computeQueueIndex = 0;
+			cout << "No separate compute queue. Async compute will run without overlap only." << endl;
+		}
+
+		// timestamps on graphics and compute queue
+		// (frame time is measured by timestamps on the graphics queue,
+		// compute time by timestamps on the queue executing the dispatch)
+		uint32_t timestampValidBits = queueFamilyList[graphicsQueueFamily].timestampValidBits;
+		uint32_t computeTimestampValidBits =
+			computeOverlapSupported ? queueFamilyList[computeQueueFamily].timestampValidBits : timestampValidBits;
+		timestampSupported = timestampValidBits != 0 && computeTimestampValidBits != 0;
+		timestampValidBitMask = (timestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << timestampValidBits) - 1;
+		computeTimestampValidBitMask =
+			(computeTimestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << computeTimestampValidBits) - 1;
+		timestampPeriod = get<3>(*bestDevice).limits.timestampPeriod;
+		if(!timestampSupported)
+			cout << "Timestamps are not supported by the graphics or compute queue. "
+			        "Frame time and compute throughput will not be measured." << endl;
+	}
+
+	// frame statistics support
+	if(frameStatisticsRequested) {
+		pipelineStatisticsSupported = vk::getPhysicalDeviceFeatures(physicalDevice).pipelineStatisticsQuery;
+		uint32_t timestampValidBits =
+			vk::getPhysicalDeviceQueueFamilyProperties(physicalDevice)[graphicsQueueFamily].timestampValidBits;
+		timestampSupported = timestampValidBits != 0 && (timestampSupported || !asyncComputeRequested);
+		timestampValidBitMask = (timestampValidBits >= 64) ? ~uint64_t(0) : (uint64_t(1) << timestampValidBits) - 1;
+		timestampPeriod = get<3>(*bestDevice).limits.timestampPeriod;
+		if(!pipelineStatisticsSupported)
+			cout << "Pipeline statistics queries are not supported by the device." << endl;
+		if(!timestampSupported)
+			cout << "Timestamps are not supported by the graphics queue." << endl;
+	}
+
+	// queue create infos
+	// (graphics, presentation and compute queue may share the family;
+	// compute queue may be the second queue of graphics or presentation family)
+	constexpr const array<float, 2> queuePriorities = { 1.f, 1.f };
+	vector<vk::DeviceQueueCreateInfo> queueCreateInfos;
+	auto addQueue =
+		[&queueCreateInfos, &queuePriorities](uint32_t queueFamily, uint32_t queueIndex) {
+			for(vk::DeviceQueueCreateInfo& info : queueCreateInfos)
+				if(info.queueFamilyIndex == queueFamily) {
+					info.queueCount = max(info.queueCount, queueIndex+1);
+					return;
+				}
+			queueCreateInfos.emplace_back(
+				vk::DeviceQueueCreateInfo{
+					.flags = vk::DeviceQueueCreateFlags(),
+					.queueFamilyIndex = queueFamily,
+					.queueCount = queueIndex + 1,
+					.pQueuePriorities = queuePriorities.data(),
+				}
+			);
+		};
+	addQueue(graphicsQueueFamily, 0);
+	addQueue(presentationQueueFamily, 0);
+	if(computeOverlapSupported)
+		addQueue(computeQueueFamily, computeQueueIndex);
+
+	// enabled features
+	vk::PhysicalDeviceVulkan12Features enabledFeatures12{
+		.bufferDeviceAddress = vk::True,
+	};
+	vk::PhysicalDeviceFeatures2 enabledFeatures{
+		.pNext = asyncComputeRequested ? &enabledFeatures12 : nullptr,
+		.features = {
+			.multiDrawIndirect = multiDrawIndirectSupported ? vk::True : vk::False,
+			.drawIndirectFirstInstance = indirectDrawRequested ? vk::True : vk::False,
+			.pipelineStatisticsQuery = pipelineStatisticsSupported ? vk::True : vk::False,
+			.shaderInt64 = asyncComputeRequested ? vk::True : vk::False,
+		},
+	};
 
 	// create device
 	vk::initDevice(
 		physicalDevice,  // physicalDevice
 		vk::DeviceCreateInfo{  // pCreateInfo
+			.pNext = &enabledFeatures,
 			.flags = {},
-			.queueCreateInfoCount =
-				graphicsQueueFamily==presentationQueueFamily ? uint32_t(1) : uint32_t(2),
-			.pQueueCreateInfos =
-				array{
-					vk::DeviceQueueCreateInfo{
-						.flags = vk::DeviceQueueCreateFlags(),
-						.queueFamilyIndex = graphicsQueueFamily,
-						.queueCount = 1,
-						.pQueuePriorities = &(const float&)1.f,
-					},
-					vk::DeviceQueueCreateInfo{
-						.flags = vk::DeviceQueueCreateFlags(),
-						.queueFamilyIndex = presentationQueueFamily,
-						.queueCount = 1,
-						.pQueuePriorities = &(const float&)1.f,
-					},
-				}.data(),
+			.queueCreateInfoCount = uint32_t(queueCreateInfos.size()),
+			.pQueueCreateInfos = queueCreateInfos.data(),
 			.enabledLayerCount = 0,  // no enabled layers
 			.ppEnabledLayerNames = nullptr,
 			.enabledExtensionCount = 1,  // number of enabled extensions
 			.ppEnabledExtensionNames =
 				array<const char*, 1>{ "VK_KHR_swapchain" }.data(),  // enabled extension names
-			.pEnabledFeatures = nullptr,  // enabled features
+			.pEnabledFeatures = nullptr,  // enabled features are passed in pNext chain
 		}
 	);
 
 	// get queues
 	graphicsQueue = vk::getDeviceQueue(graphicsQueueFamily, 0);
 	presentationQueue = vk::getDeviceQueue(presentationQueueFamily, 0);
+	if(asyncComputeRequested)
+		computeQueue =
+			computeOverlapSupported
+				? vk::getDeviceQueue(computeQueueFamily, computeQueueIndex)
+				: graphicsQueue;
 
 	// print surface formats
 	cout << "Surface formats:" << endl;
@@ -299,6 +633,25 @@ void App::init()
 	cout << "Using format:\n"
 	     << "   " << to_cstr(surfaceFormat.format) << ", color space: " << to_cstr(surfaceFormat.colorSpace) << endl;
 
+	// offscreen rendering support
+	// (offscreen image uses the surface format, so the pipelines are compatible with both render passes;
+	// the writer thread converts the pixels of the surface format into RGB or RGBA byte order)
+	if(offscreenRequested) {
+		bool bgra = surfaceFormat.format == vk::Format::eB8G8R8A8Srgb || surfaceFormat.format == vk::Format::eB8G8R8A8Unorm;
+		bool rgba = surfaceFormat.format == vk::Format::eR8G8B8A8Srgb || surfaceFormat.format == vk::Format::eR8G8B8A8Unorm ||
+			surfaceFormat.format == vk::Format::eA8B8G8R8SrgbPack32 || surfaceFormat.format == vk::Format::eA8B8G8R8UnormPack32;
+		if(bgra || rgba) {
+			FrameWriter::FileFormat fileFormat = FrameWriter::fileFormatFromName(offscreenFileName);
+			frameWriter = make_unique<FrameWriter>(offscreenFileName, fileFormat, bgra, readbackRingSize);
+			cout << "Writing offscreen frames into " << offscreenFileName
+			     << (fileFormat == FrameWriter::FileFormat::ePpm ? " (PPM sequence)" : " (raw RGBA frames)") << endl;
+		}
+		else {
+			cout << "Offscreen rendering does not support format " << to_cstr(surfaceFormat.format) << "." << endl;
+			offscreenRequested = false;
+		}
+	}
+
 	// render pass
 	renderPass =
 		vk::createRenderPassUnique(
@@ -353,6 +706,72 @@ void App::init()
 			}
 		);
 
+	// offscreen render pass
+	// (it differs from the render pass above by the final layout used by the readback copy
+	// and by the dependency that makes the copy wait for the rendering)
+	if(offscreenRequested)
+		offscreenRenderPass =
+			vk::createRenderPassUnique(
+				vk::RenderPassCreateInfo{
+					.flags = vk::RenderPassCreateFlags(),
+					.attachmentCount = 1,
+					.pAttachments = array{
+						vk::AttachmentDescription{
+							.flags = vk::AttachmentDescriptionFlags(),
+							.format = surfaceFormat.format,
+							.samples = vk::SampleCountFlagBits::e1,
+							.loadOp = vk::AttachmentLoadOp::eClear,
+							.storeOp = vk::AttachmentStoreOp::eStore,
+							.stencilLoadOp = vk::AttachmentLoadOp::eDontCare,
+							.stencilStoreOp = vk::AttachmentStoreOp::eDontCare,
+							.initialLayout = vk::ImageLayout::eUndefined,
+							.finalLayout = vk::ImageLayout::eTransferSrcOptimal,
+						},
+					}.data(),
+					.subpassCount = 1,
+					.pSubpasses = array{
+						vk::SubpassDescription{
+							.flags = vk::SubpassDescriptionFlags(),
+							.pipelineBindPoint = vk::PipelineBindPoint::eGraphics,
+							.inputAttachmentCount = 0,
+							.pInputAttachments = nullptr,
+							.colorAttachmentCount = 1,
+							.pColorAttachments = array{
+								vk::AttachmentReference{
+									.attachment = 0,
+									.layout = vk::ImageLayout::eColorAttachmentOptimal,
+								},
+							}.data(),
+							.pResolveAttachments = nullptr,
+							.pDepthStencilAttachment = nullptr,
+							.preserveAttachmentCount = 0,
+							.pPreserveAttachments = nullptr,
+						},
+					}.data(),
+					.dependencyCount = 2,
+					.pDependencies = array{
+						vk::SubpassDependency{
+							.srcSubpass = vk::SubpassExternal,
+							.dstSubpass = 0,
+							.srcStageMask = vk::PipelineStageFlags(vk::PipelineStageFlagBits::eColorAttachmentOutput | vk::PipelineStageFlagBits::eTransfer),
+							.dstStageMask = vk::PipelineStageFlags(vk::PipelineStageFlagBits::eColorAttachmentOutput),
+							.srcAccessMask = vk::AccessFlags(),
+							.dstAccessMask = vk::AccessFlags(vk::AccessFlagBits::eColorAttachmentWrite),
+							.dependencyFlags = vk::DependencyFlags(),
+						},
+						vk::SubpassDependency{
+							.srcSubpass = 0,
+							.dstSubpass = vk::SubpassExternal,
+							.srcStageMask = vk::PipelineStageFlags(vk::PipelineStageFlagBits::eColorAttachmentOutput),
+							.dstStageMask = vk::PipelineStageFlags(vk::PipelineStageFlagBits::eTransfer),
+							.srcAccessMask = vk::AccessFlags(vk::AccessFlagBits::eColorAttachmentWrite),
+							.dstAccessMask = vk::AccessFlags(vk::AccessFlagBits::eTransferRead),
+							.dependencyFlags = vk::DependencyFlags(),
+						},
+					}.data()
+				}
+			);
+
 	// commandPool and commandBuffer
 	commandPool =
 		vk::createCommandPoolUnique(
@@ -371,6 +790,31 @@ void App::init()
 			}
 		);
 
+	// query pools for frame statistics
+	if(pipelineStatisticsSupported)
+		pipelineStatisticsPool =
+			vk::createQueryPoolUnique(
+				vk::QueryPoolCreateInfo{
+					.flags = {},
+					.queryType = vk::QueryType::ePipelineStatistics,
+					.queryCount = 1,
+					.pipelineStatistics =
+						vk::QueryPipelineStatisticFlagBits::eVertexShaderInvocations |
+						vk::QueryPipelineStatisticFlagBits::eClippingPrimitives |
+						vk::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations,
+				}
+			);
+	if(timestampSupported)
+		timestampPool =
+			vk::createQueryPoolUnique(
+				vk::QueryPoolCreateInfo{
+					.flags = {},
+					.queryType = vk::QueryType::eTimestamp,
+					.queryCount = 2,
+					.pipelineStatistics = {},
+				}
+			);
+
 	// rendering fences
 	imageAvailableFence =
 		vk::createFenceUnique(
@@ -414,6 +858,329 @@ void App::init()
 				.pPushConstantRanges = nullptr,
 			}
 		);
+
+	// geometry benchmark
+	if(geometryBenchmarkRequested) {
+
+		// shader module and pipeline layout
+		// (fragment shader is shared with the triangle pipeline)
+		benchmarkVsModule =
+			vk::createShaderModuleUnique(
+				vk::ShaderModuleCreateInfo{
+					.flags = vk::ShaderModuleCreateFlags(),
+					.codeSize = sizeof(benchmarkVsSpirv),
+					.pCode = benchmarkVsSpirv,
+				}
+			);
+		benchmarkPipelineLayout =
+			vk::createPipelineLayoutUnique(
+				vk::PipelineLayoutCreateInfo{
+					.flags = vk::PipelineLayoutCreateFlags(),
+					.setLayoutCount = 0,
+					.pSetLayouts = nullptr,
+					.pushConstantRangeCount = 1,
+					.pPushConstantRanges =
+						&(const vk::PushConstantRange&)vk::PushConstantRange{
+							.stageFlags = vk::ShaderStageFlagBits::eVertex,
+							.offset = 0,
+							.size = 4 * sizeof(float),  // tileSize and freeSize
+						},
+				}
+			);
+
+		// number of instances for each triangle size
+		// (big triangles are limited by benchmarkPixelBudget;
+		// instance count is multiple of benchmarkNumIndirectDraws, so the batches are of equal size)
+		for(size_t i=0; i<benchmarkTriangleAreas.size(); i++) {
+			uint64_t n = benchmarkPixelBudget / uint64_t(benchmarkTriangleAreas[i] * benchmarkTrianglesPerInstance);
+			n = clamp(n, uint64_t(benchmarkNumIndirectDraws), uint64_t(benchmarkMaxInstances));
+			benchmarkNumInstances[i] = uint32_t(n / benchmarkNumIndirectDraws * benchmarkNumIndirectDraws);
+		}
+
+		// mesh tile vertices and indices
+		// (grid of quads, each made of two triangles)
+		vector<float> vertices;
+		vertices.reserve(2 * benchmarkVerticesPerInstance);
+		for(uint32_t y=0; y<=benchmarkGridSize; y++)
+			for(uint32_t x=0; x<=benchmarkGridSize; x++) {
+				vertices.push_back(float(x) / benchmarkGridSize);
+				vertices.push_back(float(y) / benchmarkGridSize);
+			}
+		vector<uint16_t> indices;
+		indices.reserve(3 * benchmarkTrianglesPerInstance);
+		for(uint32_t y=0; y<benchmarkGridSize; y++)
+			for(uint32_t x=0; x<benchmarkGridSize; x++) {
+				uint16_t i = uint16_t(y * (benchmarkGridSize + 1) + x);
+				uint16_t j = uint16_t(i + benchmarkGridSize + 1);
+				indices.insert(indices.end(), { i, uint16_t(i+1), j, uint16_t(i+1), uint16_t(j+1), j });
+			}
+
+		// per-instance tile offsets
+		// (random positions inside the window, so the tiles overlap)
+		vector<float> tileOffsets(2 * benchmarkMaxInstances);
+		minstd_rand randomGenerator(1);
+		uniform_real_distribution<float> distribution(0.f, 1.f);
+		for(float& f : tileOffsets)
+			f = distribution(randomGenerator);
+
+		// indirect draw commands
+		// (benchmarkNumIndirectDraws commands for each triangle size, each drawing a part of the instances)
+		vector<vk::DrawIndexedIndirectCommand> drawCommands;
+		drawCommands.reserve(benchmarkTriangleAreas.size() * benchmarkNumIndirectDraws);
+		for(uint32_t numInstances : benchmarkNumInstances)
+			for(uint32_t i=0; i<benchmarkNumIndirectDraws; i++)
+				drawCommands.push_back(
+					vk::DrawIndexedIndirectCommand{
+						.indexCount = 3 * benchmarkTrianglesPerInstance,
+						.instanceCount = numInstances / benchmarkNumIndirectDraws,
+						.firstIndex = 0,
+						.vertexOffset = 0,
+						.firstInstance = i * (numInstances / benchmarkNumIndirectDraws),
+					}
+				);
+
+		// upload everything into device-local buffers
+		createDeviceLocalBuffer(vertexBuffer, vertexMemory, vk::BufferUsageFlagBits::eVertexBuffer,
+			vertices.data(), vertices.size() * sizeof(float));
+		createDeviceLocalBuffer(instanceBuffer, instanceMemory, vk::BufferUsageFlagBits::eVertexBuffer,
+			tileOffsets.data(), tileOffsets.size() * sizeof(float));
+		createDeviceLocalBuffer(indexBuffer, indexMemory, vk::BufferUsageFlagBits::eIndexBuffer,
+			indices.data(), indices.size() * sizeof(uint16_t));
+		if(indirectDrawRequested)
+			createDeviceLocalBuffer(indirectBuffer, indirectMemory, vk::BufferUsageFlagBits::eIndirectBuffer,
+				drawCommands.data(), drawCommands.size() * sizeof(vk::DrawIndexedIndirectCommand));
+	}
+
+	// async compute
+	if(asyncComputeRequested) {
+
+		// compute pipeline
+		computeModule =
+			vk::createShaderModuleUnique(
+				vk::ShaderModuleCreateInfo{
+					.flags = vk::ShaderModuleCreateFlags(),
+					.codeSize = sizeof(computeSpirv),
+					.pCode = computeSpirv,
+				}
+			);
+		computePipelineLayout =
+			vk::createPipelineLayoutUnique(
+				vk::PipelineLayoutCreateInfo{
+					.flags = vk::PipelineLayoutCreateFlags(),
+					.setLayoutCount = 0,
+					.pSetLayouts = nullptr,
+					.pushConstantRangeCount = 0,
+					.pPushConstantRanges = nullptr,
+				}
+			);
+		computePipeline =
+			vk::createComputePipelineUnique(
+				nullptr,  // pipelineCache
+				vk::ComputePipelineCreateInfo{  // createInfo
+					.flags = {},
+					.stage =
+						vk::PipelineShaderStageCreateInfo{
+							.flags = {},
+							.stage = vk::ShaderStageFlagBits::eCompute,
+							.module = computeModule,
+							.pName = "main",
+							.pSpecializationInfo = nullptr,
+						},
+					.layout = computePipelineLayout,
+					.basePipelineHandle = nullptr,
+					.basePipelineIndex = -1,
+				}
+			);
+
+		// query pool
+		if(timestampSupported)
+			computeTimestampPool =
+				vk::createQueryPoolUnique(
+					vk::QueryPoolCreateInfo{
+						.flags = {},
+						.queryType = vk::QueryType::eTimestamp,
+						.queryCount = 2,
+						.pipelineStatistics = {},
+					}
+				);
+
+		// synchronization
+		computeFinishedSemaphore =
+			vk::createSemaphoreUnique(
+				vk::SemaphoreCreateInfo{
+					.flags = {},
+				}
+			);
+		computeFinishedFence =
+			vk::createFenceUnique(
+				vk::FenceCreateInfo{
+					.flags = {},
+				}
+			);
+
+		// command buffer for the compute queue
+		// (it is recorded just once and submitted in each overlapped frame)
+		if(computeOverlapSupported) {
+			computeCommandPool =
+				vk::createCommandPoolUnique(
+					vk::CommandPoolCreateInfo{
+						.flags = {},
+						.queueFamilyIndex = computeQueueFamily,
+					}
+				);
+			computeCommandBuffer =
+				vk::allocateCommandBuffer(
+					vk::CommandBufferAllocateInfo{
+						.commandPool = computeCommandPool,
+						.level = vk::CommandBufferLevel::ePrimary,
+						.commandBufferCount = 1,
+					}
+				);
+			vk::beginCommandBuffer(
+				computeCommandBuffer,
+				vk::CommandBufferBeginInfo{
+					.flags = {},
+					.pInheritanceInfo = nullptr,
+				}
+			);
+			recordComputeWork(computeCommandBuffer);
+			vk::endCommandBuffer(computeCommandBuffer);
+		}
+	}
+}
+
+
+void App::createDeviceLocalBuffer(vk::UniqueBuffer& buffer, vk::UniqueDeviceMemory& memory,
+	vk::BufferUsageFlags usage, const void* data, size_t size)
+{
+	// allocate memory of the type with requiredFlags and bind it to the buffer
+	auto allocateMemory =
+		[](vk::Buffer buffer, vk::MemoryPropertyFlags requiredFlags) {
+			vk::MemoryRequirements memoryRequirements = vk::getBufferMemoryRequirements(buffer);
+			uint32_t memoryTypeIndex = findMemoryType(memoryRequirements, requiredFlags);
+			if(memoryTypeIndex == ~uint32_t(0))
+				throw runtime_error("No suitable memory type found for the buffer.");
+			vk::UniqueDeviceMemory m =
+				vk::allocateMemoryUnique(
+					vk::MemoryAllocateInfo{
+						.allocationSize = memoryRequirements.size,
+						.memoryTypeIndex = memoryTypeIndex,
+					}
+				);
+			vk::bindBufferMemory(buffer, m, 0);
+			return m;
+		};
+
+	// staging buffer
+	vk::UniqueBuffer stagingBuffer =
+		vk::createBufferUnique(
+			vk::BufferCreateInfo{
+				.flags = {},
+				.size = size,
+				.usage = vk::BufferUsageFlagBits::eTransferSrc,
+				.sharingMode = vk::SharingMode::eExclusive,
+				.queueFamilyIndexCount = 0,
+				.pQueueFamilyIndices = nullptr,
+			}
+		);
+	vk::UniqueDeviceMemory stagingMemory =
+		allocateMemory(stagingBuffer, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
+	void* p;
+	vk::mapMemory(stagingMemory, 0, size, {}, &p);
+	memcpy(p, data, size);
+	vk::unmapMemory(stagingMemory);
+
+	// device-local buffer
+	buffer =
+		vk::createBufferUnique(
+			vk::BufferCreateInfo{
+				.flags = {},
+				.size = size,
+				.usage = usage | vk::BufferUsageFlagBits::eTransferDst,
+				.sharingMode = vk::SharingMode::eExclusive,
+				.queueFamilyIndexCount = 0,
+				.pQueueFamilyIndices = nullptr,
+			}
+		);
+	memory = allocateMemory(buffer, vk::MemoryPropertyFlagBits::eDeviceLocal);
+
+	// copy on the graphics queue
+	// (the barrier makes the copied data visible to vertex input and indirect command reads)
+	vk::beginCommandBuffer(
+		commandBuffer,
+		vk::CommandBufferBeginInfo{
+			.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+			.pInheritanceInfo = nullptr,
+		}
+	);
+	vk::cmdCopyBuffer(
+		commandBuffer,
+		stagingBuffer,  // srcBuffer
+		buffer.get(),  // dstBuffer
+		vk::BufferCopy{  // regions
+			.srcOffset = 0,
+			.dstOffset = 0,
+			.size = size,
+		}
+	);
+	vk::cmdPipelineBarrier(
+		commandBuffer,
+		vk::PipelineStageFlagBits::eTransfer,  // srcStageMask
+		vk::PipelineStageFlagBits::eVertexInput | vk::PipelineStageFlagBits::eDrawIndirect,  // dstStageMask
+		vk::DependencyFlags(),  // dependencyFlags
+		vk::MemoryBarrier{  // memoryBarriers
+			.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+			.dstAccessMask = vk::AccessFlagBits::eVertexAttributeRead | vk::AccessFlagBits::eIndexRead |
+				vk::AccessFlagBits::eIndirectCommandRead,
+		},
+		{ nullptr, 0 },  // bufferMemoryBarriers
+		{ nullptr, 0 }  // imageMemoryBarriers
+	);
+	vk::endCommandBuffer(commandBuffer);
+	vk::UniqueFence fence =
+		vk::createFenceUnique(
+			vk::FenceCreateInfo{
+				.flags = {},
+			}
+		);
+	vk::queueSubmit(
+		graphicsQueue,  // queue
+		vk::SubmitInfo{  // submits
+			.waitSemaphoreCount = 0,
+			.pWaitSemaphores = nullptr,
+			.pWaitDstStageMask = nullptr,
+			.commandBufferCount = 1,
+			.pCommandBuffers = &commandBuffer,
+			.signalSemaphoreCount = 0,
+			.pSignalSemaphores = nullptr,
+		},
+		fence  // fence
+	);
+	vk::Result r =
+		vk::waitForFences_noThrow(
+			array{ fence.get() },  // fences
+			vk::True,  // waitAll
+			uint64_t(1.5e9)  // timeout
+		);
+	if(r != vk::Result::eSuccess) {
+		if(r == vk::Result::eTimeout)
+			throw runtime_error("GPU timeout. Task is probably hanging on GPU.");
+		throw runtime_error(string("Vulkan error: vkWaitForFences failed with error ") + vk::to_cstr(r) + ".");
+	}
+}
+
+
+void App::recordComputeWork(vk::CommandBuffer cb)
+{
+	// FMA dispatch surrounded by timestamps
+	if(computeTimestampPool) {
+		vk::cmdResetQueryPool(cb, computeTimestampPool, 0, 2);
+		vk::cmdWriteTimestamp(cb, vk::PipelineStageFlagBits::eTopOfPipe, computeTimestampPool, 0);
+	}
+	vk::cmdBindPipeline(cb, vk::PipelineBindPoint::eCompute, computePipeline);
+	vk::cmdDispatch(cb, computeWorkgroupCountX, computeWorkgroupCountY, 1);
+	if(computeTimestampPool)
+		vk::cmdWriteTimestamp(cb, vk::PipelineStageFlagBits::eBottomOfPipe, computeTimestampPool, 1);
 }
 
 
@@ -461,6 +1228,22 @@ void App::resize(VulkanWindow&, uint32_t& widthToBeSet, uint32_t& heightToBeSet)
 	swapchainImageViews.clear();
 	framebuffers.clear();
 	pipeline = nullptr;
+	benchmarkPipeline = nullptr;
+
+	// clear offscreen resources
+	// (the writer thread must write all frames before the readback buffer is released)
+	if(offscreenRequested) {
+		if(readbackPending)
+			handOverReadback();
+		frameWriter->finish();
+		offscreenFramebuffer = nullptr;
+		offscreenImageView = nullptr;
+		offscreenImage = nullptr;
+		offscreenImageMemory = nullptr;
+		readbackData = nullptr;
+		readbackBuffer = nullptr;
+		readbackMemory = nullptr;
+	}
 
 	// print info
 	cout << "Recreating swapchain (extent: " << newSurfaceExtent.width << "x" << newSurfaceExtent.height
@@ -539,6 +1322,110 @@ void App::resize(VulkanWindow&, uint32_t& widthToBeSet, uint32_t& heightToBeSet)
 			)
 		);
 
+	// offscreen image, its image view and framebuffer
+	if(offscreenRequested) {
+		offscreenExtent = newSurfaceExtent;
+		offscreenImage =
+			vk::createImageUnique(
+				vk::ImageCreateInfo{
+					.flags = {},
+					.imageType = vk::ImageType::e2D,
+					.format = surfaceFormat.format,
+					.extent = vk::Extent3D(newSurfaceExtent.width, newSurfaceExtent.height, 1),
+					.mipLevels = 1,
+					.arrayLayers = 1,
+					.samples = vk::SampleCountFlagBits::e1,
+					.tiling = vk::ImageTiling::eOptimal,
+					.usage = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc,
+					.sharingMode = vk::SharingMode::eExclusive,
+					.queueFamilyIndexCount = 0,
+					.pQueueFamilyIndices = nullptr,
+					.initialLayout = vk::ImageLayout::eUndefined,
+				}
+			);
+		vk::MemoryRequirements memoryRequirements = vk::getImageMemoryRequirements(offscreenImage);
+		uint32_t memoryTypeIndex = findMemoryType(memoryRequirements, vk::MemoryPropertyFlagBits::eDeviceLocal);
+		if(memoryTypeIndex == ~uint32_t(0))
+			throw runtime_error("No suitable memory type found for the offscreen image.");
+		offscreenImageMemory =
+			vk::allocateMemoryUnique(
+				vk::MemoryAllocateInfo{
+					.allocationSize = memoryRequirements.size,
+					.memoryTypeIndex = memoryTypeIndex,
+				}
+			);
+		vk::bindImageMemory(offscreenImage, offscreenImageMemory, 0);
+		offscreenImageView =
+			vk::createImageViewUnique(
+				vk::ImageViewCreateInfo{
+					.flags = vk::ImageViewCreateFlags(),
+					.image = offscreenImage,
+					.viewType = vk::ImageViewType::e2D,
+					.format = surfaceFormat.format,
+					.components = {},
+					.subresourceRange = vk::ImageSubresourceRange{
+						.aspectMask = vk::ImageAspectFlagBits::eColor,
+						.baseMipLevel = 0,
+						.levelCount = 1,
+						.baseArrayLayer = 0,
+						.layerCount = 1,
+					}
+				}
+			);
+		offscreenFramebuffer =
+			vk::createFramebufferUnique(
+				vk::FramebufferCreateInfo{
+					.flags = vk::FramebufferCreateFlags(),
+					.renderPass = offscreenRenderPass,
+					.attachmentCount = 1,
+					.pAttachments = offscreenImageView.getPtr(),
+					.width = newSurfaceExtent.width,
+					.height = newSurfaceExtent.height,
+					.layers = 1,
+				}
+			);
+
+		// readback ring
+		// (each slot is aligned to nonCoherentAtomSize, so it can be invalidated separately;
+		// cached memory is preferred because the writer thread reads it by CPU)
+		readbackSlotSize =
+			(vk::DeviceSize(newSurfaceExtent.width) * newSurfaceExtent.height * 4 + nonCoherentAtomSize - 1) /
+			nonCoherentAtomSize * nonCoherentAtomSize;
+		readbackBuffer =
+			vk::createBufferUnique(
+				vk::BufferCreateInfo{
+					.flags = {},
+					.size = readbackSlotSize * readbackRingSize,
+					.usage = vk::BufferUsageFlagBits::eTransferDst,
+					.sharingMode = vk::SharingMode::eExclusive,
+					.queueFamilyIndexCount = 0,
+					.pQueueFamilyIndices = nullptr,
+				}
+			);
+		memoryRequirements = vk::getBufferMemoryRequirements(readbackBuffer);
+		memoryTypeIndex =
+			findMemoryType(memoryRequirements, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCached);
+		if(memoryTypeIndex == ~uint32_t(0))
+			memoryTypeIndex =
+				findMemoryType(memoryRequirements, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
+		if(memoryTypeIndex == ~uint32_t(0))
+			throw runtime_error("No suitable memory type found for the readback buffer.");
+		readbackCoherent =
+			bool(vk::getPhysicalDeviceMemoryProperties().memoryTypes[memoryTypeIndex].propertyFlags &
+			     vk::MemoryPropertyFlagBits::eHostCoherent);
+		readbackMemory =
+			vk::allocateMemoryUnique(
+				vk::MemoryAllocateInfo{
+					.allocationSize = memoryRequirements.size,
+					.memoryTypeIndex = memoryTypeIndex,
+				}
+			);
+		vk::bindBufferMemory(readbackBuffer, readbackMemory, 0);
+		void* p;
+		vk::mapMemory(readbackMemory, 0, vk::WholeSize, {}, &p);
+		readbackData = static_cast<uint8_t*>(p);
+	}
+
 	// rendering finished semaphores
 	if(renderingFinishedSemaphores.size() != swapchainImages.size())
 	{
@@ -553,145 +1440,197 @@ void App::resize(VulkanWindow&, uint32_t& widthToBeSet, uint32_t& heightToBeSet)
 			);
 	}
 
-	// pipeline
-	pipeline =
-		vk::createGraphicsPipelineUnique(
-			nullptr,  // pipelineCache
-			vk::GraphicsPipelineCreateInfo{
-				.flags = vk::PipelineCreateFlags(),
-
-				// shader stages
-				.stageCount = 2,
-				.pStages =
-					array{
-						vk::PipelineShaderStageCreateInfo{
-							.flags = vk::PipelineShaderStageCreateFlags(),
-							.stage = vk::ShaderStageFlagBits::eVertex,
-							.module = vsModule,
-							.pName = "main",
-							.pSpecializationInfo = nullptr,
-						},
-						vk::PipelineShaderStageCreateInfo{
-							.flags = vk::PipelineShaderStageCreateFlags(),
-							.stage = vk::ShaderStageFlagBits::eFragment,
-							.module = fsModule,
-							.pName = "main",
-							.pSpecializationInfo = nullptr,
-						},
-					}.data(),
+	// pipelines
+	// (triangle pipeline has no vertex input; geometry benchmark pipeline
+	// uses per-vertex positions and per-instance tile offsets)
+	auto createPipeline =
+		[this, newSurfaceExtent](vk::ShaderModule vertexShader, vk::PipelineLayout layout,
+			const vk::PipelineVertexInputStateCreateInfo& vertexInputState)
+		{
+			return
+				vk::createGraphicsPipelineUnique(
+					nullptr,  // pipelineCache
+					vk::GraphicsPipelineCreateInfo{
+						.flags = vk::PipelineCreateFlags(),
+
+						// shader stages
+						.stageCount = 2,
+						.pStages =
+							array{
+								vk::PipelineShaderStageCreateInfo{
+									.flags = vk::PipelineShaderStageCreateFlags(),
+									.stage = vk::ShaderStageFlagBits::eVertex,
+									.module = vertexShader,
+									.pName = "main",
+									.pSpecializationInfo = nullptr,
+								},
+								vk::PipelineShaderStageCreateInfo{
+									.flags = vk::PipelineShaderStageCreateFlags(),
+									.stage = vk::ShaderStageFlagBits::eFragment,
+									.module = fsModule,
+									.pName = "main",
+									.pSpecializationInfo = nullptr,
+								},
+							}.data(),
 
-				// vertex input
-				.pVertexInputState =
-					&(const vk::PipelineVertexInputStateCreateInfo&)vk::PipelineVertexInputStateCreateInfo{
-						.flags = vk::PipelineVertexInputStateCreateFlags(),
-						.vertexBindingDescriptionCount = 0,
-						.pVertexBindingDescriptions = nullptr,
-						.vertexAttributeDescriptionCount = 0,
-						.pVertexAttributeDescriptions = nullptr,
-					},
+						// vertex input
+						.pVertexInputState = &vertexInputState,
 
-				// input assembly
-				.pInputAssemblyState =
-					&(const vk::PipelineInputAssemblyStateCreateInfo&)vk::PipelineInputAssemblyStateCreateInfo{
-						.flags = vk::PipelineInputAssemblyStateCreateFlags(),
-						.topology = vk::PrimitiveTopology::eTriangleList,
-						.primitiveRestartEnable = vk::False,
-					},
+						// input assembly
+						.pInputAssemblyState =
+							&(const vk::PipelineInputAssemblyStateCreateInfo&)vk::PipelineInputAssemblyStateCreateInfo{
+								.flags = vk::PipelineInputAssemblyStateCreateFlags(),
+								.topology = vk::PrimitiveTopology::eTriangleList,
+								.primitiveRestartEnable = vk::False,
+							},
 
-				// tessellation
-				.pTessellationState = nullptr,
-
-				// viewport
-				.pViewportState =
-					&(const vk::PipelineViewportStateCreateInfo&)vk::PipelineViewportStateCreateInfo{
-						.flags = vk::PipelineViewportStateCreateFlags(),
-						.viewportCount = 1,
-						.pViewports = array{
-							vk::Viewport{
-								.x = 0.f,
-								.y = 0.f,
-								.width = float(newSurfaceExtent.width),
-								.height = float(newSurfaceExtent.height),
-								.minDepth = 0.f,
-								.maxDepth = 1.f
+						// tessellation
+						.pTessellationState = nullptr,
+
+						// viewport
+						.pViewportState =
+							&(const vk::PipelineViewportStateCreateInfo&)vk::PipelineViewportStateCreateInfo{
+								.flags = vk::PipelineViewportStateCreateFlags(),
+								.viewportCount = 1,
+								.pViewports = array{
+									vk::Viewport{
+										.x = 0.f,
+										.y = 0.f,
+										.width = float(newSurfaceExtent.width),
+										.height = float(newSurfaceExtent.height),
+										.minDepth = 0.f,
+										.maxDepth = 1.f
+									},
+								}.data(),
+								.scissorCount = 1,
+								.pScissors = array{
+									vk::Rect2D(vk::Offset2D(0, 0), newSurfaceExtent)
+								}.data(),
 							},
-						}.data(),
-						.scissorCount = 1,
-						.pScissors = array{
-							vk::Rect2D(vk::Offset2D(0, 0), newSurfaceExtent)
-						}.data(),
-					},
 
-				// rasterization
-				.pRasterizationState =
-					&(const vk::PipelineRasterizationStateCreateInfo&)vk::PipelineRasterizationStateCreateInfo{
-						.flags = vk::PipelineRasterizationStateCreateFlags(),
-						.depthClampEnable = vk::False,
-						.rasterizerDiscardEnable = vk::False,
-						.polygonMode = vk::PolygonMode::eFill,
-						.cullMode = vk::CullModeFlagBits::eNone,
-						.frontFace = vk::FrontFace::eCounterClockwise,
-						.depthBiasEnable = vk::False,
-						.depthBiasConstantFactor = 0.f,
-						.depthBiasClamp = 0.f,
-						.depthBiasSlopeFactor = 0.f,
-						.lineWidth = 1.f,
-					},
+						// rasterization
+						.pRasterizationState =
+							&(const vk::PipelineRasterizationStateCreateInfo&)vk::PipelineRasterizationStateCreateInfo{
+								.flags = vk::PipelineRasterizationStateCreateFlags(),
+								.depthClampEnable = vk::False,
+								.rasterizerDiscardEnable = vk::False,
+								.polygonMode = vk::PolygonMode::eFill,
+								.cullMode = vk::CullModeFlagBits::eNone,
+								.frontFace = vk::FrontFace::eCounterClockwise,
+								.depthBiasEnable = vk::False,
+								.depthBiasConstantFactor = 0.f,
+								.depthBiasClamp = 0.f,
+								.depthBiasSlopeFactor = 0.f,
+								.lineWidth = 1.f,
+							},
 
-				// multisampling
-				.pMultisampleState =
-					&(const vk::PipelineMultisampleStateCreateInfo&)vk::PipelineMultisampleStateCreateInfo{
-						.flags = vk::PipelineMultisampleStateCreateFlags(),
-						.rasterizationSamples = vk::SampleCountFlagBits::e1,
-						.sampleShadingEnable = vk::False,
-						.minSampleShading = 0.f,
-						.pSampleMask = nullptr,
-						.alphaToCoverageEnable = vk::False,
-						.alphaToOneEnable = vk::False,
-					},
+						// multisampling
+						.pMultisampleState =
+							&(const vk::PipelineMultisampleStateCreateInfo&)vk::PipelineMultisampleStateCreateInfo{
+								.flags = vk::PipelineMultisampleStateCreateFlags(),
+								.rasterizationSamples = vk::SampleCountFlagBits::e1,
+								.sampleShadingEnable = vk::False,
+								.minSampleShading = 0.f,
+								.pSampleMask = nullptr,
+								.alphaToCoverageEnable = vk::False,
+								.alphaToOneEnable = vk::False,
+							},
 
-				// depth and stencil
-				.pDepthStencilState = nullptr,
-
-				// blending
-				.pColorBlendState =
-					&(const vk::PipelineColorBlendStateCreateInfo&)vk::PipelineColorBlendStateCreateInfo{
-						.flags = vk::PipelineColorBlendStateCreateFlags(),
-						.logicOpEnable = vk::False,
-						.logicOp = vk::LogicOp::eClear,
-						.attachmentCount = 1,
-						.pAttachments =
-							array{
-								vk::PipelineColorBlendAttachmentState{
-									.blendEnable = vk::False,
-									.srcColorBlendFactor = vk::BlendFactor::eZero,
-									.dstColorBlendFactor = vk::BlendFactor::eZero,
-									.colorBlendOp = vk::BlendOp::eAdd,
-									.srcAlphaBlendFactor = vk::BlendFactor::eZero,
-									.dstAlphaBlendFactor = vk::BlendFactor::eZero,
-									.alphaBlendOp = vk::BlendOp::eAdd,
-									.colorWriteMask = vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG |
-										vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA,
-								},
-							}.data(),
-						.blendConstants = { 0.f, 0.f, 0.f, 0.f },
-					},
+						// depth and stencil
+						.pDepthStencilState = nullptr,
+
+						// blending
+						.pColorBlendState =
+							&(const vk::PipelineColorBlendStateCreateInfo&)vk::PipelineColorBlendStateCreateInfo{
+								.flags = vk::PipelineColorBlendStateCreateFlags(),
+								.logicOpEnable = vk::False,
+								.logicOp = vk::LogicOp::eClear,
+								.attachmentCount = 1,
+								.pAttachments =
+									array{
+										vk::PipelineColorBlendAttachmentState{
+											.blendEnable = vk::False,
+											.srcColorBlendFactor = vk::BlendFactor::eZero,
+											.dstColorBlendFactor = vk::BlendFactor::eZero,
+											.colorBlendOp = vk::BlendOp::eAdd,
+											.srcAlphaBlendFactor = vk::BlendFactor::eZero,
+											.dstAlphaBlendFactor = vk::BlendFactor::eZero,
+											.alphaBlendOp = vk::BlendOp::eAdd,
+											.colorWriteMask = vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG |
+												vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA,
+										},
+									}.data(),
+								.blendConstants = { 0.f, 0.f, 0.f, 0.f },
+							},
 
-				.pDynamicState = nullptr,
-				.layout = pipelineLayout,
-				.renderPass = renderPass,
-				.subpass = 0,
-				.basePipelineHandle = nullptr,
-				.basePipelineIndex = -1,
+						.pDynamicState = nullptr,
+						.layout = layout,
+						.renderPass = renderPass,
+						.subpass = 0,
+						.basePipelineHandle = nullptr,
+						.basePipelineIndex = -1,
+					}
+				);
+		};
+	pipeline =
+		createPipeline(
+			vsModule,
+			pipelineLayout,
+			vk::PipelineVertexInputStateCreateInfo{
+				.flags = vk::PipelineVertexInputStateCreateFlags(),
+				.vertexBindingDescriptionCount = 0,
+				.pVertexBindingDescriptions = nullptr,
+				.vertexAttributeDescriptionCount = 0,
+				.pVertexAttributeDescriptions = nullptr,
 			}
 		);
+	if(geometryBenchmarkRequested)
+		benchmarkPipeline =
+			createPipeline(
+				benchmarkVsModule,
+				benchmarkPipelineLayout,
+				vk::PipelineVertexInputStateCreateInfo{
+					.flags = vk::PipelineVertexInputStateCreateFlags(),
+					.vertexBindingDescriptionCount = 2,
+					.pVertexBindingDescriptions =
+						array{
+							vk::VertexInputBindingDescription{
+								.binding = 0,
+								.stride = 2 * sizeof(float),
+								.inputRate = vk::VertexInputRate::eVertex,
+							},
+							vk::VertexInputBindingDescription{
+								.binding = 1,
+								.stride = 2 * sizeof(float),
+								.inputRate = vk::VertexInputRate::eInstance,
+							},
+						}.data(),
+					.vertexAttributeDescriptionCount = 2,
+					.pVertexAttributeDescriptions =
+						array{
+							vk::VertexInputAttributeDescription{
+								.location = 0,
+								.binding = 0,
+								.format = vk::Format::eR32G32Sfloat,
+								.offset = 0,
+							},
+							vk::VertexInputAttributeDescription{
+								.location = 1,
+								.binding = 1,
+								.format = vk::Format::eR32G32Sfloat,
+								.offset = 0,
+							},
+						}.data(),
+				}
+			);
 }
 
 
 void App::frame(VulkanWindow&)
 {
 	// acquire image
-	if(acquiredImageIndex == ~uint32_t(0)) {
+	// (offscreen rendering does not use the swapchain)
+	if(!offscreenRequested && acquiredImageIndex == ~uint32_t(0)) {
 
 		vk::resetFences(imageAvailableFence);
 		vk::Result r =
@@ -741,6 +1680,89 @@ void App::frame(VulkanWindow&)
 
 	}
 
+	// offscreen rendering
+	if(offscreenRequested) {
+
+		// wait for the previous frame and hand its readback over to the writer thread
+		vk::Result r =
+			vk::waitForFences_noThrow(
+				array{ renderFinishedFence.get() },  // fences
+				vk::True,  // waitAll
+				uint64_t(1.5e9)  // timeout
+			);
+		if(r != vk::Result::eSuccess) {
+			if(r == vk::Result::eTimeout)
+				throw runtime_error("GPU timeout. Task is probably hanging on GPU.");
+			throw runtime_error(string("Vulkan error: vkWaitForFences failed with error ") + vk::to_cstr(r) + ".");
+		}
+		if(readbackPending)
+			handOverReadback();
+
+		// wait until the writer thread frees the slot of this frame
+		// (it happens only when the disk is slower than the rendering;
+		// the GPU is never waiting for the disk, it just does not get new work)
+		auto t1 = chrono::high_resolution_clock::now();
+		if(frameWriter->waitForSlot(unsigned(numOffscreenFrames % readbackRingSize))) {
+			auto t2 = chrono::high_resolution_clock::now();
+			numWriterStalls++;
+			writerStallTime += chrono::duration<float>(t2 - t1).count();
+		}
+		if(numOffscreenFrames == 0)
+			offscreenStartTime = t1;
+	}
+
+	// read statistics of the previous frame
+	// (renderFinishedFence was already waited on, so the query results are available)
+	if(frameQueriesPending)
+		readFrameStatistics();
+
+	// wait for the compute work of the previous frame
+	// (the compute command buffer and timestamps must not be in use when submitted again)
+	if(computeFencePending) {
+		vk::Result r =
+			vk::waitForFences_noThrow(
+				array{ computeFinishedFence.get() },  // fences
+				vk::True,  // waitAll
+				uint64_t(1.5e9)  // timeout
+			);
+		if(r != vk::Result::eSuccess) {
+			if(r == vk::Result::eTimeout)
+				throw runtime_error("GPU timeout. Task is probably hanging on GPU.");
+			throw runtime_error(string("Vulkan error: vkWaitForFences failed with error ") + vk::to_cstr(r) + ".");
+		}
+		vk::resetFences(computeFinishedFence);
+		computeFencePending = false;
+	}
+	if(computeQueriesPending)
+		readComputeStatistics();
+
+	// async compute mode of this frame
+	// (overlapped and not overlapped mode alternate after each asyncComputeModeInterval frames)
+	if(asyncComputeRequested) {
+		computeOverlap = computeOverlapSupported && (numComputeFrames / asyncComputeModeInterval) % 2 == 1;
+		auto t = chrono::high_resolution_clock::now();
+		if(numComputeFrames != 0 && computeOverlap == previousComputeOverlap) {
+			ComputeModeStatistics& stats = computeStatistics[computeOverlap];
+			stats.cpuTime += chrono::duration<float>(t - lastFrameTime).count();
+			stats.numCpuFrames++;
+		}
+		lastFrameTime = t;
+		numComputeFrames++;
+	}
+
+	// geometry benchmark triangle size of this frame
+	// (the size changes after each geometryBenchmarkInterval frames;
+	// sizes whose mesh tile does not fit into the window are skipped)
+	if(geometryBenchmarkRequested) {
+		for(size_t i=0; i<benchmarkTriangleAreas.size(); i++) {
+			benchmarkLevel = (numBenchmarkFrames / geometryBenchmarkInterval) % benchmarkTriangleAreas.size();
+			if(benchmarkTileSize(benchmarkLevel) <= float(min(window.surfaceWidth(), window.surfaceHeight())))
+				break;
+			numBenchmarkFrames = (numBenchmarkFrames / geometryBenchmarkInterval + 1) * geometryBenchmarkInterval;
+		}
+		numBenchmarkFrames++;
+	}
+
 	// record command buffer
 	vk::beginCommandBuffer(
 		commandBuffer,
@@ -749,11 +1771,42 @@ void App::frame(VulkanWindow&)
 			.pInheritanceInfo = nullptr,
 		}
 	);
+
+	// begin frame queries
+	// (queries are placed around the render pass)
+	if(pipelineStatisticsPool) {
+		vk::cmdResetQueryPool(commandBuffer, pipelineStatisticsPool, 0, 1);
+		vk::cmdBeginQuery(commandBuffer, pipelineStatisticsPool, 0, {});
+	}
+	if(timestampPool) {
+		vk::cmdResetQueryPool(commandBuffer, timestampPool, 0, 2);
+		vk::cmdWriteTimestamp(commandBuffer, vk::PipelineStageFlagBits::eTopOfPipe, timestampPool, 0);
+	}
+
+	// compute work without overlap
+	// (it is executed on the graphics queue before the rendering;
+	// the barrier makes the results visible to the rendering as the semaphore does in overlapped mode)
+	if(asyncComputeRequested && !computeOverlap) {
+		recordComputeWork(commandBuffer);
+		vk::cmdPipelineBarrier(
+			commandBuffer,
+			vk::PipelineStageFlagBits::eComputeShader,  // srcStageMask
+			vk::PipelineStageFlagBits::eFragmentShader,  // dstStageMask
+			vk::DependencyFlags(),  // dependencyFlags
+			vk::MemoryBarrier{  // memoryBarriers
+				.srcAccessMask = vk::AccessFlagBits::eShaderWrite,
+				.dstAccessMask = vk::AccessFlagBits::eShaderRead,
+			},
+			{ nullptr, 0 },  // bufferMemoryBarriers
+			{ nullptr, 0 }  // imageMemoryBarriers
+		);
+	}
+
 	vk::cmdBeginRenderPass(
 		commandBuffer,
 		vk::RenderPassBeginInfo{
-			.renderPass = renderPass,
-			.framebuffer = framebuffers[acquiredImageIndex],
+			.renderPass = offscreenRequested ? offscreenRenderPass.get() : renderPass.get(),
+			.framebuffer = offscreenRequested ? offscreenFramebuffer.get() : framebuffers[acquiredImageIndex].get(),
 			.renderArea = vk::Rect2D(vk::Offset2D(0, 0), vk::Extent2D(window.surfaceWidth(), window.surfaceHeight())),
 			.clearValueCount = 1,
 			.pClearValues = &(const vk::ClearValue&)vk::ClearValue{
@@ -766,35 +1819,168 @@ void App::frame(VulkanWindow&)
 	);
 
 	// rendering commands
-	vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eGraphics, pipeline);
-	vk::cmdDraw(  // draw single triangle
-		commandBuffer,
-		3,  // vertexCount
-		1,  // instanceCount
-		0,  // firstVertex
-		0   // firstInstance
-	);
+	if(!geometryBenchmarkRequested) {
+		vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eGraphics, pipeline);
+		vk::cmdDraw(  // draw single triangle
+			commandBuffer,
+			3,  // vertexCount
+			1,  // instanceCount
+			0,  // firstVertex
+			0   // firstInstance
+		);
+	}
+	else {
+
+		// geometry benchmark
+		// (mesh tiles are instanced over the window; tile size is given by the triangle size)
+		float tileWidth = 2.f * benchmarkTileSize(benchmarkLevel) / float(window.surfaceWidth());
+		float tileHeight = 2.f * benchmarkTileSize(benchmarkLevel) / float(window.surfaceHeight());
+		array<float, 4> pushConstants = { tileWidth, tileHeight, 2.f - tileWidth, 2.f - tileHeight };
+		vk::cmdBindPipeline(commandBuffer, vk::PipelineBindPoint::eGraphics, benchmarkPipeline);
+		vk::cmdPushConstants(
+			commandBuffer,
+			benchmarkPipelineLayout,  // layout
+			vk::ShaderStageFlagBits::eVertex,  // stageFlags
+			0,  // offset
+			sizeof(pushConstants),  // size
+			pushConstants.data()  // pValues
+		);
+		vk::cmdBindVertexBuffers(
+			commandBuffer,
+			0,  // firstBinding
+			2,  // bindingCount
+			array{ vertexBuffer.get(), instanceBuffer.get() }.data(),  // pBuffers
+			array<vk::DeviceSize, 2>{ 0, 0 }.data()  // pOffsets
+		);
+		vk::cmdBindIndexBuffer(commandBuffer, indexBuffer, 0, vk::IndexType::eUint16);
+		if(!indirectDrawRequested)
+			vk::cmdDrawIndexed(  // draw all instances at once
+				commandBuffer,
+				3 * benchmarkTrianglesPerInstance,  // indexCount
+				benchmarkNumInstances[benchmarkLevel],  // instanceCount
+				0,  // firstIndex
+				0,  // vertexOffset
+				0   // firstInstance
+			);
+		else {
+			// batch of benchmarkNumIndirectDraws draws of this triangle size
+			// (without multiDrawIndirect, each draw is recorded by its own command)
+			constexpr const uint32_t stride = sizeof(vk::DrawIndexedIndirectCommand);
+			vk::DeviceSize offset = benchmarkLevel * benchmarkNumIndirectDraws * stride;
+			if(multiDrawIndirectSupported)
+				vk::cmdDrawIndexedIndirect(commandBuffer, indirectBuffer, offset, benchmarkNumIndirectDraws, stride);
+			else
+				for(uint32_t i=0; i<benchmarkNumIndirectDraws; i++)
+					vk::cmdDrawIndexedIndirect(commandBuffer, indirectBuffer, offset + i * stride, 1, stride);
+		}
+	}
 
-	// end render pass and command buffer
+	// end render pass
 	vk::cmdEndRenderPass(commandBuffer);
+
+	// copy offscreen image into the readback slot of this frame
+	// (the render pass transitioned the image to eTransferSrcOptimal layout;
+	// the barrier makes the copied data available to the host)
+	if(offscreenRequested) {
+		vk::cmdCopyImageToBuffer(
+			commandBuffer,
+			offscreenImage,  // srcImage
+			vk::ImageLayout::eTransferSrcOptimal,  // srcImageLayout
+			readbackBuffer,  // dstBuffer
+			vk::BufferImageCopy{  // regions
+				.bufferOffset = (numOffscreenFrames % readbackRingSize) * readbackSlotSize,
+				.bufferRowLength = 0,  // tightly packed
+				.bufferImageHeight = 0,
+				.imageSubresource = vk::ImageSubresourceLayers{
+					.aspectMask = vk::ImageAspectFlagBits::eColor,
+					.mipLevel = 0,
+					.baseArrayLayer = 0,
+					.layerCount = 1,
+				},
+				.imageOffset = vk::Offset3D(0, 0, 0),
+				.imageExtent = vk::Extent3D(offscreenExtent.width, offscreenExtent.height, 1),
+			}
+		);
+		vk::cmdPipelineBarrier(
+			commandBuffer,
+			vk::PipelineStageFlagBits::eTransfer,  // srcStageMask
+			vk::PipelineStageFlagBits::eHost,  // dstStageMask
+			vk::DependencyFlags(),  // dependencyFlags
+			vk::MemoryBarrier{  // memoryBarriers
+				.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+				.dstAccessMask = vk::AccessFlagBits::eHostRead,
+			},
+			{ nullptr, 0 },  // bufferMemoryBarriers
+			{ nullptr, 0 }  // imageMemoryBarriers
+		);
+	}
+
+	// end frame queries
+	if(pipelineStatisticsPool)
+		vk::cmdEndQuery(commandBuffer, pipelineStatisticsPool, 0);
+	if(timestampPool)
+		vk::cmdWriteTimestamp(commandBuffer, vk::PipelineStageFlagBits::eBottomOfPipe, timestampPool, 1);
+
+	// end command buffer
 	vk::endCommandBuffer(commandBuffer);
 
 	// submit frame
+	// (if the compute work of the previous frame was overlapped, its results are handed over
+	// to this frame by the semaphore; the fragment shader is the consumer)
 	vk::resetFences(renderFinishedFence);
-	vk::Semaphore renderingFinishedSemaphore = renderingFinishedSemaphores[acquiredImageIndex];
+	vk::Semaphore renderingFinishedSemaphore = offscreenRequested ? nullptr : renderingFinishedSemaphores[acquiredImageIndex].get();
+	vk::Semaphore computeSemaphore = computeFinishedSemaphore;
 	vk::queueSubmit(
 		graphicsQueue,  // queue
 		vk::SubmitInfo{  // submits
-			.waitSemaphoreCount = 0,
-			.pWaitSemaphores = nullptr,
-			.pWaitDstStageMask = nullptr,
+			.waitSemaphoreCount = computeSemaphorePending ? 1u : 0u,
+			.pWaitSemaphores = &computeSemaphore,
+			.pWaitDstStageMask = &(const vk::PipelineStageFlags&)vk::PipelineStageFlags(vk::PipelineStageFlagBits::eFragmentShader),
 			.commandBufferCount = 1,
 			.pCommandBuffers = &commandBuffer,
-			.signalSemaphoreCount = 1,
+			.signalSemaphoreCount = offscreenRequested ? 0u : 1u,  // offscreen frames are not presented
 			.pSignalSemaphores = &renderingFinishedSemaphore,
 		},
 		renderFinishedFence  // fence
 	);
+	computeSemaphorePending = false;
+	frameQueriesPending = pipelineStatisticsPool || timestampPool;
+
+	// compute work with overlap
+	// (it is submitted to the compute queue and runs concurrently with the rendering)
+	if(asyncComputeRequested) {
+		if(computeOverlap) {
+			vk::queueSubmit(
+				computeQueue,  // queue
+				vk::SubmitInfo{  // submits
+					.waitSemaphoreCount = 0,
+					.pWaitSemaphores = nullptr,
+					.pWaitDstStageMask = nullptr,
+					.commandBufferCount = 1,
+					.pCommandBuffers = &computeCommandBuffer,
+					.signalSemaphoreCount = 1,
+					.pSignalSemaphores = &computeSemaphore,
+				},
+				computeFinishedFence  // fence
+			);
+			computeSemaphorePending = true;
+			computeFencePending = true;
+		}
+		computeQueriesPending = bool(computeTimestampPool);
+		previousComputeOverlap = computeOverlap;
+	}
+
+	// offscreen frame is finished by the readback instead of the presentation
+	// (frames are rendered continuously)
+	if(offscreenRequested) {
+		readbackPending = true;
+		numOffscreenFrames++;
+		numReadbackBytes += uint64_t(offscreenExtent.width) * offscreenExtent.height * 4;
+		if(numOffscreenFrames % frameStatisticsInterval == 0)
+			printOffscreenStatistics();
+		window.scheduleFrame();
+		return;
+	}
 
 	// present
 	vk::Result r =
@@ -830,6 +2016,251 @@ void App::frame(VulkanWindow&)
 		} else
 			throw runtime_error(string("Vulkan error: vkQueuePresentKHR() failed with error ") + to_cstr(r) + ".");
 	}
+
+	// render continuously while measuring
+	// (otherwise, new frame is rendered only when the window needs to be repainted)
+	if(frameStatisticsRequested || asyncComputeRequested || geometryBenchmarkRequested)
+		window.scheduleFrame();
+}
+
+
+void App::readFrameStatistics()
+{
+	frameQueriesPending = false;
+	numStatisticsFrames++;
+
+	// pipeline statistics
+	// (the values are written in the order of the flag bits:
+	// vertex invocations, clipping primitives, fragment invocations)
+	if(pipelineStatisticsPool) {
+		array<uint64_t, 3> statistics;
+		vk::getQueryPoolResults(
+			pipelineStatisticsPool,  // queryPool
+			0,  // firstQuery
+			1,  // queryCount
+			sizeof(statistics),  // dataSize
+			statistics.data(),  // pData
+			sizeof(statistics),  // stride
+			vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait  // flags
+		);
+		for(size_t i=0; i<statistics.size(); i++)
+			pipelineStatisticsSum[i] += statistics[i];
+	}
+
+	// GPU frame time
+	if(timestampPool) {
+		array<uint64_t, 2> timestamps;
+		vk::getQueryPoolResults(
+			timestampPool,  // queryPool
+			0,  // firstQuery
+			2,  // queryCount
+			sizeof(timestamps),  // dataSize
+			timestamps.data(),  // pData
+			sizeof(uint64_t),  // stride
+			vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait  // flags
+		);
+		float t = float((timestamps[1] - timestamps[0]) & timestampValidBitMask) * timestampPeriod / 1e9f;
+		gpuFrameTimeList.push_back(t);
+		if(gpuFrameTimeList.size() > frameTimeHistorySize)
+			gpuFrameTimeList.pop_front();
+		if(asyncComputeRequested)
+			computeStatistics[previousComputeOverlap].frameTimeList.push_back(t);
+
+		// geometry benchmark
+		// (the frame time is attributed to the triangle size of the frame;
+		// the result is printed after each geometryBenchmarkInterval frames of the same size)
+		if(geometryBenchmarkRequested) {
+			vector<float>& l = benchmarkFrameTimeList[benchmarkLevel];
+			l.push_back(t);
+			if(numBenchmarkFrames % geometryBenchmarkInterval == 0) {
+				size_t n = min(l.size(), geometryBenchmarkInterval);
+				float sum = 0.f;
+				for(auto it=l.end()-n; it!=l.end(); it++)
+					sum += *it;
+				printBenchmarkResult(benchmarkLevel, sum / n);
+			}
+		}
+	}
+
+	// print rolling average of the last frameStatisticsInterval frames
+	if(numStatisticsFrames % frameStatisticsInterval == 0) {
+		cout << "Frame " << numStatisticsFrames << ":";
+		if(timestampPool) {
+			float sum = 0.f;
+			for(auto it=gpuFrameTimeList.end()-frameStatisticsInterval; it!=gpuFrameTimeList.end(); it++)
+				sum += *it;
+			cout << "  GPU frame time: " << sum / frameStatisticsInterval * 1e3f << "ms";
+		}
+		if(pipelineStatisticsPool) {
+			cout << "  vertex invocations: " << pipelineStatisticsSum[0] / frameStatisticsInterval
+			     << ", clipping primitives: " << pipelineStatisticsSum[1] / frameStatisticsInterval
+			     << ", fragment invocations: " << pipelineStatisticsSum[2] / frameStatisticsInterval;
+			pipelineStatisticsSum = {};
+		}
+		cout << endl;
+	}
+}
+
+
+void App::printFrameStatistics()
+{
+	if(gpuFrameTimeList.empty())
+		return;
+
+	// print average and percentiles of GPU frame time
+	// (of the last frameTimeHistorySize frames at most)
+	vector<float> l(gpuFrameTimeList.begin(), gpuFrameTimeList.end());
+	sort(l.begin(), l.end());
+	float sum = 0.f;
+	for(float t : l)
+		sum += t;
+	auto percentile = [&l](size_t p) { return l[min(l.size() * p / 100, l.size() - 1)] * 1e3f; };
+	cout << "GPU frame time statistics (last " << l.size() << " frames):\n"
+	        "   average: " << sum / l.size() * 1e3f << "ms\n"
+	        "   min: " << l.front() * 1e3f << "ms, median: " << percentile(50) << "ms, 90th percentile: "
+	     << percentile(90) << "ms, 99th percentile: " << percentile(99) << "ms, max: " << l.back() * 1e3f << "ms" << endl;
+}
+
+
+void App::readComputeStatistics()
+{
+	computeQueriesPending = false;
+
+	// GPU time of the compute dispatch
+	// (timestamps were written on the compute queue in overlapped mode
+	// and on the graphics queue otherwise)
+	array<uint64_t, 2> timestamps;
+	vk::getQueryPoolResults(
+		computeTimestampPool,  // queryPool
+		0,  // firstQuery
+		2,  // queryCount
+		sizeof(timestamps),  // dataSize
+		timestamps.data(),  // pData
+		sizeof(uint64_t),  // stride
+		vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait  // flags
+	);
+	uint64_t mask = previousComputeOverlap ? computeTimestampValidBitMask : timestampValidBitMask;
+	computeStatistics[previousComputeOverlap].computeTimeList.push_back(
+		float((timestamps[1] - timestamps[0]) & mask) * timestampPeriod / 1e9f);
+}
+
+
+void App::printComputeStatistics()
+{
+	if(!asyncComputeRequested)
+		return;
+
+	// print averages of both modes
+	// (frame time is measured on the graphics queue; in not overlapped mode, it includes the compute work)
+	auto average =
+		[](const vector<float>& l) {
+			float sum = 0.f;
+			for(float t : l)
+				sum += t;
+			return l.empty() ? 0.f : sum / l.size();
+		};
+	cout << "Async compute statistics:" << endl;
+	for(bool overlap : { false, true }) {
+		const ComputeModeStatistics& stats = computeStatistics[overlap];
+		if(stats.numCpuFrames == 0 && stats.frameTimeList.empty())
+			continue;
+		cout << (overlap ? "   overlap" : "   no overlap") << " (" << stats.numCpuFrames << " frames):\n"
+		        "      CPU frame interval: " << (stats.numCpuFrames ? stats.cpuTime / stats.numCpuFrames * 1e3f : 0.f) << "ms\n";
+		if(!stats.frameTimeList.empty()) {
+			float computeTime = average(stats.computeTimeList);
+			cout << "      GPU frame time: " << average(stats.frameTimeList) * 1e3f << "ms\n"
+			        "      compute time: " << computeTime * 1e3f << "ms\n"
+			        "      compute performance: " << float(computeNumInstructions) / computeTime * 1e-12f << " TFLOPS\n";
+		}
+	}
+	cout << flush;
+}
+
+
+void App::printBenchmarkResult(size_t level, float frameTime)
+{
+	// triangles, vertices and pixels per second
+	// (vertices are counted once per instance, e.g. as if post-transform cache was perfect;
+	// frame time includes the clear of the render pass, that is negligible for big triangle counts)
+	double numTriangles = double(benchmarkNumInstances[level]) * benchmarkTrianglesPerInstance;
+	double numVertices = double(benchmarkNumInstances[level]) * benchmarkVerticesPerInstance;
+	double numPixels = numTriangles * benchmarkTriangleAreas[level];
+	cout << "Triangle size " << benchmarkTriangleAreas[level] << "px, " << numTriangles * 1e-6 << "M triangles:"
+	        "  GPU time: " << frameTime * 1e3f << "ms, "
+	     << numTriangles / frameTime * 1e-6 << " Mtriangles/s, "
+	     << numVertices / frameTime * 1e-6 << " Mvertices/s, "
+	     << numPixels / frameTime * 1e-9 << " Gpixels/s" << endl;
+}
+
+
+void App::printBenchmarkStatistics()
+{
+	if(!geometryBenchmarkRequested)
+		return;
+
+	// print median frame time of each triangle size
+	cout << "Geometry benchmark results ("
+	     << (indirectDrawRequested
+	         ? (multiDrawIndirectSupported ? "multi draw indirect" : "separate indirect draws")
+	         : "single instanced draw")
+	     << "):" << endl;
+	for(size_t i=0; i<benchmarkTriangleAreas.size(); i++) {
+		vector<float> l(benchmarkFrameTimeList[i]);
+		if(l.empty())
+			continue;
+		sort(l.begin(), l.end());
+		cout << "   ";
+		printBenchmarkResult(i, l[l.size() / 2]);
+	}
+}
+
+
+void App::handOverReadback()
+{
+	// make the data of the previous frame visible to the host and pass them to the writer thread
+	// (renderFinishedFence of the frame must be already signalled)
+	unsigned slot = unsigned((numOffscreenFrames - 1) % readbackRingSize);
+	vk::DeviceSize offset = slot * readbackSlotSize;
+	if(!readbackCoherent)
+		vk::invalidateMappedMemoryRanges(
+			vk::MappedMemoryRange{
+				.memory = readbackMemory,
+				.offset = offset,
+				.size = readbackSlotSize,
+			}
+		);
+	frameWriter->write(slot, readbackData + offset, offscreenExtent.width, offscreenExtent.height);
+	readbackPending = false;
+}
+
+
+void App::printOffscreenStatistics()
+{
+	// sustained rates since the first offscreen frame
+	// (readback is measured by the frames copied to the host, file bandwidth by the bytes written by the writer thread)
+	float t = chrono::duration<float>(chrono::high_resolution_clock::now() - offscreenStartTime).count();
+	cout << "Offscreen frame " << numOffscreenFrames << ":"
+	        "  " << numOffscreenFrames / t << " frames/s, "
+	        "readback: " << numReadbackBytes / t * 1e-6f << " MB/s, "
+	        "file: " << frameWriter->numBytesWritten() / t * 1e-6f << " MB/s, "
+	        "writer stalls: " << numWriterStalls << " (" << writerStallTime * 1e3f << "ms)" << endl;
+}
+
+
+void App::finishOffscreen()
+{
+	if(!offscreenRequested || numOffscreenFrames == 0)
+		return;
+
+	// write the last frame and wait for the writer thread
+	vk::deviceWaitIdle();
+	if(readbackPending)
+		handOverReadback();
+	frameWriter->finish();
+
+	cout << "Offscreen rendering finished (" << frameWriter->numFramesWritten() << " frames written):" << endl;
+	cout << "   ";
+	printOffscreenStatistics();
 }
 
 
@@ -840,6 +2271,8 @@ int main(int argc, char* argv[])
 	try {
 
 		App app(argc, argv);
+		if(app.helpPrinted)
+			return 99;
 		app.init();
 		app.window.setResizeCallback(
 			bind(
@@ -855,6 +2288,10 @@ int main(int argc, char* argv[])
 		);
 		app.window.show();
 		app.window.mainLoop();
+		app.printFrameStatistics();
+		app.printComputeStatistics();
+		app.printBenchmarkStatistics();
+		app.finishOffscreen();
 
 	// catch exceptions
 	} catch(vk::Error& e) {